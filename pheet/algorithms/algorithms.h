@@ -0,0 +1,22 @@
+/*
+ * algorithms.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMS_H_
+#define ALGORITHMS_H_
+
+/*
+ * Generic parallel algorithms. All of them are templated on the Pheet environment (and
+ * therefore work with any scheduler), need to be called from within a place (e.g. from
+ * a task), and return when all the work they spawned is done.
+ */
+#include "parallel_for.h"
+#include "parallel_reduce.h"
+#include "parallel_scan.h"
+#include "parallel_sort.h"
+
+#endif /* ALGORITHMS_H_ */
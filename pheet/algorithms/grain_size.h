@@ -0,0 +1,40 @@
+/*
+ * grain_size.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef GRAIN_SIZE_H_
+#define GRAIN_SIZE_H_
+
+#include "../settings.h"
+
+#include <algorithm>
+
+namespace pheet {
+
+/*
+ * Number of chunks per place the automatic grain size aims for. Enough slack for
+ * work-stealing to balance uneven chunks, few enough to keep the spawn overhead low.
+ */
+size_t const algorithm_chunks_per_place = 8;
+
+/*
+ * Returns grain if it is set (!= 0), otherwise a grain size that splits length elements
+ * into about algorithm_chunks_per_place chunks per place, but not smaller than min_grain.
+ * Needs to be called from within a place.
+ */
+template <class Pheet>
+size_t algorithm_grain_size(size_t length, size_t grain, size_t min_grain = 1) {
+	if(grain != 0) {
+		return grain;
+	}
+	size_t chunks = Pheet::get_num_places() * algorithm_chunks_per_place;
+	return std::max((length + chunks - 1) / chunks, std::max(min_grain, static_cast<size_t>(1)));
+}
+
+}
+
+#endif /* GRAIN_SIZE_H_ */
@@ -0,0 +1,96 @@
+/*
+ * parallel_for.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PARALLEL_FOR_H_
+#define PARALLEL_FOR_H_
+
+#include "grain_size.h"
+
+#include <type_traits>
+
+namespace pheet {
+
+/*
+ * Splits [first, last) in halves until it is at most grain elements long. The upper halves
+ * are spawned, so the largest pieces are the first ones to be stolen.
+ * F is called as f(begin, end) for each piece.
+ */
+template <class Pheet, typename Index, class F>
+class ParallelForRangeTask : public Pheet::Task {
+public:
+	typedef ParallelForRangeTask<Pheet, Index, F> Self;
+
+	ParallelForRangeTask(Index first, Index last, size_t grain, F& f)
+	: first(first), last(last), grain(grain), f(f) {}
+	virtual ~ParallelForRangeTask() {}
+
+	virtual void operator()() {
+		while(static_cast<size_t>(last - first) > grain) {
+			Index middle = first + (last - first) / 2;
+			Pheet::template
+				spawn<Self>(middle, last, grain, f);
+			last = middle;
+		}
+		f(first, last);
+	}
+
+private:
+	Index first;
+	Index last;
+	size_t grain;
+	F& f;
+};
+
+/*
+ * Adapter calling f(i) for each i in a piece
+ */
+template <typename Index, class F>
+struct ParallelForEach {
+	ParallelForEach(F& f)
+	: f(f) {}
+
+	void operator()(Index first, Index last) {
+		for(Index i = first; i != last; ++i) {
+			f(i);
+		}
+	}
+
+	F& f;
+};
+
+/*
+ * Calls f(begin, end) for disjoint pieces of [first, last) in parallel and returns when all
+ * pieces are done. Index may be an integer or a random access iterator. A grain size of 0
+ * selects the grain size automatically (see algorithm_grain_size).
+ */
+template <class Pheet, typename Index, class F>
+void parallel_for_range(Index first, Index last, F&& f, size_t grain = 0) {
+	typedef typename std::remove_reference<F>::type FT;
+	if(first == last) {
+		return;
+	}
+	grain = algorithm_grain_size<Pheet>(last - first, grain);
+	FT& fr = f;
+	Pheet::template
+		finish<ParallelForRangeTask<Pheet, Index, FT> >(first, last, grain, fr);
+}
+
+/*
+ * Calls f(i) for each i in [first, last) in parallel
+ */
+template <class Pheet, typename Index, class F>
+void parallel_for(Index first, Index last, F&& f, size_t grain = 0) {
+	typedef typename std::remove_reference<F>::type FT;
+	FT& fr = f;
+	ParallelForEach<Index, FT> each(fr);
+	parallel_for_range<Pheet>(first, last, each, grain);
+}
+
+}
+
+#endif /* PARALLEL_FOR_H_ */
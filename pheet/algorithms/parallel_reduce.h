@@ -0,0 +1,106 @@
+/*
+ * parallel_reduce.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PARALLEL_REDUCE_H_
+#define PARALLEL_REDUCE_H_
+
+#include "parallel_for.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Like ParallelForRangeTask, but every task works on its own copy of the reducer (which
+ * creates a new view of the reducer, see primitives/Reducer). The lower halves are spawned,
+ * as a spawned copy of an ordered reducer is ordered before the data the parent adds
+ * afterwards. This keeps the result in order of indices for non-commutative reducers
+ * (e.g. ListReducer).
+ */
+template <class Pheet, typename Index, class Reducer, class F>
+class ParallelForReducerTask : public Pheet::Task {
+public:
+	typedef ParallelForReducerTask<Pheet, Index, Reducer, F> Self;
+
+	ParallelForReducerTask(Index first, Index last, size_t grain, Reducer& reducer, F& f)
+	: first(first), last(last), grain(grain), reducer(reducer), f(f) {}
+	virtual ~ParallelForReducerTask() {}
+
+	virtual void operator()() {
+		while(static_cast<size_t>(last - first) > grain) {
+			Index middle = first + (last - first) / 2;
+			Pheet::template
+				spawn<Self>(first, middle, grain, reducer, f);
+			first = middle;
+		}
+		for(Index i = first; i != last; ++i) {
+			f(i, reducer);
+		}
+	}
+
+private:
+	Index first;
+	Index last;
+	size_t grain;
+	Reducer reducer;
+	F& f;
+};
+
+/*
+ * Calls f(i, reducer) for each i in [first, last) in parallel, where reducer is a view of the
+ * given reducer local to the calling task. The result can be read from the reducer (e.g.
+ * SumReducer::get_sum) after the call returns.
+ */
+template <class Pheet, typename Index, class Reducer, class F>
+void parallel_for_reducer(Index first, Index last, Reducer& reducer, F&& f, size_t grain = 0) {
+	typedef typename std::remove_reference<F>::type FT;
+	if(first == last) {
+		return;
+	}
+	grain = algorithm_grain_size<Pheet>(last - first, grain);
+	FT& fr = f;
+	Pheet::template
+		finish<ParallelForReducerTask<Pheet, Index, Reducer, FT> >(first, last, grain, reducer, fr);
+}
+
+/*
+ * Reduces [first, last) without a reducer object: map(begin, end) reduces a chunk to a T,
+ * the chunk results are then combined in order with combine(T, T), starting with identity.
+ * combine needs to be associative, but not commutative.
+ */
+template <class Pheet, typename Index, typename T, class Map, class Combine>
+T parallel_reduce(Index first, Index last, T const& identity, Map&& map, Combine&& combine, size_t grain = 0) {
+	if(first == last) {
+		return identity;
+	}
+	size_t length = last - first;
+	grain = algorithm_grain_size<Pheet>(length, grain);
+	size_t chunks = (length + grain - 1) / grain;
+	if(chunks == 1) {
+		return combine(identity, map(first, last));
+	}
+
+	std::vector<T> partial(chunks, identity);
+	parallel_for<Pheet>(static_cast<size_t>(0), chunks,
+		[&](size_t c) {
+			Index begin = first + c * grain;
+			Index end = (c == chunks - 1)?last:(begin + grain);
+			partial[c] = map(begin, end);
+		}, 1);
+
+	T ret = identity;
+	for(size_t c = 0; c < chunks; ++c) {
+		ret = combine(ret, partial[c]);
+	}
+	return ret;
+}
+
+}
+
+#endif /* PARALLEL_REDUCE_H_ */
@@ -0,0 +1,111 @@
+/*
+ * parallel_scan.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PARALLEL_SCAN_H_
+#define PARALLEL_SCAN_H_
+
+#include "parallel_for.h"
+
+#include <iterator>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Minimum grain size for scans. Each element is touched twice, so chunks need to be large
+ * enough to amortize the second pass and the spawns.
+ */
+size_t const parallel_scan_min_grain = 4096;
+
+/*
+ * Two pass chunked scan: the first pass reduces each chunk, the chunk sums are scanned
+ * sequentially, and the second pass scans each chunk starting with the prefix of all
+ * chunks before it. If has_init is false, the scan is inclusive, otherwise exclusive
+ * starting with init. out may be equal to first.
+ */
+template <class Pheet, typename InIter, typename OutIter, typename T, class Op>
+void parallel_scan_chunked(InIter first, InIter last, OutIter out, T const& init, bool has_init, Op& op, size_t grain) {
+	size_t length = last - first;
+	if(length == 0) {
+		return;
+	}
+	grain = algorithm_grain_size<Pheet>(length, grain, parallel_scan_min_grain);
+	size_t chunks = (length + grain - 1) / grain;
+
+	// prefix[c] is the combination of all elements before chunk c (and init)
+	std::vector<T> prefix(chunks, init);
+	if(chunks > 1) {
+		std::vector<T> sums(chunks - 1, init);
+		parallel_for<Pheet>(static_cast<size_t>(0), chunks - 1,
+			[&](size_t c) {
+				InIter i = first + c * grain;
+				InIter end = i + grain;
+				T acc = *i;
+				for(++i; i != end; ++i) {
+					acc = op(acc, *i);
+				}
+				sums[c] = acc;
+			}, 1);
+
+		prefix[1] = has_init?op(init, sums[0]):sums[0];
+		for(size_t c = 2; c < chunks; ++c) {
+			prefix[c] = op(prefix[c - 1], sums[c - 1]);
+		}
+	}
+
+	parallel_for<Pheet>(static_cast<size_t>(0), chunks,
+		[&](size_t c) {
+			InIter i = first + c * grain;
+			InIter end = (c == chunks - 1)?last:(i + grain);
+			OutIter o = out + c * grain;
+			T acc;
+			if(c == 0 && !has_init) {
+				acc = *i;
+				*o = acc;
+				++i;
+				++o;
+			}
+			else {
+				acc = prefix[c];
+			}
+			if(has_init) {
+				for(; i != end; ++i, ++o) {
+					T tmp = *i;
+					*o = acc;
+					acc = op(acc, tmp);
+				}
+			}
+			else {
+				for(; i != end; ++i, ++o) {
+					acc = op(acc, *i);
+					*o = acc;
+				}
+			}
+		}, 1);
+}
+
+/*
+ * out[i] = first[0] op ... op first[i]. op needs to be associative
+ */
+template <class Pheet, typename InIter, typename OutIter, class Op>
+void parallel_inclusive_scan(InIter first, InIter last, OutIter out, Op&& op, size_t grain = 0) {
+	typedef typename std::iterator_traits<InIter>::value_type T;
+	parallel_scan_chunked<Pheet>(first, last, out, T(), false, op, grain);
+}
+
+/*
+ * out[i] = init op first[0] op ... op first[i - 1]. op needs to be associative
+ */
+template <class Pheet, typename InIter, typename OutIter, typename T, class Op>
+void parallel_exclusive_scan(InIter first, InIter last, OutIter out, T const& init, Op&& op, size_t grain = 0) {
+	parallel_scan_chunked<Pheet>(first, last, out, init, true, op, grain);
+}
+
+}
+
+#endif /* PARALLEL_SCAN_H_ */
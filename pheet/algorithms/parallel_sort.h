@@ -0,0 +1,113 @@
+/*
+ * parallel_sort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PARALLEL_SORT_H_
+#define PARALLEL_SORT_H_
+
+#include "grain_size.h"
+#include "../misc/bitops.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace pheet {
+
+/*
+ * Minimum grain size for sorting. Below that, std::sort is faster than spawning
+ */
+size_t const parallel_sort_min_grain = 2048;
+
+/*
+ * Quicksort with a three-way partition around a median of three pivot (so equal keys do not
+ * degrade the recursion). The smaller part is spawned, the larger one is processed by the
+ * task itself. Pieces of at most grain elements, and pieces nested deeper than
+ * 2 * log2(length) (bad pivots), are sorted with std::sort.
+ */
+template <class Pheet, typename Iter, class Compare>
+class ParallelSortTask : public Pheet::Task {
+public:
+	typedef ParallelSortTask<Pheet, Iter, Compare> Self;
+	typedef typename std::iterator_traits<Iter>::value_type T;
+
+	ParallelSortTask(Iter first, Iter last, size_t grain, size_t depth, Compare& comp)
+	: first(first), last(last), grain(grain), depth(depth), comp(comp) {}
+	virtual ~ParallelSortTask() {}
+
+	virtual void operator()() {
+		while(static_cast<size_t>(last - first) > grain && depth > 0) {
+			--depth;
+			T pivot = median(*first, *(first + (last - first) / 2), *(last - 1));
+			Iter lower = std::partition(first, last,
+				[&](T const& x) { return comp(x, pivot); });
+			Iter upper = std::partition(lower, last,
+				[&](T const& x) { return !comp(pivot, x); });
+
+			if(lower - first < last - upper) {
+				spawn_or_sort(first, lower);
+				first = upper;
+			}
+			else {
+				spawn_or_sort(upper, last);
+				last = lower;
+			}
+		}
+		std::sort(first, last, comp);
+	}
+
+private:
+	void spawn_or_sort(Iter begin, Iter end) {
+		if(static_cast<size_t>(end - begin) > grain) {
+			Pheet::template
+				spawn<Self>(begin, end, grain, depth, comp);
+		}
+		else if(end - begin > 1) {
+			std::sort(begin, end, comp);
+		}
+	}
+
+	T const& median(T const& a, T const& b, T const& c) {
+		if(comp(a, b)) {
+			return comp(b, c)?b:(comp(a, c)?c:a);
+		}
+		return comp(a, c)?a:(comp(b, c)?c:b);
+	}
+
+	Iter first;
+	Iter last;
+	size_t grain;
+	size_t depth;
+	Compare& comp;
+};
+
+/*
+ * Sorts [first, last) in parallel. Not stable
+ */
+template <class Pheet, typename Iter, class Compare>
+void parallel_sort(Iter first, Iter last, Compare&& comp, size_t grain = 0) {
+	typedef typename std::remove_reference<Compare>::type CT;
+	size_t length = last - first;
+	if(length <= 1) {
+		return;
+	}
+	grain = algorithm_grain_size<Pheet>(length, grain, parallel_sort_min_grain);
+	size_t depth = 2 * find_last_bit_set(length);
+	CT& c = comp;
+	Pheet::template
+		finish<ParallelSortTask<Pheet, Iter, CT> >(first, last, grain, depth, c);
+}
+
+template <class Pheet, typename Iter>
+void parallel_sort(Iter first, Iter last) {
+	parallel_sort<Pheet>(first, last, std::less<typename std::iterator_traits<Iter>::value_type>());
+}
+
+}
+
+#endif /* PARALLEL_SORT_H_ */
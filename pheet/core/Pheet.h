@@ -35,12 +35,14 @@ public:
 	typedef ConcurrentDataStructures CDS;
 
 	typedef typename SystemModel::MachineModel MachineModel;
+	typedef typename SystemModel::MemoryArena MemoryArena;
 
 	typedef typename Primitives::Backoff Backoff;
 	typedef typename Primitives::Barrier Barrier;
 	typedef typename Primitives::Finisher Finisher;
 	typedef typename Primitives::Mutex Mutex;
 	typedef typename Primitives::LockGuard LockGuard;
+	typedef typename Primitives::Parking Parking;
 
 	typedef SchedulerT<Self> Scheduler;
 	typedef Scheduler Environment;
@@ -56,6 +58,9 @@ public:
 	template<template <class P> class NewMM>
 	using WithMachineModel = PheetEnv<SchedulerT, SystemModel::template WithMachineModel<NewMM>::template BT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>;
 
+	template<template <class P> class NewArena>
+	using WithMemoryArena = PheetEnv<SchedulerT, SystemModel::template WithMemoryArena<NewArena>::template BT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>;
+
 	template<template <class P> class NewCDS>
 	using WithCDS = PheetEnv<SchedulerT, SystemModelT, PrimitivesT, DataStructuresT, NewCDS>;
 
@@ -71,6 +76,9 @@ public:
 	template<template <class P, typename, typename> class NewTS>
 	using WithPriorityTaskStorage = PheetEnv<Scheduler::template WithPriorityTaskStorage<NewTS>::template BT, SystemModelT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>;
 
+	template<template <class P, class> class NewVS>
+	using WithVictimSelector = PheetEnv<Scheduler::template WithVictimSelector<NewVS>::template BT, SystemModelT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>;
+
 	template <template <class> class NewPrim>
 	using WithPrimitives = PheetEnv<SchedulerT, SystemModelT, NewPrim, DataStructuresT, ConcurrentDataStructuresT>;
 
@@ -80,6 +88,9 @@ public:
 	template<template <class> class M>
 	using WithBackoff = WithPrimitives<Primitives::template WithBackoff<M>::template BT>;
 
+	template<template <class> class M>
+	using WithParking = WithPrimitives<Primitives::template WithParking<M>::template BT>;
+
 	PheetEnv() {}
 	~PheetEnv() {}
 
@@ -106,6 +117,12 @@ public:
 
 	template<class Strategy, typename F, typename ... TaskParams>
 		static void spawn_s(Strategy s, F&& f, TaskParams&& ... params);
+
+	template<class CallTaskType, class Strategy, typename ... TaskParams>
+		static typename Strategy::TaskHandle spawn_s_handle(Strategy s, TaskParams&& ... params);
+
+	template<class CallTaskType, class Strategy, typename ... TaskParams>
+		static void reprioritize(typename Strategy::TaskHandle& handle, Strategy s, TaskParams&& ... params);
 /*
 	template<class CallTaskType, class Strategy, typename ... TaskParams>
 		static void spawn_s(Strategy&& s, TaskParams&& ... params);
@@ -201,6 +218,22 @@ inline void PheetEnv<SchedulerT, SystemModelT, PrimitivesT, DataStructuresT, Con
 	p->spawn_s(std::forward<Strategy&&>(s), f, std::forward<TaskParams&&>(params) ...);
 }*/
 
+template <template <class Env> class SchedulerT, template <class Env> class SystemModelT, template <class Env> class PrimitivesT, template <class Env> class DataStructuresT, template <class Env> class ConcurrentDataStructuresT>
+template<class CallTaskType, class Strategy, typename ... TaskParams>
+inline typename Strategy::TaskHandle PheetEnv<SchedulerT, SystemModelT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>::spawn_s_handle(Strategy s, TaskParams&& ... params) {
+	Place* p = Scheduler::get_place();
+	pheet_assert(p != NULL);
+	return p->template spawn_s_handle<CallTaskType>(std::move(s), std::forward<TaskParams&&>(params) ...);
+}
+
+template <template <class Env> class SchedulerT, template <class Env> class SystemModelT, template <class Env> class PrimitivesT, template <class Env> class DataStructuresT, template <class Env> class ConcurrentDataStructuresT>
+template<class CallTaskType, class Strategy, typename ... TaskParams>
+inline void PheetEnv<SchedulerT, SystemModelT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>::reprioritize(typename Strategy::TaskHandle& handle, Strategy s, TaskParams&& ... params) {
+	Place* p = Scheduler::get_place();
+	pheet_assert(p != NULL);
+	p->template reprioritize<CallTaskType>(handle, std::move(s), std::forward<TaskParams&&>(params) ...);
+}
+
 template <template <class Env> class SchedulerT, template <class Env> class SystemModelT, template <class Env> class PrimitivesT, template <class Env> class DataStructuresT, template <class Env> class ConcurrentDataStructuresT>
 template<class CallTaskType, class Strategy, typename ... TaskParams>
 void PheetEnv<SchedulerT, SystemModelT, PrimitivesT, DataStructuresT, ConcurrentDataStructuresT>::spawn_prio(Strategy s, TaskParams&& ... params) {
@@ -13,30 +13,35 @@
 #include "../primitives/Barrier/Simple/SimpleBarrier.h"
 #include "../primitives/Finisher/Basic/Finisher.h"
 #include "../primitives/Mutex/BackoffLock/BackoffLock.h"
+#include "../primitives/Parking/Futex/FutexParking.h"
 
 namespace pheet {
 
-template <class Env, template <class E> class BackoffT, template <class E> class BarrierT, template <class> class FinisherT, template <class> class MutexT>
+template <class Env, template <class E> class BackoffT, template <class E> class BarrierT, template <class> class FinisherT, template <class> class MutexT, template <class> class ParkingT>
 class PrimitivesEnv {
 public:
 	template <class P>
-	using BT = PrimitivesEnv<P, BackoffT, BarrierT, FinisherT, MutexT>;
+	using BT = PrimitivesEnv<P, BackoffT, BarrierT, FinisherT, MutexT, ParkingT>;
 
 	typedef BackoffT<Env> Backoff;
 	typedef BarrierT<Env> Barrier;
 	typedef FinisherT<Env> Finisher;
 	typedef MutexT<Env> Mutex;
+	typedef ParkingT<Env> Parking;
 	typedef typename Mutex::LockGuard LockGuard;
 
 	template <template <class> class NewMutex>
-	using WithMutex = PrimitivesEnv<Env, BackoffT, BarrierT, FinisherT, NewMutex>;
+	using WithMutex = PrimitivesEnv<Env, BackoffT, BarrierT, FinisherT, NewMutex, ParkingT>;
 
 	template <template <class> class NewBackoff>
-	using WithBackoff = PrimitivesEnv<Env, NewBackoff, BarrierT, FinisherT, MutexT>;
+	using WithBackoff = PrimitivesEnv<Env, NewBackoff, BarrierT, FinisherT, MutexT, ParkingT>;
+
+	template <template <class> class NewParking>
+	using WithParking = PrimitivesEnv<Env, BackoffT, BarrierT, FinisherT, MutexT, NewParking>;
 };
 
 template<class Pheet>
-using Primitives = PrimitivesEnv<Pheet, ExponentialBackoff, SimpleBarrier, Finisher, BackoffLock>;
+using Primitives = PrimitivesEnv<Pheet, ExponentialBackoff, SimpleBarrier, Finisher, BackoffLock, FutexParking>;
 
 }
 
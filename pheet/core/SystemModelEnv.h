@@ -12,26 +12,31 @@
 #include "../settings.h"
 
 #include "../models/MachineModel/HWLoc/HWLocMachineModel.h"
+#include "../memory/Arena/HeapMemoryArena.h"
 
 namespace pheet {
 
-template <class Env, template <class E> class MachineModelT>
+template <class Env, template <class E> class MachineModelT, template <class E> class MemoryArenaT>
 class SystemModelEnv {
 public:
 	typedef MachineModelT<Env> MachineModel;
+	typedef MemoryArenaT<Env> MemoryArena;
 
 	template <template <class P> class NewMM>
-	using WithMachineModel = SystemModelEnv<Env, NewMM>;
+	using WithMachineModel = SystemModelEnv<Env, NewMM, MemoryArenaT>;
+
+	template <template <class P> class NewArena>
+	using WithMemoryArena = SystemModelEnv<Env, MachineModelT, NewArena>;
 
 	template <class P>
-	using T = SystemModelEnv<P, MachineModelT>;
+	using T = SystemModelEnv<P, MachineModelT, MemoryArenaT>;
 
 	template <class P>
-	using BT = SystemModelEnv<P, MachineModelT>;
+	using BT = SystemModelEnv<P, MachineModelT, MemoryArenaT>;
 };
 
 template<class Pheet>
-using SystemModel = SystemModelEnv<Pheet, HWLocMachineModel>;
+using SystemModel = SystemModelEnv<Pheet, HWLocMachineModel, HeapMemoryArena>;
 
 }
 
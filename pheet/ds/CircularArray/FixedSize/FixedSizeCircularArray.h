@@ -21,11 +21,14 @@ public:
 
 	size_t get_capacity();
 	bool is_growable();
+	bool is_shrinkable();
 
 	T& get(size_t i);
 	void put(size_t i, T value);
 
 	void grow(size_t bottom, size_t top);
+	void shrink(size_t bottom, size_t top);
+	void reclaim();
 private:
 	size_t const capacity;
 	T* data;
@@ -52,6 +55,11 @@ bool FixedSizeCircularArray<Pheet, T>::is_growable() {
 	return false;
 }
 
+template <class Pheet, typename T>
+bool FixedSizeCircularArray<Pheet, T>::is_shrinkable() {
+	return false;
+}
+
 template <class Pheet, typename T>
 T& FixedSizeCircularArray<Pheet, T>::get(size_t i) {
 	return data[i % capacity];
@@ -67,6 +75,16 @@ void FixedSizeCircularArray<Pheet, T>::grow(size_t, size_t) {
 	pheet_assert(false);
 }
 
+template <class Pheet, typename T>
+void FixedSizeCircularArray<Pheet, T>::shrink(size_t, size_t) {
+	pheet_assert(false);
+}
+
+template <class Pheet, typename T>
+void FixedSizeCircularArray<Pheet, T>::reclaim() {
+
+}
+
 }
 
 #endif /* FIXEDSIZECIRCULARARRAY_H_ */
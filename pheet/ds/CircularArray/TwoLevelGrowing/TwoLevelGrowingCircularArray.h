@@ -12,9 +12,21 @@
 #include <pheet/settings.h>
 
 #include <pheet/misc/bitops.h>
+#include <pheet/misc/atomics.h>
+
+#include <type_traits>
+#include <new>
+#include <sys/mman.h>
 
 namespace pheet {
 
+/*
+ * Segments are allocated in doubling sizes. Segments of at least map_threshold bytes are
+ * mapped directly and bound to the NUMA node of the thread growing the array (which is
+ * the owner of the data structure using it). On shrink these segments keep their address
+ * range, so concurrent readers never access unmapped memory, but their pages are returned
+ * to the system by reclaim(). Smaller segments stay allocated until the array is destroyed.
+ */
 template <class Pheet, typename TT, size_t MaxBuckets = 32>
 class TwoLevelGrowingCircularArrayImpl {
 public:
@@ -29,23 +41,37 @@ public:
 
 	size_t get_capacity();
 	bool is_growable();
+	bool is_shrinkable();
 
 	// return value NEEDS to be const. When growing we cannot guarantee that the reference won't change
 	T const& get(size_t i);
 	void put(size_t i, T value);
 
 	void grow(size_t bottom, size_t top);
+	void shrink(size_t bottom, size_t top);
+	void reclaim();
 
 private:
+	static size_t const map_threshold = 1 << 16;
+
+	static bool is_mapped(size_t bucket);
+	static size_t bucket_bytes(size_t bucket);
+	T* allocate_bucket(size_t bucket);
+	void free_bucket(size_t bucket);
+
 	const size_t initial_buckets;
 	size_t buckets;
+	// Buckets above buckets that are still allocated from a previous shrink
+	size_t allocated_buckets;
+	// Buckets that might still hold resident pages
+	size_t resident_buckets;
 	size_t capacity;
 	T* data[MaxBuckets];
 };
 
 template <class Pheet, typename T, size_t MaxBuckets>
 TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::TwoLevelGrowingCircularArrayImpl()
-: initial_buckets(5), buckets(initial_buckets), capacity(1 << (buckets - 1)) {
+: initial_buckets(5), buckets(initial_buckets), allocated_buckets(initial_buckets), resident_buckets(initial_buckets), capacity(1 << (buckets - 1)) {
 	pheet_assert(buckets <= MaxBuckets);
 
 	T* ptr = new T[capacity];
@@ -60,7 +86,7 @@ TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::TwoLevelGrowingCircularA
 
 template <class Pheet, typename T, size_t MaxBuckets>
 TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::TwoLevelGrowingCircularArrayImpl(size_t initial_capacity)
-: initial_buckets(find_last_bit_set(initial_capacity - 1) + 1), buckets(initial_buckets), capacity(1 << (buckets - 1)) {
+: initial_buckets(find_last_bit_set(initial_capacity - 1) + 1), buckets(initial_buckets), allocated_buckets(initial_buckets), resident_buckets(initial_buckets), capacity(1 << (buckets - 1)) {
 	pheet_assert(initial_capacity > 0);
 	pheet_assert(buckets <= MaxBuckets);
 
@@ -77,8 +103,8 @@ TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::TwoLevelGrowingCircularA
 template <class Pheet, typename T, size_t MaxBuckets>
 TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::~TwoLevelGrowingCircularArrayImpl() {
 	delete[] (data[0]);
-	for(size_t i = initial_buckets; i < buckets; i++)
-		delete [](data[i]);
+	for(size_t i = initial_buckets; i < allocated_buckets; i++)
+		free_bucket(i);
 }
 
 template <class Pheet, typename T, size_t MaxBuckets>
@@ -91,6 +117,11 @@ bool TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::is_growable() {
 	return buckets < MaxBuckets;
 }
 
+template <class Pheet, typename T, size_t MaxBuckets>
+bool TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::is_shrinkable() {
+	return buckets > initial_buckets;
+}
+
 // return value NEEDS to be const. When growing we cannot guarantee that the reference won't change
 template <class Pheet, typename T, size_t MaxBuckets>
 inline T const& TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::get(size_t i) {
@@ -110,8 +141,14 @@ template <class Pheet, typename T, size_t MaxBuckets>
 void TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::grow(size_t bottom, size_t top) {
 	pheet_assert(is_growable());
 
-	data[buckets] = new T[capacity];
+	if(buckets == allocated_buckets) {
+		data[buckets] = allocate_bucket(buckets);
+		++allocated_buckets;
+	}
 	buckets++;
+	if(buckets > resident_buckets) {
+		resident_buckets = buckets;
+	}
 	size_t newCapacity = capacity << 1;
 
 	size_t start = top;
@@ -142,6 +179,85 @@ void TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::grow(size_t bottom,
 	capacity = newCapacity;
 }
 
+/*
+ * Halves the capacity. At most half of the new capacity may be in use.
+ * Like grow, this allows for concurrent get operations. The memory of the removed bucket
+ * stays accessible (with arbitrary content) until reclaim is called.
+ */
+template <class Pheet, typename T, size_t MaxBuckets>
+void TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::shrink(size_t bottom, size_t top) {
+	pheet_assert(is_shrinkable());
+	size_t newCapacity = capacity >> 1;
+	pheet_assert(bottom - top <= (newCapacity >> 1));
+
+	// As less than newCapacity items are in use, no item is moved to the old position of another item
+	for(size_t i = top; i < bottom; i++) {
+		size_t oldI = i % capacity;
+		size_t newI = i % newCapacity;
+		if(oldI != newI)
+		{
+			size_t oldBit = find_last_bit_set(oldI);
+			size_t newBit = find_last_bit_set(newI);
+			data[newBit][newI ^ ((1 << (newBit)) >> 1)] =
+				data[oldBit][oldI ^ ((1 << (oldBit)) >> 1)];
+		}
+	}
+
+	MEMORY_FENCE ();
+	capacity = newCapacity;
+	buckets--;
+}
+
+/*
+ * Returns the pages of buckets removed by shrink to the system.
+ * May only be called once no concurrent reader can still use the capacity before the shrink.
+ * The address range stays valid, so a reader that still does will just see zeroed memory.
+ */
+template <class Pheet, typename T, size_t MaxBuckets>
+void TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::reclaim() {
+	for(size_t i = buckets; i < resident_buckets; i++) {
+		if(is_mapped(i)) {
+			madvise(data[i], bucket_bytes(i), MADV_DONTNEED);
+		}
+	}
+	resident_buckets = buckets;
+}
+
+template <class Pheet, typename T, size_t MaxBuckets>
+inline size_t TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::bucket_bytes(size_t bucket) {
+	return sizeof(T) << (bucket - 1);
+}
+
+template <class Pheet, typename T, size_t MaxBuckets>
+inline bool TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::is_mapped(size_t bucket) {
+	// Mapped memory is zero-initialized instead of constructed
+	return std::is_trivial<T>::value && bucket_bytes(bucket) >= map_threshold;
+}
+
+template <class Pheet, typename T, size_t MaxBuckets>
+T* TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::allocate_bucket(size_t bucket) {
+	if(is_mapped(bucket)) {
+		void* ptr = mmap(nullptr, bucket_bytes(bucket), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(ptr != MAP_FAILED) {
+			// Pages are only touched by the owner, and are allocated on its node
+			Pheet::MachineModel::bind_local_memory(ptr, bucket_bytes(bucket));
+			return reinterpret_cast<T*>(ptr);
+		}
+		throw std::bad_alloc();
+	}
+	return new T[(size_t)1 << (bucket - 1)];
+}
+
+template <class Pheet, typename T, size_t MaxBuckets>
+void TwoLevelGrowingCircularArrayImpl<Pheet, T, MaxBuckets>::free_bucket(size_t bucket) {
+	if(is_mapped(bucket)) {
+		munmap(data[bucket], bucket_bytes(bucket));
+	}
+	else {
+		delete[] (data[bucket]);
+	}
+}
+
 template<class Pheet, typename TT>
 using TwoLevelGrowingCircularArray = TwoLevelGrowingCircularArrayImpl<Pheet, TT>;
 
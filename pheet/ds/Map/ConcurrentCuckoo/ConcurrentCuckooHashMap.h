@@ -0,0 +1,610 @@
+/*
+ * ConcurrentCuckooHashMap.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef CONCURRENTCUCKOOHASHMAP_H_
+#define CONCURRENTCUCKOOHASHMAP_H_
+
+#include "../../../settings.h"
+#include "../../../misc/align.h"
+
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <stdint.h>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Bucket with 4 slots. The one-byte tags of all slots are packed into a single word so
+ * a lookup can compare all of them at once. A tag of 0 marks a free slot.
+ * version is a sequence lock: odd while a writer holds the bucket.
+ */
+template <typename Key, typename TT>
+struct ConcurrentCuckooHashMapBucket {
+	ConcurrentCuckooHashMapBucket()
+	: version(0), tags(0), migrated(false) {}
+
+	std::atomic<uint32_t> version;
+	std::atomic<uint32_t> tags;
+	// Set once the content of the bucket has been moved to the next table
+	bool migrated;
+	Key keys[4];
+	TT values[4];
+};
+
+/*
+ * Concurrent version of LightweightCuckooHashMap.
+ *
+ * Uses (partial-key) cuckoo hashing with 4-way buckets: every key has two candidate buckets,
+ * the second one is derived from the first one and the tag of the key, so items can be
+ * displaced without rehashing their keys. Writers lock the (at most two) buckets they
+ * modify, readers are optimistic and validate the versions of both buckets.
+ *
+ * If no free slot can be found by a short breadth-first search of displacements, a table
+ * of twice the size is appended. Items are then migrated bucket by bucket by the writers
+ * (each write helps with a few buckets), so there is no stop-the-world rehash. During
+ * migration readers check the old table first and follow a migrated bucket to the new
+ * table. Old tables are only freed on destruction (they are at most as large as the
+ * current table together), which allows readers to proceed without any reclamation scheme.
+ *
+ * Like LightweightCuckooHashMap this expects lightweight (trivially copyable) keys and values,
+ * as readers may copy them while they are being overwritten and retry afterwards.
+ */
+template <class Pheet, typename Key, typename TT, class Hash, size_t InitialBuckets>
+class ConcurrentCuckooHashMapImpl {
+public:
+	typedef ConcurrentCuckooHashMapImpl<Pheet, Key, TT, Hash, InitialBuckets> Self;
+	typedef ConcurrentCuckooHashMapBucket<Key, TT> Bucket;
+	typedef typename Pheet::Backoff Backoff;
+
+	static_assert((InitialBuckets & (InitialBuckets - 1)) == 0, "Number of buckets needs to be a power of two");
+	static_assert(InitialBuckets >= 2, "Every key needs two distinct buckets");
+
+	ConcurrentCuckooHashMapImpl()
+	: first(new Table(InitialBuckets)), current(first) {}
+
+	~ConcurrentCuckooHashMapImpl() {
+		Table* t = first;
+		while(t != nullptr) {
+			Table* next = t->next.load(std::memory_order_relaxed);
+			delete t;
+			t = next;
+		}
+	}
+
+	/*
+	 * Inserts the key or updates its value if it is already in the map
+	 */
+	void put(Key const& key, TT const& value) {
+		uint64_t h = hash(key);
+		uint8_t tag = get_tag(h);
+		while(true) {
+			size_t b1, b2;
+			Table* t = lock_for_write(h, tag, b1, b2);
+			Bucket& x = t->buckets[b1];
+			Bucket& y = t->buckets[b2];
+			int s;
+			if((s = find_slot(x, tag, key)) != -1) {
+				x.values[s] = value;
+			}
+			else if((s = find_slot(y, tag, key)) != -1) {
+				y.values[s] = value;
+			}
+			else if((s = find_slot(x, 0)) != -1) {
+				store(x, s, tag, key, value);
+			}
+			else if((s = find_slot(y, 0)) != -1) {
+				store(y, s, tag, key, value);
+			}
+			unlock_pair(t, b1, b2);
+			if(s != -1) {
+				return;
+			}
+
+			if(!make_room(t, b1, b2)) {
+				grow(t);
+			}
+		}
+	}
+
+	bool find(Key const& key, TT& value) {
+		uint64_t h = hash(key);
+		uint8_t tag = get_tag(h);
+		Table* t = current.load(std::memory_order_acquire);
+		Table* p = t->prev.load(std::memory_order_acquire);
+		if(p != nullptr) {
+			// Items may not have been migrated yet
+			t = p;
+		}
+		while(true) {
+			size_t b1 = h & t->mask;
+			size_t b2 = alt_bucket(t, b1, tag);
+			Bucket& x = t->buckets[b1];
+			Bucket& y = t->buckets[b2];
+
+			Backoff bo;
+			bool found;
+			bool migrated;
+			while(true) {
+				uint32_t v1 = x.version.load(std::memory_order_acquire);
+				uint32_t v2 = y.version.load(std::memory_order_acquire);
+				if(((v1 | v2) & 1) != 0) {
+					bo.backoff();
+					continue;
+				}
+				migrated = x.migrated || y.migrated;
+				found = true;
+				int s;
+				if((s = find_slot(x, tag, key)) != -1) {
+					value = x.values[s];
+				}
+				else if((s = find_slot(y, tag, key)) != -1) {
+					value = y.values[s];
+				}
+				else {
+					found = false;
+				}
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if(x.version.load(std::memory_order_relaxed) == v1 && y.version.load(std::memory_order_relaxed) == v2) {
+					break;
+				}
+			}
+			if(found) {
+				return true;
+			}
+			if(!migrated) {
+				return false;
+			}
+			t = t->next.load(std::memory_order_acquire);
+			pheet_assert(t != nullptr);
+		}
+	}
+
+	bool contains(Key const& key) {
+		TT value;
+		return find(key, value);
+	}
+
+	/*
+	 * Removes the key and returns its value
+	 */
+	bool retrieve(Key const& key, TT& value) {
+		uint64_t h = hash(key);
+		uint8_t tag = get_tag(h);
+		size_t b1, b2;
+		Table* t = lock_for_write(h, tag, b1, b2);
+		Bucket& x = t->buckets[b1];
+		Bucket& y = t->buckets[b2];
+		int s;
+		bool ret = true;
+		if((s = find_slot(x, tag, key)) != -1) {
+			value = x.values[s];
+			clear(x, s);
+		}
+		else if((s = find_slot(y, tag, key)) != -1) {
+			value = y.values[s];
+			clear(y, s);
+		}
+		else {
+			ret = false;
+		}
+		unlock_pair(t, b1, b2);
+		return ret;
+	}
+
+	bool remove(Key const& key) {
+		TT value;
+		return retrieve(key, value);
+	}
+
+	/*
+	 * Counts all items. Only exact if there are no concurrent modifications
+	 */
+	size_t get_length() {
+		size_t ret = 0;
+		for(Table* t = first; t != nullptr; t = t->next.load(std::memory_order_acquire)) {
+			for(size_t i = 0; i < t->num_buckets; ++i) {
+				uint32_t tags = t->buckets[i].tags.load(std::memory_order_relaxed);
+				for(int s = 0; s < 4; ++s) {
+					if(((tags >> (s << 3)) & 0xFF) != 0) {
+						++ret;
+					}
+				}
+			}
+		}
+		return ret;
+	}
+
+	size_t size() {
+		return get_length();
+	}
+
+	static void print_name() {
+		std::cout << "ConcurrentCuckooHashMap";
+	}
+
+private:
+	struct Table {
+		Table(size_t num_buckets)
+		: num_buckets(num_buckets), mask(num_buckets - 1), data(num_buckets), buckets(data.ptr()),
+		  next(nullptr), prev(nullptr), migrate_cursor(0), num_migrated(0) {
+			for(size_t i = 0; i < num_buckets; ++i) {
+				new (buckets + i) Bucket();
+			}
+		}
+		~Table() {
+			for(size_t i = 0; i < num_buckets; ++i) {
+				buckets[i].~Bucket();
+			}
+		}
+
+		size_t num_buckets;
+		size_t mask;
+		aligned_data<Bucket, 64> data;
+		Bucket* buckets;
+		// Larger table the items are migrated to
+		std::atomic<Table*> next;
+		// Table that is still being migrated to this one
+		std::atomic<Table*> prev;
+		std::atomic<size_t> migrate_cursor;
+		std::atomic<size_t> num_migrated;
+	};
+
+	// Number of buckets a writer migrates on each write
+	static size_t const migrate_chunk = 16;
+	// Maximum number of buckets visited when searching for a displacement path
+	static size_t const max_search = 256;
+
+	static uint64_t hash(Key const& key) {
+		// std::hash is the identity for integers, so mix (murmur3 finalizer)
+		uint64_t h = static_cast<uint64_t>(Hash()(key));
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+		return h;
+	}
+
+	static uint8_t get_tag(uint64_t h) {
+		uint8_t tag = static_cast<uint8_t>(h >> 56);
+		return (tag == 0)?1:tag;
+	}
+
+	static size_t alt_bucket(Table* t, size_t bucket, uint8_t tag) {
+		// Involution, so the alternative of the alternative is the original bucket again.
+		// The offset only depends on the tag, and is never 0 so the buckets always differ
+		size_t offset = (static_cast<size_t>(tag) * 0x5bd1e995) & t->mask;
+		return bucket ^ ((offset == 0)?1:offset);
+	}
+
+	/*
+	 * Compares the tags of all 4 slots at once (SWAR). May report false positives,
+	 * which are filtered out by the key comparison
+	 */
+	static uint32_t match_tags(uint32_t tags, uint8_t tag) {
+		uint32_t x = tags ^ (static_cast<uint32_t>(tag) * 0x01010101u);
+		return (x - 0x01010101u) & ~x & 0x80808080u;
+	}
+
+	static int find_slot(Bucket& b, uint8_t tag, Key const& key) {
+		uint32_t tags = b.tags.load(std::memory_order_relaxed);
+		uint32_t m = match_tags(tags, tag);
+		while(m != 0) {
+			int s = __builtin_ctz(m) >> 3;
+			if(((tags >> (s << 3)) & 0xFF) == tag && b.keys[s] == key) {
+				return s;
+			}
+			m &= m - 1;
+		}
+		return -1;
+	}
+
+	/*
+	 * Finds a slot with the given tag (0 for a free slot)
+	 */
+	static int find_slot(Bucket& b, uint8_t tag) {
+		uint32_t tags = b.tags.load(std::memory_order_relaxed);
+		for(int s = 0; s < 4; ++s) {
+			if(((tags >> (s << 3)) & 0xFF) == tag) {
+				return s;
+			}
+		}
+		return -1;
+	}
+
+	static uint8_t get_slot_tag(Bucket& b, int s) {
+		return static_cast<uint8_t>(b.tags.load(std::memory_order_relaxed) >> (s << 3));
+	}
+
+	static void store(Bucket& b, int s, uint8_t tag, Key const& key, TT const& value) {
+		b.keys[s] = key;
+		b.values[s] = value;
+		uint32_t tags = b.tags.load(std::memory_order_relaxed);
+		tags = (tags & ~(0xFFu << (s << 3))) | (static_cast<uint32_t>(tag) << (s << 3));
+		b.tags.store(tags, std::memory_order_relaxed);
+	}
+
+	static void clear(Bucket& b, int s) {
+		b.tags.store(b.tags.load(std::memory_order_relaxed) & ~(0xFFu << (s << 3)), std::memory_order_relaxed);
+	}
+
+	static void lock(Bucket& b) {
+		Backoff bo;
+		while(true) {
+			uint32_t v = b.version.load(std::memory_order_relaxed);
+			if((v & 1) == 0 && b.version.compare_exchange_weak(v, v + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+				// Readers that see any of our writes also see the odd version
+				std::atomic_thread_fence(std::memory_order_release);
+				return;
+			}
+			bo.backoff();
+		}
+	}
+
+	static void unlock(Bucket& b) {
+		b.version.store(b.version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	static void lock_pair(Table* t, size_t b1, size_t b2) {
+		// Always lock in index order to avoid deadlocks
+		if(b1 == b2) {
+			lock(t->buckets[b1]);
+		}
+		else if(b1 < b2) {
+			lock(t->buckets[b1]);
+			lock(t->buckets[b2]);
+		}
+		else {
+			lock(t->buckets[b2]);
+			lock(t->buckets[b1]);
+		}
+	}
+
+	static void unlock_pair(Table* t, size_t b1, size_t b2) {
+		unlock(t->buckets[b1]);
+		if(b1 != b2) {
+			unlock(t->buckets[b2]);
+		}
+	}
+
+	/*
+	 * Returns the table the key has to be written to, with both candidate buckets locked.
+	 * Makes sure the key is not left behind in a table that is being migrated.
+	 */
+	Table* lock_for_write(uint64_t h, uint8_t tag, size_t& b1, size_t& b2) {
+		Table* t = current.load(std::memory_order_acquire);
+		Table* p = t->prev.load(std::memory_order_acquire);
+		if(p != nullptr) {
+			help_migrate(p);
+			migrate_key(p, h, tag);
+		}
+		while(true) {
+			b1 = h & t->mask;
+			b2 = alt_bucket(t, b1, tag);
+			lock_pair(t, b1, b2);
+			if(!t->buckets[b1].migrated && !t->buckets[b2].migrated) {
+				return t;
+			}
+			// Table has been replaced in the meantime
+			unlock_pair(t, b1, b2);
+			migrate_key(t, h, tag);
+			t = t->next.load(std::memory_order_acquire);
+			pheet_assert(t != nullptr);
+		}
+	}
+
+	struct PathEntry {
+		size_t bucket;
+		int parent;
+		// Slot in the parent bucket whose item moves to this bucket
+		int slot;
+	};
+
+	/*
+	 * Tries to free a slot in one of the two buckets by moving items to their alternative
+	 * buckets. Returns false if no path to a free slot was found (the table is too full).
+	 * Each move locks the two buckets involved and validates the path, so moves are
+	 * always safe, and an invalidated path just leads to a retry.
+	 */
+	bool make_room(Table* t, size_t b1, size_t b2) {
+		PathEntry queue[max_search];
+		return make_room(t, b1, b2, queue, max_search);
+	}
+
+	/*
+	 * Breadth-first search visiting at most max_length buckets
+	 */
+	bool make_room(Table* t, size_t b1, size_t b2, PathEntry* queue, size_t max_length) {
+		size_t length = 0;
+		queue[length++] = {b1, -1, -1};
+		if(b2 != b1) {
+			queue[length++] = {b2, -1, -1};
+		}
+
+		for(size_t head = 0; head < length; ++head) {
+			Bucket& b = t->buckets[queue[head].bucket];
+			if(find_slot(b, 0) != -1) {
+				return execute_path(t, queue, head);
+			}
+			for(int s = 0; s < 4 && length < max_length; ++s) {
+				uint8_t tag = get_slot_tag(b, s);
+				if(tag == 0) {
+					continue;
+				}
+				size_t alt = alt_bucket(t, queue[head].bucket, tag);
+				if(alt != queue[head].bucket) {
+					queue[length++] = {alt, static_cast<int>(head), s};
+				}
+			}
+		}
+		return false;
+	}
+
+	bool execute_path(Table* t, PathEntry* queue, size_t end) {
+		// Move items starting from the free slot backwards
+		size_t i = end;
+		while(queue[i].parent != -1) {
+			size_t to = queue[i].bucket;
+			size_t from = queue[queue[i].parent].bucket;
+			int s = queue[i].slot;
+			lock_pair(t, from, to);
+			Bucket& src = t->buckets[from];
+			Bucket& dst = t->buckets[to];
+			uint8_t tag = get_slot_tag(src, s);
+			int free_slot = find_slot(dst, 0);
+			bool valid = !src.migrated && !dst.migrated && tag != 0 && free_slot != -1 && alt_bucket(t, from, tag) == to;
+			if(valid) {
+				store(dst, free_slot, tag, src.keys[s], src.values[s]);
+				clear(src, s);
+			}
+			unlock_pair(t, from, to);
+			if(!valid) {
+				// Path became invalid, the caller retries anyway
+				return true;
+			}
+			i = queue[i].parent;
+		}
+		return true;
+	}
+
+	void grow(Table* t) {
+		Table* p = t->prev.load(std::memory_order_acquire);
+		if(p != nullptr) {
+			// Only one migration at a time. Finish it, then retry (maybe there is enough space now)
+			complete_migration(p);
+			return;
+		}
+		Table* n = new Table(t->num_buckets << 1);
+		n->prev.store(t, std::memory_order_relaxed);
+		Table* expected = nullptr;
+		if(t->next.compare_exchange_strong(expected, n, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+			current.store(n, std::memory_order_release);
+		}
+		else {
+			// Someone else was faster
+			delete n;
+		}
+	}
+
+	void help_migrate(Table* p) {
+		size_t start = p->migrate_cursor.fetch_add(migrate_chunk, std::memory_order_relaxed);
+		for(size_t i = start; i < start + migrate_chunk && i < p->num_buckets; ++i) {
+			migrate_bucket(p, i);
+		}
+	}
+
+	void complete_migration(Table* p) {
+		Table* n = p->next.load(std::memory_order_acquire);
+		while(p->migrate_cursor.load(std::memory_order_relaxed) < p->num_buckets) {
+			help_migrate(p);
+		}
+		// Wait for buckets that are still migrated by others
+		Backoff bo;
+		while(n->prev.load(std::memory_order_acquire) != nullptr) {
+			bo.backoff();
+		}
+	}
+
+	void migrate_key(Table* p, uint64_t h, uint8_t tag) {
+		size_t b1 = h & p->mask;
+		migrate_bucket(p, b1);
+		migrate_bucket(p, alt_bucket(p, b1, tag));
+	}
+
+	void migrate_bucket(Table* p, size_t bucket) {
+		Bucket& b = p->buckets[bucket];
+		lock(b);
+		if(b.migrated) {
+			unlock(b);
+			return;
+		}
+		Table* n = p->next.load(std::memory_order_acquire);
+		for(int s = 0; s < 4; ++s) {
+			uint8_t tag = get_slot_tag(b, s);
+			if(tag != 0) {
+				uint64_t h = hash(b.keys[s]);
+				pheet_assert(get_tag(h) == tag);
+				insert_migrated(n, h, tag, b.keys[s], b.values[s]);
+				clear(b, s);
+			}
+		}
+		b.migrated = true;
+		unlock(b);
+
+		if(p->num_migrated.fetch_add(1, std::memory_order_acq_rel) + 1 == p->num_buckets) {
+			// Migration complete
+			n->prev.store(nullptr, std::memory_order_release);
+		}
+	}
+
+	/*
+	 * Inserts an item that is known not to be in the table. No new table can be
+	 * appended while we are migrating, so this has to succeed.
+	 *
+	 * The new table is at most about half full: it has twice the slots of the old one,
+	 * and every write to it helps migrating migrate_chunk buckets. So if the short search
+	 * fails, longer searches find a free slot. If even a search over all slots fails
+	 * (only possible if the path was invalidated, or all buckets reachable from the key
+	 * are full), back off and retry, as concurrent writers change the table.
+	 */
+	void insert_migrated(Table* n, uint64_t h, uint8_t tag, Key const& key, TT const& value) {
+		size_t search = max_search;
+		std::vector<PathEntry> queue;
+		Backoff bo;
+		while(true) {
+			size_t b1 = h & n->mask;
+			size_t b2 = alt_bucket(n, b1, tag);
+			lock_pair(n, b1, b2);
+			pheet_assert(!n->buckets[b1].migrated && !n->buckets[b2].migrated);
+			int s;
+			bool done = true;
+			if((s = find_slot(n->buckets[b1], 0)) != -1) {
+				store(n->buckets[b1], s, tag, key, value);
+			}
+			else if((s = find_slot(n->buckets[b2], 0)) != -1) {
+				store(n->buckets[b2], s, tag, key, value);
+			}
+			else {
+				done = false;
+			}
+			unlock_pair(n, b1, b2);
+			if(done) {
+				return;
+			}
+			if(search == max_search) {
+				if(make_room(n, b1, b2)) {
+					continue;
+				}
+			}
+			else {
+				queue.resize(search);
+				if(make_room(n, b1, b2, queue.data(), search)) {
+					continue;
+				}
+			}
+			if(search < (n->num_buckets << 2)) {
+				search <<= 2;
+			}
+			else {
+				bo.backoff();
+			}
+		}
+	}
+
+	Table* first;
+	std::atomic<Table*> current;
+};
+
+template <class Pheet, typename Key, typename TT>
+using ConcurrentCuckooHashMap = ConcurrentCuckooHashMapImpl<Pheet, Key, TT, std::hash<Key>, 64>;
+
+} /* namespace pheet */
+#endif /* CONCURRENTCUCKOOHASHMAP_H_ */
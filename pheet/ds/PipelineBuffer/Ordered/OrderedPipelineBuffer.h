@@ -9,175 +9,423 @@
 #ifndef ORDEREDPIPELINEBUFFER_H_
 #define ORDEREDPIPELINEBUFFER_H_
 
+#include "../../../settings.h"
 #include "OrderedPipelineBufferProcessTask.h"
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <limits>
+
 namespace pheet {
 
-template <class Payload, class Granularity>
-struct OrderedPipelineBufferElement {
-	typedef OrderedPipelineBufferElement<Payload, Granularity> Self;
+enum class PipelineStageMode {
+	// Blocks are processed concurrently, each block by its own task
+	parallel,
+	// One element at a time, in order of element ids
+	serial_in_order,
+	// One block at a time, in the order blocks were completed
+	serial_out_of_order
+};
 
-	OrderedPipelineBufferElement()
-	: next(nullptr) {
+/*
+ * Place-local, set while a task of the place waits for room in the window of any buffer
+ */
+struct OrderedPipelineBufferWaitState {
+	OrderedPipelineBufferWaitState()
+	: waiting(false) {}
 
-	}
+	bool waiting;
+};
+
+template <typename Payload, size_t Granularity>
+struct OrderedPipelineBufferBlock {
+	OrderedPipelineBufferBlock(size_t first_id)
+	: first_id(first_id), count(Granularity), filled(0), ready(false), processed(false) {}
 
 	Payload data[Granularity];
-	Self* next;
-	size_t offset;
-	size_t block_counter;
+	size_t first_id;
+	// Only smaller than Granularity for the last block of a stream (see close)
+	size_t count;
+	std::atomic<size_t> filled;
+	std::atomic<bool> ready;
+	// Protected by the buffer mutex
+	bool processed;
 };
 
-template <class Pheet, class NextStage, class Payload, size_t Granularity>
-class OrderedPipelineBuffer {
+/*
+ * Buffer in front of a pipeline stage. Elements are identified by consecutive ids starting
+ * at 0, and are collected into blocks of Granularity consecutive ids. As soon as a block is
+ * complete, it is handed to the stage as a pheet task:
+ * - parallel stages spawn one task per block
+ * - serial stages have at most one task draining the buffer at any time. In-order stages
+ *   process blocks strictly in order of ids (waiting for missing elements), out-of-order
+ *   stages in the order blocks were completed.
+ *
+ * The stage is called as stage(element_id, payload) for each element and usually puts its
+ * result into the buffer of the next stage under the same id, so the output of an in-order
+ * stage is ordered no matter how many parallel stages are in front of it. Each id has to be
+ * put exactly once. When the number of elements is known, close(n) has to be called to
+ * flush the last (partial) block. All tasks are spawned by put/close, so the pipeline is
+ * complete once the surrounding finish region ends.
+ *
+ * Backpressure: at most Capacity completed blocks are in flight. Beyond that, whoever
+ * completes a block processes it directly instead of spawning a task (parallel) or tries to
+ * drain the stage itself (serial), which slows down producers to the pace of the stage.
+ *
+ * In addition, blocks are only kept for WindowCapacity block ids starting at the oldest
+ * unprocessed block, so a stalled block does not let the buffer grow without limit.
+ * Producers that are further ahead wait for the window to advance. While waiting, they
+ * execute the tasks in the queue of their place (which might produce the missing elements)
+ * and drain serial stages, and only back off once there is nothing left to do. The window
+ * is allowed to grow if all places are waiting for this buffer (always the case with a
+ * single place), or if it did not advance for a while, so a producer that depends on
+ * itself for the missing elements (e.g. a loop putting ids in reverse order) is slowed
+ * down, but does not deadlock. Tasks executed while waiting only wait briefly themselves,
+ * as the task below them on the same place could be the one they depend on. close does
+ * not wait.
+ *
+ * Payload needs to be default constructible and copy-assignable.
+ */
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+class OrderedPipelineBufferImpl {
 	static_assert(Granularity > 0, "Only granularities > 0 are allowed for pipeline buffers");
+	static_assert(WindowCapacity > 0, "Window needs to hold at least one block");
 public:
-	typedef OrderedPipelineBufferElement<Payload, Granularity> Element;
-
-	OrderedPipelineBuffer();
-	~OrderedPipelineBuffer();
+	typedef OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity> Self;
+	typedef OrderedPipelineBufferBlock<Payload, Granularity> Block;
+	typedef OrderedPipelineBufferProcessTask<Pheet, Self> ProcessTask;
+	typedef typename Pheet::Mutex Mutex;
+	typedef typename Pheet::LockGuard LockGuard;
+	typedef typename Pheet::Backoff Backoff;
+
+	template <PipelineStageMode NewMode>
+	using WithMode = OrderedPipelineBufferImpl<Pheet, Stage, Payload, NewMode, Granularity, Capacity, WindowCapacity>;
+
+	template <size_t NewGranularity>
+	using WithGranularity = OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, NewGranularity, Capacity, WindowCapacity>;
+
+	template <size_t NewCapacity>
+	using WithCapacity = OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, NewCapacity, WindowCapacity>;
+
+	template <size_t NewWindowCapacity>
+	using WithWindowCapacity = OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, NewWindowCapacity>;
+
+	OrderedPipelineBufferImpl(Stage& stage);
+	~OrderedPipelineBufferImpl();
+
+	void put(size_t element_id, Payload const& data);
+	void close(size_t num_elements);
+
+	static void print_name() {
+		std::cout << "OrderedPipelineBuffer<";
+		switch(Mode) {
+		case PipelineStageMode::parallel:
+			std::cout << "parallel";
+			break;
+		case PipelineStageMode::serial_in_order:
+			std::cout << "serial_in_order";
+			break;
+		case PipelineStageMode::serial_out_of_order:
+			std::cout << "serial_out_of_order";
+			break;
+		}
+		std::cout << ", " << Granularity << ", " << Capacity << ", " << WindowCapacity << ">";
+	}
 
-	void put(size_t element_id, Payload& data);
-	template <class Payloads...>
-	void put(size_t element_id, Payload& data, Payloads& ... rest);
+	// Called by ProcessTask
+	void process(Block* block);
+	void drain();
 
-	bool prepare_next();
-	void execute_next();
 private:
-	Element* fill_head;
-	Element* process_head;
+	Block* get_block(size_t block_id);
+	Block* find_ready(size_t block_id);
+	void fill(Block* block, size_t num);
+	Block* create_blocks(size_t block_id);
+	void complete(Block* block);
+	bool try_acquire();
+	Block* next_ready();
+	bool has_ready();
+
+	Stage& stage;
+
+	Mutex m;
+	// Blocks that have not been processed yet (and processed blocks behind the oldest unprocessed one).
+	// Only exceeds WindowCapacity blocks if waiting for room stalls (see get_block)
+	std::deque<Block*> window;
+	size_t window_begin;
+	// Partial last block set by close, applied once the block is created
+	size_t partial_block;
+	size_t partial_count;
+	// Completed blocks for serial_out_of_order stages
+	std::deque<Block*> ready_blocks;
+
+	// Only modified by the place holding the stage token
+	std::atomic<size_t> next_block;
+
+	std::atomic<size_t> in_flight;
+	// Stage token of serial stages
+	std::atomic<bool> active;
+
+	// Places that ran out of work while waiting for room in the window
+	std::atomic<procs_t> waiting_places;
+
+	// Number of backoffs without the window advancing before it is allowed to grow
+	static const size_t max_stalled_backoffs = 1000;
+	// Same for tasks executed while another task of the place is waiting
+	static const size_t max_nested_stalled_backoffs = 4;
 };
 
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::OrderedPipelineBufferImpl(Stage& stage)
+: stage(stage), window_begin(0), partial_block(std::numeric_limits<size_t>::max()), partial_count(0),
+  next_block(0), in_flight(0), active(false), waiting_places(0) {
 
-template <class Pheet, class NextStage, class Payload, size_t Granularity>
-OrderedPipelineBuffer<Pheet, NextStage, Payload, Granularity>::OrderedPipelineBuffer()
-: head(new Element()) {
-	buffer->offset = 0;
 }
 
-template <class Pheet, class NextStage, class Payload, size_t Granularity>
-OrderedPipelineBuffer<Pheet, NextStage, Payload, Granularity>::~OrderedPipelineBuffer() {
-//	pheet_assert(buffer == nullptr);
-	Element* tmp = buffer;
-	while(tmp != nullptr) {
-		Element* tmp2 = tmp->next;
-		delete tmp;
-		tmp = tmp2;
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::~OrderedPipelineBufferImpl() {
+	pheet_assert(in_flight.load(std::memory_order_relaxed) == 0);
+	for(auto i = window.begin(); i != window.end(); ++i) {
+		delete *i;
 	}
 }
 
-template <class Pheet, class NextStage, class Payload, size_t Granularity>
-bool OrderedPipelineBuffer<Pheet, NextStage, Payload, Granularity>::prepare_next() {
-	assert(process_head != nullptr);
-
-	Element* dummy = (Element*)this;
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::put(size_t element_id, Payload const& data) {
+	Block* block = get_block(element_id / Granularity);
+	block->data[element_id - block->first_id] = data;
+	fill(block, 1);
+}
 
-	while(fill_head->block_counter == Granularity) {
-		if(fill_head->next == nullptr) {
-			create_next(fill_head);
+/*
+ * Marks the end of the stream. Elements with ids < num_elements may still be put afterwards
+ */
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::close(size_t num_elements) {
+	size_t count = num_elements % Granularity;
+	if(count == 0) {
+		// No partial block
+		return;
+	}
+	size_t block_id = num_elements / Granularity;
+	Block* block;
+	{
+		LockGuard g(m);
+		if(block_id >= window_begin + window.size()) {
+			// Does not wait for room in the window, the block is set up once it is created
+			partial_block = block_id;
+			partial_count = count;
+			return;
 		}
-
-		fill_head = fill_head->next;
+		block = window[block_id - window_begin];
 	}
-	while(fill_head->next != nullptr) {
+	block->count = count;
+	// The missing elements are counted as filled, so the block completes once the others are put
+	fill(block, Granularity - count);
+}
 
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::process(Block* block) {
+	for(size_t i = 0; i < block->count; ++i) {
+		stage(block->first_id + i, block->data[i]);
 	}
+	in_flight.fetch_sub(1, std::memory_order_relaxed);
+
+	LockGuard g(m);
+	block->processed = true;
+	while(!window.empty() && window.front()->processed) {
+		delete window.front();
+		window.pop_front();
+		++window_begin;
+	}
+}
+
+/*
+ * Processes ready blocks until there are none left. Caller needs to hold the stage token
+ */
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::drain() {
+	do {
+		Block* block;
+		while((block = next_ready()) != nullptr) {
+			process(block);
+		}
+		active.store(false, std::memory_order_seq_cst);
+		// A block might have become ready after we checked, but before we released the token
+	} while(has_ready() && try_acquire());
 }
 
-template <class Pheet, class NextStage, class Payload, size_t Granularity>
-void OrderedPipelineBuffer<Pheet, NextStage, Payload, Granularity>::put(size_t element_id, Payload& data) {
-	Element* buf = buffer;
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+typename OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::Block*
+OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::get_block(size_t block_id) {
+	OrderedPipelineBufferWaitState& state = Pheet::template place_singleton<OrderedPipelineBufferWaitState>();
+	size_t max_stalled = state.waiting?max_nested_stalled_backoffs:max_stalled_backoffs;
+	bool nested = state.waiting;
+	bool waiting = false;
+	size_t stalled = 0;
+	size_t last_begin = 0;
+	Backoff bo;
+	while(true) {
+		{
+			LockGuard g(m);
+			pheet_assert(block_id >= window_begin);
+			// Blocks that already exist can always be used
+			if(block_id < window_begin + std::max(window.size(), WindowCapacity) ||
+					(waiting && (stalled >= max_stalled ||
+					waiting_places.load(std::memory_order_relaxed) >= Pheet::get_num_places()))) {
+				if(waiting) {
+					waiting_places.fetch_sub(1, std::memory_order_relaxed);
+				}
+				state.waiting = nested;
+				return create_blocks(block_id);
+			}
+			if(window_begin != last_begin) {
+				last_begin = window_begin;
+				stalled = 0;
+			}
+		}
+		state.waiting = true;
 
-	while(buf != nullptr && buf->block_counter == Granularity) {
-		// block is finished
-		// Make sure we are the only ones manipulating the block (and make sure
+		// Keep the place busy while waiting for the window to advance
+		bool executed = Pheet::get_place()->execute_local_task();
+		if(!executed && Mode != PipelineStageMode::parallel && has_ready() && try_acquire()) {
+			drain();
+			executed = true;
+		}
+		if(executed) {
+			if(waiting) {
+				waiting = false;
+				waiting_places.fetch_sub(1, std::memory_order_relaxed);
+			}
+			stalled = 0;
+			bo.reset();
+		}
+		else if(!waiting) {
+			waiting = true;
+			waiting_places.fetch_add(1, std::memory_order_relaxed);
+			// We might be the last place, check again before backing off
+		}
+		else {
+			++stalled;
+			bo.backoff();
+		}
 	}
+}
 
-	while(!(buf->offset <= element_id && (buf->offset + Granularity) > element_id)) {
-		if(buf->block_counter)
-		buf = buf->next;
+/*
+ * Returns the block, creating all missing blocks up to it. Caller needs to hold the lock
+ */
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+typename OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::Block*
+OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::create_blocks(size_t block_id) {
+	while(window_begin + window.size() <= block_id) {
+		Block* block = new Block((window_begin + window.size()) * Granularity);
+		if(window_begin + window.size() == partial_block) {
+			block->count = partial_count;
+			block->filled.store(Granularity - partial_count, std::memory_order_relaxed);
+		}
+		window.push_back(block);
 	}
+	return window[block_id - window_begin];
+}
 
+/*
+ * Returns the block if it exists and is ready. Checked under the lock, as the block might
+ * get processed (and deleted) concurrently if the caller does not hold the stage token
+ */
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+typename OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::Block*
+OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::find_ready(size_t block_id) {
+	LockGuard g(m);
+	if(block_id < window_begin || block_id >= window_begin + window.size()) {
+		return nullptr;
+	}
+	Block* ret = window[block_id - window_begin];
+	return ret->ready.load(std::memory_order_seq_cst)?ret:nullptr;
+}
 
-	if(Granularity == 1) {
-		Pheet::template
-			spawn<NextStage>(data);
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::fill(Block* block, size_t num) {
+	// acq_rel, so whoever completes the block sees all payloads
+	if(block->filled.fetch_add(num, std::memory_order_acq_rel) + num == Granularity) {
+		complete(block);
 	}
-	Payload* pl = new Payload(data);
+}
 
-	// Random starting point to better handle contention
-	size_t off = SIZET_FETCH_AND_ADD(&index, 1);
-	size_t i = Pheet::template rand_int(Granularity - 2);
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::complete(Block* block) {
+	bool overloaded = in_flight.fetch_add(1, std::memory_order_relaxed) >= Capacity;
 
-	Element* buf = buffer;
-	while((buf->offset + Granularity) <= off) {
-		buf = buf->next;
+	if(Mode == PipelineStageMode::parallel) {
+		if(overloaded) {
+			process(block);
+		}
+		else {
+			Pheet::template
+				spawn<ProcessTask>(*this, block);
+		}
+		return;
 	}
 
-	bool done = false;
-	size_t i = 0;
-	do {
-		if(buf->data[i] == nullptr) {
-			if(PTR_CAS(&(buf->data[i]), nullptr, pl)) {
-				done = true;
-				break;
-			}
-		}
+	if(Mode == PipelineStageMode::serial_out_of_order) {
+		LockGuard g(m);
+		ready_blocks.push_back(block);
+	}
+	else {
+		block->ready.store(true, std::memory_order_seq_cst);
+	}
 
-		i = (i + 1) % (Granularity - 1);
-	} while(i != start);
-
-	if(!done) {
-		if(buffer->next != nullptr) {
-			if(buffer == buf) {
-				// We need
-				do {
-					if(buf->data[i] == nullptr) {
-						if(PTR_CAS(&(buf->data[i]), nullptr, pl)) {
-							done = true;
-							break;
-						}
-					}
-
-					i = (i + 1) % (Granularity - 1);
-				} while(i != start);
-			}
+	if(try_acquire()) {
+		if(overloaded) {
+			drain();
 		}
 		else {
-			if(buffer == buf) {
-				Element* next = new Element();
-
-				if(PTR_CAS(&buffer, buf, next)) {
-					// success
-					process_buffer_element(data, buf);
-				}
-				else {
-					// some other thread was faster
-					delete next;
-					// retry
-					put(element_id, data);
-				}
-			}
-			else {
-				// retry
-				put(element_id, data);
-			}
+			Pheet::template
+				spawn<ProcessTask>(*this, nullptr);
 		}
+	}
+}
 
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+bool OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::try_acquire() {
+	return !active.load(std::memory_order_seq_cst) && !active.exchange(true, std::memory_order_seq_cst);
+}
 
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+typename OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::Block*
+OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::next_ready() {
+	if(Mode == PipelineStageMode::serial_out_of_order) {
+		LockGuard g(m);
+		if(ready_blocks.empty()) {
+			return nullptr;
+		}
+		Block* ret = ready_blocks.front();
+		ready_blocks.pop_front();
+		return ret;
 	}
 
-
+	size_t id = next_block.load(std::memory_order_relaxed);
+	Block* ret = find_ready(id);
+	if(ret != nullptr) {
+		next_block.store(id + 1, std::memory_order_relaxed);
+	}
+	return ret;
 }
 
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+bool OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, Granularity, Capacity, WindowCapacity>::has_ready() {
+	if(Mode == PipelineStageMode::serial_out_of_order) {
+		LockGuard g(m);
+		return !ready_blocks.empty();
+	}
 
-template <class Pheet, class NextStage, class Payload, size_t Granularity>
-template <class Payloads...>
-void OrderedPipelineBuffer<Pheet, NextStage, Payload, Granularity>::put(size_t element_id, Payload& data, Payloads& ... rest) {
-	put(element_id, data);
-	put(element_id + 1, std::forward<Payloads&>(rest) ...);
+	return find_ready(next_block.load(std::memory_order_relaxed)) != nullptr;
 }
 
+template <class Pheet, class Stage, typename Payload, PipelineStageMode Mode = PipelineStageMode::serial_in_order>
+using OrderedPipelineBuffer = OrderedPipelineBufferImpl<Pheet, Stage, Payload, Mode, 64, 16, 256>;
 
 }
 
@@ -11,21 +11,28 @@
 
 namespace pheet {
 
+/*
+ * Processes a single block (parallel stages) or drains the buffer (serial stages, block
+ * is nullptr and the task owns the stage token)
+ */
 template <class Pheet, class Buffer>
 class OrderedPipelineBufferProcessTask : public Pheet::Task {
 public:
-	OrderedPipelineBufferProcessTask(Buffer& buffer);
+	typedef typename Buffer::Block Block;
+
+	OrderedPipelineBufferProcessTask(Buffer& buffer, Block* block);
 	virtual ~OrderedPipelineBufferProcessTask();
 
 	virtual void operator()();
 
 private:
 	Buffer& buffer;
+	Block* block;
 };
 
 template <class Pheet, class Buffer>
-OrderedPipelineBufferProcessTask<Pheet, Buffer>::OrderedPipelineBufferProcessTask(Buffer& buffer)
-:buffer(buffer) {
+OrderedPipelineBufferProcessTask<Pheet, Buffer>::OrderedPipelineBufferProcessTask(Buffer& buffer, Block* block)
+:buffer(buffer), block(block) {
 
 }
 
@@ -36,8 +43,11 @@ OrderedPipelineBufferProcessTask<Pheet, Buffer>::~OrderedPipelineBufferProcessTa
 
 template <class Pheet, class Buffer>
 void OrderedPipelineBufferProcessTask<Pheet, Buffer>::operator()() {
-	while(buffer.prepare_next()) {
-		buffer.execute_next();
+	if(block != nullptr) {
+		buffer.process(block);
+	}
+	else {
+		buffer.drain();
 	}
 }
 
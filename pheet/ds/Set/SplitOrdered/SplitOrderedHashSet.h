@@ -0,0 +1,273 @@
+/*
+ * SplitOrderedHashSet.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SPLITORDEREDHASHSET_H_
+#define SPLITORDEREDHASHSET_H_
+
+#include "../../../settings.h"
+#include "../../../misc/bitops.h"
+
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <stdint.h>
+
+namespace pheet {
+
+template <typename TT>
+struct SplitOrderedHashSetNode {
+	SplitOrderedHashSetNode(uint64_t so_key)
+	: so_key(so_key), present(false), next(nullptr) {}
+	SplitOrderedHashSetNode(uint64_t so_key, TT const& item)
+	: so_key(so_key), item(item), present(true), next(nullptr) {}
+
+	bool is_dummy() const {
+		return (so_key & 1) == 0;
+	}
+
+	uint64_t so_key;
+	TT item;
+	std::atomic<bool> present;
+	std::atomic<SplitOrderedHashSetNode<TT>*> next;
+};
+
+/*
+ * Lock-free hash set based on split-ordered lists (Shalev, Shavit 2006).
+ *
+ * All items are kept in a single linked list sorted by their bit-reversed hash, buckets
+ * are shortcuts into this list (dummy nodes) that are created lazily. Doubling the number
+ * of buckets therefore never moves any items.
+ *
+ * Nodes are never unlinked: removing an item only clears its present flag, and putting
+ * the item again sets it. This keeps the list insert-only, so neither marked pointers nor
+ * safe memory reclamation are needed, at the cost of keeping one node per distinct item
+ * that has ever been in the set. This suits workloads over a bounded key range (like
+ * set_bench), but not sets with an unbounded stream of distinct items.
+ *
+ * Compare is only used to check items for equality (to be usable in place of the
+ * ordered sets), hashing is done by Hash.
+ */
+template <class Pheet, typename TT, class Compare, class Hash, size_t MaxLoad>
+class SplitOrderedHashSetImpl {
+public:
+	typedef SplitOrderedHashSetImpl<Pheet, TT, Compare, Hash, MaxLoad> Self;
+	typedef SplitOrderedHashSetNode<TT> Node;
+
+	SplitOrderedHashSetImpl()
+	: num_buckets(2), num_nodes(0) {
+		for(size_t i = 0; i < num_segments; ++i) {
+			segments[i].store(nullptr, std::memory_order_relaxed);
+		}
+		Node* head = new Node(0);
+		get_bucket(0).store(head, std::memory_order_relaxed);
+	}
+
+	~SplitOrderedHashSetImpl() {
+		Node* n = get_bucket(0).load(std::memory_order_relaxed);
+		while(n != nullptr) {
+			Node* next = n->next.load(std::memory_order_relaxed);
+			delete n;
+			n = next;
+		}
+		for(size_t i = 0; i < num_segments; ++i) {
+			delete[] segments[i].load(std::memory_order_relaxed);
+		}
+	}
+
+	void put(TT const& item) {
+		uint64_t so_key = regular_key(item);
+		Node* n = find_or_insert(get_bucket_head(so_key), so_key, &item);
+		// A newly created node is already present
+		if(!n->present.load(std::memory_order_relaxed)) {
+			n->present.store(true, std::memory_order_release);
+		}
+	}
+
+	bool contains(TT const& item) {
+		uint64_t so_key = regular_key(item);
+		Node* n = find(get_bucket_head(so_key), so_key, &item);
+		return n != nullptr && n->present.load(std::memory_order_acquire);
+	}
+
+	bool remove(TT const& item) {
+		uint64_t so_key = regular_key(item);
+		Node* n = find(get_bucket_head(so_key), so_key, &item);
+		if(n == nullptr || !n->present.load(std::memory_order_relaxed)) {
+			return false;
+		}
+		return n->present.exchange(false, std::memory_order_acq_rel);
+	}
+
+	/*
+	 * Traverses the whole list. Only exact if there are no concurrent modifications
+	 */
+	size_t get_length() {
+		size_t ret = 0;
+		Node* n = get_bucket(0).load(std::memory_order_acquire);
+		while(n != nullptr) {
+			if(!n->is_dummy() && n->present.load(std::memory_order_relaxed)) {
+				++ret;
+			}
+			n = n->next.load(std::memory_order_acquire);
+		}
+		return ret;
+	}
+
+	size_t size() {
+		return get_length();
+	}
+
+	static void print_name() {
+		std::cout << "SplitOrderedHashSet";
+	}
+
+private:
+	/*
+	 * Bucket b is stored in segment find_last_bit_set(b) - 1 (segment 0 also holds bucket 0),
+	 * so segment i holds 2^i buckets and segments can be allocated on demand.
+	 */
+	static size_t const num_segments = 64;
+	static_assert((num_segments & (num_segments - 1)) == 0, "num_segments needs to be a power of two");
+
+	static uint64_t reverse(uint64_t x) {
+		x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+		x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+		x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+		return __builtin_bswap64(x);
+	}
+
+	static uint64_t regular_key(TT const& item) {
+		uint64_t h = static_cast<uint64_t>(Hash()(item));
+		// Regular nodes have the lowest bit set, so they are sorted after the dummy of their bucket
+		return reverse(h | (1ULL << 63));
+	}
+
+	static uint64_t dummy_key(size_t bucket) {
+		return reverse(bucket);
+	}
+
+	static bool equal(TT const& a, TT const& b) {
+		Compare c;
+		return !c(a, b) && !c(b, a);
+	}
+
+	static bool matches(Node* n, uint64_t so_key, TT const* item) {
+		return n->so_key == so_key && (item == nullptr || equal(n->item, *item));
+	}
+
+	std::atomic<Node*>& get_bucket(size_t bucket) {
+		size_t seg = (bucket < 2)?0:(find_last_bit_set(bucket) - 1);
+		pheet_assert(seg < num_segments);
+		// Never changes seg, but tells the compiler it cannot index past the segment table
+		seg &= num_segments - 1;
+		size_t offset = (bucket < 2)?bucket:(bucket - (static_cast<size_t>(1) << seg));
+		std::atomic<Node*>* s = segments[seg].load(std::memory_order_acquire);
+		if(s == nullptr) {
+			size_t seg_size = (seg == 0)?2:(static_cast<size_t>(1) << seg);
+			std::atomic<Node*>* ns = new std::atomic<Node*>[seg_size];
+			for(size_t i = 0; i < seg_size; ++i) {
+				ns[i].store(nullptr, std::memory_order_relaxed);
+			}
+			if(segments[seg].compare_exchange_strong(s, ns, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				s = ns;
+			}
+			else {
+				delete[] ns;
+			}
+		}
+		return s[offset];
+	}
+
+	Node* get_bucket_head(uint64_t so_key) {
+		size_t bucket = reverse(so_key) & (num_buckets.load(std::memory_order_relaxed) - 1);
+		Node* head = get_bucket(bucket).load(std::memory_order_acquire);
+		if(head == nullptr) {
+			head = initialize_bucket(bucket);
+		}
+		return head;
+	}
+
+	Node* initialize_bucket(size_t bucket) {
+		pheet_assert(bucket != 0);
+		// The parent bucket is the bucket with the most significant bit cleared
+		size_t parent = bucket & ~(static_cast<size_t>(1) << (find_last_bit_set(bucket) - 1));
+		Node* parent_head = get_bucket(parent).load(std::memory_order_acquire);
+		if(parent_head == nullptr) {
+			parent_head = initialize_bucket(parent);
+		}
+		Node* head = find_or_insert(parent_head, dummy_key(bucket), nullptr);
+		Node* expected = nullptr;
+		// Whoever wins stores the same node
+		get_bucket(bucket).compare_exchange_strong(expected, head, std::memory_order_release, std::memory_order_relaxed);
+		return head;
+	}
+
+	/*
+	 * Returns the node for so_key/item (item == nullptr for dummies) or nullptr
+	 */
+	Node* find(Node* start, uint64_t so_key, TT const* item) {
+		Node* cur = start;
+		while(cur != nullptr && cur->so_key <= so_key) {
+			if(matches(cur, so_key, item)) {
+				return cur;
+			}
+			cur = cur->next.load(std::memory_order_acquire);
+		}
+		return nullptr;
+	}
+
+	Node* find_or_insert(Node* start, uint64_t so_key, TT const* item) {
+		Node* node = nullptr;
+		Node* prev = start;
+		while(true) {
+			Node* cur = prev->next.load(std::memory_order_acquire);
+			while(cur != nullptr && cur->so_key <= so_key) {
+				if(matches(cur, so_key, item)) {
+					// Someone else was faster (or the item was already in the list)
+					delete node;
+					return cur;
+				}
+				prev = cur;
+				cur = cur->next.load(std::memory_order_acquire);
+			}
+			if(matches(prev, so_key, item)) {
+				delete node;
+				return prev;
+			}
+			if(node == nullptr) {
+				node = (item == nullptr)?new Node(so_key):new Node(so_key, *item);
+			}
+			node->next.store(cur, std::memory_order_relaxed);
+			if(prev->next.compare_exchange_weak(cur, node, std::memory_order_release, std::memory_order_relaxed)) {
+				if(item != nullptr) {
+					grow(num_nodes.fetch_add(1, std::memory_order_relaxed) + 1);
+				}
+				return node;
+			}
+			// Nodes are never removed, so we can continue from prev
+		}
+	}
+
+	void grow(size_t nodes) {
+		size_t b = num_buckets.load(std::memory_order_relaxed);
+		if(nodes > b * MaxLoad && b < (static_cast<size_t>(1) << (num_segments - 1))) {
+			num_buckets.compare_exchange_strong(b, b << 1, std::memory_order_relaxed, std::memory_order_relaxed);
+		}
+	}
+
+	std::atomic<std::atomic<Node*>*> segments[num_segments];
+	std::atomic<size_t> num_buckets;
+	// Only incremented when a new item is linked in, which is rare once the set is warmed up
+	std::atomic<size_t> num_nodes;
+};
+
+template <class Pheet, typename TT, class Compare = std::less<TT>>
+using SplitOrderedHashSet = SplitOrderedHashSetImpl<Pheet, TT, Compare, std::hash<TT>, 2>;
+
+} /* namespace pheet */
+#endif /* SPLITORDEREDHASHSET_H_ */
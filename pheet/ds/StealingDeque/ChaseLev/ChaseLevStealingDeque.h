@@ -0,0 +1,314 @@
+/*
+ * ChaseLevStealingDeque.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef CHASELEVSTEALINGDEQUE_H_
+#define CHASELEVSTEALINGDEQUE_H_
+
+#include "../../../settings.h"
+#include "../../../misc/type_traits.h"
+#include "ChaseLevStealingDequePerformanceCounters.h"
+
+#include <limits>
+#include <iostream>
+#include <atomic>
+
+namespace pheet {
+
+/*
+ * Chase-Lev work-stealing deque using the C++11 memory model as described in
+ * Le, Pop, Cohen, Zappa Nardelli: "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013)
+ *
+ * Instead of full memory barriers on every operation, push only needs a release fence,
+ * and the only sequentially consistent fence on the owner side is in pop, between
+ * announcing the new bottom and reading top. Steal uses acquire loads, a seq_cst fence and
+ * the seq_cst CAS on top.
+ *
+ * As with CircularArrayStealingDeque, the upper bits of top are used as a stamp which is
+ * incremented whenever the array grows, so thieves that read from the old layout fail
+ * their CAS.
+ */
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+class ChaseLevStealingDequeImpl {
+public:
+	typedef TT T;
+	typedef ChaseLevStealingDequePerformanceCounters<Pheet> PerformanceCounters;
+
+	template<template <class P, typename S> class NewCA>
+		using WithCircularArray = ChaseLevStealingDequeImpl<Pheet, TT, NewCA>;
+
+	template <class P, class TTT>
+	using BT = ChaseLevStealingDequeImpl<P, TTT, CircularArray>;
+
+	ChaseLevStealingDequeImpl();
+	ChaseLevStealingDequeImpl(PerformanceCounters& pc);
+	ChaseLevStealingDequeImpl(size_t initial_capacity);
+	ChaseLevStealingDequeImpl(size_t initial_capacity, PerformanceCounters& pc);
+	~ChaseLevStealingDequeImpl();
+
+	void push(T item);
+	T pop();
+	T peek();
+	T steal();
+	T steal(PerformanceCounters& pc);
+
+	T steal_push(ChaseLevStealingDequeImpl<Pheet, TT, CircularArray> &other);
+
+	size_t get_length() const;
+	bool is_empty() const;
+	bool is_full() const;
+
+	static void print_name();
+
+private:
+	void check_occupancy(size_t b, size_t length);
+	void shrink(size_t b);
+
+	std::atomic<size_t> top;
+	std::atomic<size_t> bottom;
+
+	static const size_t top_mask;
+	static const size_t top_stamp_add;
+
+	static const T null_element;
+
+	CircularArray<Pheet, T> data;
+
+	// Number of consecutive pops that found the array mostly empty
+	size_t low_occupancy_pops;
+
+	PerformanceCounters pc;
+};
+
+// Upper 4th of size_t is reserved for stamp. The rest is for the actual content
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+const size_t ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::top_mask =
+		(std::numeric_limits<size_t>::max() >> (std::numeric_limits<size_t>::digits >> 2));
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+const size_t ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::top_stamp_add =
+		(((size_t)1) << (std::numeric_limits<size_t>::digits - (std::numeric_limits<size_t>::digits >> 2)));
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+const TT ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::null_element = nullable_traits<T>::null_value;
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::ChaseLevStealingDequeImpl()
+: top(0), bottom(0), data(), low_occupancy_pops(0) {
+
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::ChaseLevStealingDequeImpl(PerformanceCounters& pc)
+: top(0), bottom(0), data(), low_occupancy_pops(0), pc(pc) {
+
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::ChaseLevStealingDequeImpl(size_t initial_capacity)
+: top(0), bottom(0), data(initial_capacity), low_occupancy_pops(0) {
+
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::ChaseLevStealingDequeImpl(size_t initial_capacity, PerformanceCounters& pc)
+: top(0), bottom(0), data(initial_capacity), low_occupancy_pops(0), pc(pc) {
+
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::~ChaseLevStealingDequeImpl() {
+
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+void ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::push(T item) {
+	size_t b = bottom.load(std::memory_order_relaxed);
+	size_t t = top.load(std::memory_order_acquire);
+	pheet_assert(b >= (t & top_mask));
+	if((b - (t & top_mask)) >= data.get_capacity())
+	{
+		data.grow(b, t & top_mask);
+
+		// Thieves that read indices before the resize must not succeed.
+		// We don't care whether we succeed, as long as the stamp changes
+		top.compare_exchange_strong(t, t + top_stamp_add, std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+
+	data.put(b, item);
+
+	// Item has to be visible before the new bottom
+	std::atomic_thread_fence(std::memory_order_release);
+	bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+TT ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::pop() {
+	size_t b = bottom.load(std::memory_order_relaxed);
+	// Only thieves modify top, and they only ever increase it, so we can check for emptiness early
+	size_t length = b - (top.load(std::memory_order_relaxed) & top_mask);
+	check_occupancy(b, length);
+	if(length == 0)
+		return null_element;
+
+	--b;
+	bottom.store(b, std::memory_order_relaxed);
+
+	// The only full fence on the owner side: thieves need to see the new bottom before we read top
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	size_t t = top.load(std::memory_order_relaxed);
+	size_t masked_top = t & top_mask;
+	if(b > masked_top) {
+		// More than one item left, no conflict possible
+		return data.get(b);
+	}
+	if(b == masked_top) {
+		// Last item. Race against thieves by incrementing the stamp
+		T ret = data.get(b);
+		pc.num_pop_cas.incr();
+		if(top.compare_exchange_strong(t, t + top_stamp_add, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return ret;
+		}
+		// A thief was faster - the deque is now empty
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return null_element;
+	}
+
+	// A thief took the last item in the meantime
+	pheet_assert(b + 1 == masked_top);
+	bottom.store(masked_top, std::memory_order_relaxed);
+	return null_element;
+}
+
+/*
+ * Shrinks the array once less than an eighth of it has been used for as many consecutive
+ * pops as the array has slots, which amortizes the copying costs.
+ */
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+inline void ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::check_occupancy(size_t b, size_t length) {
+	if(data.is_shrinkable() && (length << 3) < data.get_capacity()) {
+		if(++low_occupancy_pops >= data.get_capacity()) {
+			shrink(b);
+		}
+	}
+	else {
+		low_occupancy_pops = 0;
+	}
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+void ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::shrink(size_t b) {
+	low_occupancy_pops = 0;
+
+	size_t t = top.load(std::memory_order_relaxed);
+	data.shrink(b, t & top_mask);
+
+	// The memory may only be released after all thieves that read the old layout
+	// are guaranteed to fail, so our increment of the stamp needs to succeed
+	while(!top.compare_exchange_weak(t, t + top_stamp_add, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+	data.reclaim();
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+TT ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::peek() {
+	size_t b = bottom.load(std::memory_order_relaxed);
+	if(b == (top.load(std::memory_order_relaxed) & top_mask))
+		return null_element;
+
+	return data.get(b - 1);
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+inline TT ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::steal() {
+	PerformanceCounters pc;
+	return steal(pc);
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+TT ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::steal(PerformanceCounters& pc) {
+	size_t t = top.load(std::memory_order_acquire);
+	// Pairs with the fence in pop
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	size_t b = bottom.load(std::memory_order_acquire);
+
+	size_t masked_top = t & top_mask;
+	if(b <= masked_top) {
+		return null_element;
+	}
+
+	T ret = data.get(masked_top);
+
+	// The stamp is incremented as well, so a concurrent resize can rely on the stamp having
+	// changed even if its own CAS fails
+	if(top.compare_exchange_strong(t, t + 1 + top_stamp_add, std::memory_order_seq_cst, std::memory_order_relaxed))
+	{
+		pc.num_stolen.incr();
+		return ret;
+	}
+
+	// if we encounter a race, just return NULL
+	// This might even happen on well-filled queues
+	return null_element;
+}
+
+/*
+ * Steals up to half of the items, pushes all but the last one to the other deque,
+ * and returns the last one (or null_element if nothing could be stolen)
+ */
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+TT ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::steal_push(ChaseLevStealingDequeImpl<Pheet, TT, CircularArray> &other) {
+	T prev = steal(other.pc);
+	if(prev == null_element) {
+		return prev;
+	}
+	size_t max_steal = get_length() >> 1;
+
+	for(size_t i = 0; i < max_steal; i++) {
+		T curr = steal(other.pc);
+		if(curr == null_element) {
+			break;
+		}
+		other.push(prev);
+		prev = curr;
+	}
+	return prev;
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+size_t ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::get_length() const {
+	size_t b = bottom.load(std::memory_order_relaxed);
+	size_t t = top.load(std::memory_order_relaxed) & top_mask;
+	// Concurrent pops may temporarily make bottom smaller than top
+	return (b > t)?(b - t):0;
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+bool ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::is_empty() const {
+	return get_length() == 0;
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+bool ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::is_full() const {
+	return (!data.is_growable()) && (get_length() >= data.get_capacity());
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+void ChaseLevStealingDequeImpl<Pheet, TT, CircularArray>::print_name() {
+	std::cout << "ChaseLevStealingDeque";
+}
+
+template<class Pheet, typename T>
+using ChaseLevStealingDequeDefaultCircularArray = typename Pheet::CDS::template CircularArray<T>;
+
+template<class Pheet, typename T>
+using ChaseLevStealingDeque = ChaseLevStealingDequeImpl<Pheet, T, ChaseLevStealingDequeDefaultCircularArray>;
+
+}
+
+#endif /* CHASELEVSTEALINGDEQUE_H_ */
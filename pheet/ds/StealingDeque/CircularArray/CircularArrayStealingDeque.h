@@ -15,6 +15,7 @@
 #include "CircularArrayStealingDequePerformanceCounters.h"
 
 #include <limits>
+#include <algorithm>
 #include <iostream>
 
 namespace pheet {
@@ -49,10 +50,26 @@ public:
 	bool is_empty() const;
 	bool is_full() const;
 
+	static void print_name();
+
 private:
+	void update_max_bottom();
+	void check_occupancy(size_t length);
+	void shrink();
+
 	size_t top;
 	size_t bottom;
 
+	// Owner-local bookkeeping needed to allow thieves to claim multiple items with one CAS.
+	// max_bottom is an upper bound for any bottom a thief might have seen while top had the
+	// value owner_top. window_max_bottom is the maximum bottom since top was last read in pop.
+	size_t owner_top;
+	size_t max_bottom;
+	size_t window_max_bottom;
+
+	// Number of consecutive pops that found the array mostly empty
+	size_t low_occupancy_pops;
+
 	static const size_t top_mask;
 	static const size_t top_stamp_mask;
 	static const size_t top_stamp_add;
@@ -82,25 +99,25 @@ const TT CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::null_element
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::CircularArrayStealingDequeImpl()
-: top(0), bottom(0), data() {
+: top(0), bottom(0), owner_top(0), max_bottom(0), window_max_bottom(0), low_occupancy_pops(0), data() {
 
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::CircularArrayStealingDequeImpl(PerformanceCounters& pc)
-: top(0), bottom(0), data(), pc(pc) {
+: top(0), bottom(0), owner_top(0), max_bottom(0), window_max_bottom(0), low_occupancy_pops(0), data(), pc(pc) {
 
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::CircularArrayStealingDequeImpl(size_t initial_capacity)
-: top(0), bottom(0), data(initial_capacity) {
+: top(0), bottom(0), owner_top(0), max_bottom(0), window_max_bottom(0), low_occupancy_pops(0), data(initial_capacity) {
 
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::CircularArrayStealingDequeImpl(size_t initial_capacity, PerformanceCounters& pc)
-: top(0), bottom(0), data(initial_capacity), pc(pc) {
+: top(0), bottom(0), owner_top(0), max_bottom(0), window_max_bottom(0), low_occupancy_pops(0), data(initial_capacity), pc(pc) {
 
 }
 
@@ -131,11 +148,24 @@ void CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::push(T item) {
 	// Make sure no thread sees new bottom before data has been put
 	MEMORY_FENCE();
 	bottom++;
+	update_max_bottom();
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+inline void CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::update_max_bottom() {
+	if(bottom > window_max_bottom) {
+		window_max_bottom = bottom;
+		if(bottom > max_bottom) {
+			max_bottom = bottom;
+		}
+	}
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 TT CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::pop() {
-	if(bottom == (top & top_mask))
+	size_t length = bottom - (top & top_mask);
+	check_occupancy(length);
+	if(length == 0)
 		return null_element;
 
 	bottom--;
@@ -146,33 +176,80 @@ TT CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::pop() {
 
 	T ret = data.get(bottom);
 
-	size_t old_top = top;
-	size_t masked_top = old_top & top_mask;
-	if(bottom > masked_top)
-	{
-		return ret;
-	}
-	if(bottom == masked_top)
-	{
+	while(true) {
+		size_t old_top = top;
+		size_t masked_top = old_top & top_mask;
+		if(old_top != owner_top) {
+			// Top was changed after our last observation, so thieves that saw the
+			// current value of top cannot have seen a bottom above window_max_bottom
+			owner_top = old_top;
+			max_bottom = window_max_bottom;
+		}
+		window_max_bottom = bottom + 1;
+
+		if(bottom < masked_top) {
+			// Item has been stolen
+			pheet_assert(bottom == masked_top - 1);
+			bottom = masked_top;
+			return null_element;
+		}
+		// Thieves claim at most half (rounded up) of the items they see. If our item is above
+		// the highest index a thief could have claimed, no synchronization is needed
+		if((bottom - masked_top) >= ((max_bottom - masked_top + 1) >> 1))
+		{
+			return ret;
+		}
+
 		// Increment stamp (should wrap around)
 		size_t new_top = old_top + top_stamp_add;
 
 		pc.num_pop_cas.incr();
 		if(SIZET_CAS(&top, old_top, new_top))
 		{
-		//	std::cout << "pop " << bottom << std::endl;
+			// No thief can succeed with the old value of top any more
+			owner_top = new_top;
+			max_bottom = bottom;
+			window_max_bottom = bottom;
 			return ret;
 		}
-		else {
-			// Some other process was faster - the queue is now empty
-			bottom++;
+		// Some thief was faster. Check whether our item was part of the stolen range
+	}
+}
+
+/*
+ * Shrinks the array once less than an eighth of it has been used for as many consecutive
+ * pops as the array has slots, which amortizes the copying costs.
+ */
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+inline void CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::check_occupancy(size_t length) {
+	if(data.is_shrinkable() && (length << 3) < data.get_capacity()) {
+		if(++low_occupancy_pops >= data.get_capacity()) {
+			shrink();
 		}
 	}
 	else {
-		pheet_assert(bottom == masked_top - 1);
-		bottom = masked_top;
+		low_occupancy_pops = 0;
 	}
-	return null_element;
+}
+
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+void CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::shrink() {
+	low_occupancy_pops = 0;
+
+	size_t old_top = top;
+	data.shrink(bottom, old_top & top_mask);
+	MEMORY_FENCE ();
+
+	// Same as for grow, but the memory may only be released after all thieves
+	// that read the old layout are guaranteed to fail, so our increment needs to succeed
+	while(!SIZET_CAS(&top, old_top, old_top + top_stamp_add)) {
+		old_top = top;
+	}
+	owner_top = old_top + top_stamp_add;
+	max_bottom = bottom;
+	window_max_bottom = bottom;
+
+	data.reclaim();
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
@@ -213,27 +290,58 @@ TT CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::steal(PerformanceCo
 	return null_element;
 }
 
+/*
+ * Steals half of the items (rounded up) with a single CAS on top. All stolen items except
+ * the last one are copied to the (owned) deque other, the last one is returned.
+ */
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 TT CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::steal_push(CircularArrayStealingDequeImpl<Pheet, TT, CircularArray> &other) {
-	T prev = null_element;
-	T curr = null_element;
-	size_t max_steal = get_length() / 2;
-
-	for(size_t i = 0; i < max_steal; i++) {
-		curr = steal();
-		if(curr == null_element) {
-			return prev;
-		}
-		else if(prev != null_element) {
-			other.pc.num_stolen.incr();
-			other.push(prev);
-		}
-		else {
-			other.pc.num_stolen.incr();
+	size_t old_top = top;
+	MEMORY_FENCE();
+
+	size_t masked_top = old_top & top_mask;
+	size_t b = bottom;
+	if(b <= masked_top) {
+		return null_element;
+	}
+
+	size_t num = (b - masked_top + 1) >> 1;
+
+	// Make sure the stolen items fit into the local deque
+	size_t other_top = other.top & top_mask;
+	size_t other_length = other.bottom - other_top;
+	while(other_length + num > other.data.get_capacity()) {
+		if(!other.data.is_growable()) {
+			num = std::max<size_t>(other.data.get_capacity() - other_length, 1);
+			break;
 		}
-		prev = curr;
+		other.data.grow(other.bottom, other_top);
+		MEMORY_FENCE();
+		// Invalidate concurrent steals from the local deque that read the old layout
+		size_t o_top = other.top;
+		SIZET_CAS(&(other.top), o_top, o_top + top_stamp_add);
+	}
+
+	// Items have to be copied before claiming them, as the owner may reuse the slots afterwards.
+	// Writes above bottom of other are not visible to anyone until bottom is incremented
+	for(size_t i = 0; i < num - 1; ++i) {
+		other.data.put(other.bottom + i, data.get(masked_top + i));
 	}
-	return prev;
+	T ret = data.get(masked_top + num - 1);
+
+	size_t new_top = old_top + num + top_stamp_add;
+	if(!SIZET_CAS(&top, old_top, new_top)) {
+		// Race with owner or other thief. Give up and let the scheduler try somewhere else
+		return null_element;
+	}
+	other.pc.num_stolen.add(num);
+
+	if(num > 1) {
+		MEMORY_FENCE();
+		other.bottom += num - 1;
+		other.update_max_bottom();
+	}
+	return ret;
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
@@ -251,6 +359,11 @@ bool CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::is_full() const {
 	return (!data.is_growable()) && (get_length() >= data.get_capacity());
 }
 
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+void CircularArrayStealingDequeImpl<Pheet, TT, CircularArray>::print_name() {
+	std::cout << "CircularArrayStealingDeque";
+}
+
 template<class Pheet, typename T>
 using CircularArrayStealingDequeDefaultCircularArray = typename Pheet::CDS::template CircularArray<T>;
 
@@ -11,6 +11,7 @@
 
 #include "../../../settings.h"
 #include "../../../misc/type_traits.h"
+#include "../../../misc/atomics.h"
 #include "CircularArrayStealingDeque11PerformanceCounters.h"
 
 #include <limits>
@@ -49,6 +50,8 @@ public:
 	bool is_empty() const;
 	bool is_full() const;
 
+	static void print_name();
+
 private:
 	std::atomic<size_t> top;
 	std::atomic<size_t> bottom;
@@ -82,25 +85,25 @@ const TT CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::null_elemen
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::CircularArrayStealingDeque11Impl()
-: top(0, memory_order_release), bottom(0, memory_order_release), data() {
+: top(0), bottom(0), data() {
 
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::CircularArrayStealingDeque11Impl(PerformanceCounters& pc)
-: top(0, memory_order_release), bottom(0, memory_order_release), data(), pc(pc) {
+: top(0), bottom(0), data(), pc(pc) {
 
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::CircularArrayStealingDeque11Impl(size_t initial_capacity)
-: top(0, memory_order_release), bottom(0, memory_order_release), data(initial_capacity) {
+: top(0), bottom(0), data(initial_capacity) {
 
 }
 
 template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
 CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::CircularArrayStealingDeque11Impl(size_t initial_capacity, PerformanceCounters& pc)
-: top(0, memory_order_release), bottom(0, memory_order_release), data(initial_capacity), pc(pc) {
+: top(0), bottom(0), data(initial_capacity), pc(pc) {
 
 }
 
@@ -260,6 +263,11 @@ bool CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::is_full() const
 	return (!data.is_growable()) && (get_length() >= data.get_capacity());
 }
 
+template <class Pheet, typename TT, template <class P, typename S> class CircularArray>
+void CircularArrayStealingDeque11Impl<Pheet, TT, CircularArray>::print_name() {
+	std::cout << "CircularArrayStealingDeque11";
+}
+
 template<class Pheet, typename T>
 using CircularArrayStealingDeque11DefaultCircularArray = typename Pheet::CDS::template CircularArray<T>;
 
@@ -39,20 +39,21 @@ public:
 
 	typedef FrameMemoryManagerPlaceSingleton<Pheet> FrameManager;
 	typedef typename FrameManager::Frame Frame;
+	typedef typename Pheet::MemoryArena MemoryArena;
 
 	KLSMLocalityTaskStorageBlock(size_t size, size_t max_level)
 	: frame_man(Pheet::template place_singleton<FrameManager>()),
 	  filled(0), owned_filled(0), size(size), max_level(max_level), level(0), level_boundary(1), next(nullptr),
 	  prev(nullptr), k(std::numeric_limits<size_t>::max()),
 	  in_use(false), global_list_item(nullptr) {
-		data = new std::atomic<Item*>[size];
-		phases = new size_t[size];
-		owned_data = new std::atomic<Item*>[size];
+		data = MemoryArena::template create_array<std::atomic<Item*> >(size);
+		phases = MemoryArena::template create_array<size_t>(size);
+		owned_data = MemoryArena::template create_array<std::atomic<Item*> >(size);
 	}
 	~KLSMLocalityTaskStorageBlock() {
-		delete[] data;
-		delete[] phases;
-		delete[] owned_data;
+		MemoryArena::destroy_array(data, size);
+		MemoryArena::destroy_array(phases, size);
+		MemoryArena::destroy_array(owned_data, size);
 	}
 
 	/*
@@ -37,8 +37,10 @@ public:
 
 	typedef typename BaseItem::T T;
 
-	typedef typename BlockItemReuseMemoryManager<Pheet, Item, KLSMLocalityTaskStorageItemReuseCheck<Item, Frame> >::template WithAmortization<2> ItemMemoryManager;
-	typedef ItemReuseMemoryManager<Pheet, GlobalListItem, KLSMLocalityTaskStorageGlobalListItemReuseCheck<GlobalListItem> > GlobalListItemMemoryManager;
+	// Stealers read items before registering for their frame, and blocks still read global list
+	// items that passed the reuse check, so the pools keep all memory until the end (no MaxPooled)
+	typedef typename BlockItemReuseMemoryManager<Pheet, Item, KLSMLocalityTaskStorageItemReuseCheck<Item, Frame> >::template WithAmortization<2>::template WithTrimming<true> ItemMemoryManager;
+	typedef typename ItemReuseMemoryManager<Pheet, GlobalListItem, KLSMLocalityTaskStorageGlobalListItemReuseCheck<GlobalListItem> >::template WithTrimming<true> GlobalListItemMemoryManager;
 
 	typedef typename ParentTaskStoragePlace::PerformanceCounters PerformanceCounters;
 
@@ -67,7 +69,7 @@ public:
 
 	~KLSMLocalityTaskStoragePlace() {
 		for(auto i = blocks.begin(); i != blocks.end(); ++i) {
-			delete *i;
+			Pheet::MemoryArena::destroy(*i);
 		}
 
 		if(created_task_storage) {
@@ -75,6 +77,8 @@ public:
 		}
 
 		pc.num_allocated_items.add(items.size());
+		pc.teardown_memory_bytes.add(items.memory_bytes() + global_list_items.memory_bytes());
+		pc.max_peak_memory_bytes.add_value(items.peak_memory_bytes() + global_list_items.peak_memory_bytes());
 	}
 
 	GlobalListItem* create_global_list_item() {
@@ -83,7 +87,7 @@ public:
 		return ret;
 	}
 
-	void push(Strategy&& strategy, T data) {
+	Item* push(Strategy&& strategy, T data) {
 		Item& it = items.acquire_item();
 
 		it.strategy = std::move(strategy);
@@ -117,6 +121,26 @@ public:
 		if(remaining_k == 0) {
 			add_to_global_list();
 		}
+		return &it;
+	}
+
+	/*
+	 * Takes an item pushed by this place, if it has not been taken or reused in the meantime
+	 * and the new strategy accepts to replace it (see reprioritize in the scheduler).
+	 * The item stays in the blocks and is cleaned up like any other taken item.
+	 */
+	bool take_local(BaseItem* base_item, size_t version, Strategy& new_strategy, T& data) {
+		Item* item = static_cast<Item*>(base_item);
+		if(item->owner != this || item->version.load(std::memory_order_relaxed) != version ||
+				item->is_taken() || !new_strategy.can_reprioritize(item->strategy)) {
+			return false;
+		}
+		data = item->take();
+		if(data == nullable_traits<T>::null_value) {
+			return false;
+		}
+		tasks.store(tasks.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+		return true;
 	}
 
 	T pop(BaseItem* boundary) {
@@ -1002,7 +1026,7 @@ private:
 				size_t l = blocks.size() >> 2;
 				size_t s = (1 << l);
 				for(int i = 0; i < 4; ++i) {
-					blocks.push_back(new Block(s, l));
+					blocks.push_back(Pheet::MemoryArena::template create<Block>(s, l));
 					pc.num_blocks_created.incr();
 				}
 			}while(offset >= blocks.size());
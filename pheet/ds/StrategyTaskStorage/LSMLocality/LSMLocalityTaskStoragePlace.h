@@ -34,7 +34,8 @@ public:
 
 	typedef typename BaseItem::T T;
 
-	typedef typename BlockItemReuseMemoryManager<Pheet, Item, LSMLocalityTaskStorageItemReuseCheck<Item, Frame> >::template WithAmortization<2> ItemMemoryManager;
+	// Stealers read items before registering for their frame, so the pool keeps all blocks until the end (no MaxPooled)
+	typedef typename BlockItemReuseMemoryManager<Pheet, Item, LSMLocalityTaskStorageItemReuseCheck<Item, Frame> >::template WithAmortization<2>::template WithTrimming<true> ItemMemoryManager;
 
 	typedef typename ParentTaskStoragePlace::PerformanceCounters PerformanceCounters;
 
@@ -70,9 +71,11 @@ public:
 		}
 
 		pc.num_allocated_items.add(items.size());
+		pc.teardown_memory_bytes.add(items.memory_bytes());
+		pc.max_peak_memory_bytes.add_value(items.peak_memory_bytes());
 	}
 
-	void push(Strategy&& strategy, T data) {
+	Item* push(Strategy&& strategy, T data) {
 		Item& it = items.acquire_item();
 
 		it.strategy = std::move(strategy);
@@ -98,6 +101,26 @@ public:
 		put(&it, 0);
 
 		parent_place->push(&it);
+		return &it;
+	}
+
+	/*
+	 * Takes an item pushed by this place, if it has not been taken or reused in the meantime
+	 * and the new strategy accepts to replace it (see reprioritize in the scheduler).
+	 * The item stays in the blocks and is cleaned up like any other taken item.
+	 */
+	bool take_local(BaseItem* base_item, size_t version, Strategy& new_strategy, T& data) {
+		Item* item = static_cast<Item*>(base_item);
+		if(item->owner != this || item->version.load(std::memory_order_relaxed) != version ||
+				item->is_taken() || !new_strategy.can_reprioritize(item->strategy)) {
+			return false;
+		}
+		data = item->take();
+		if(data == nullable_traits<T>::null_value) {
+			return false;
+		}
+		tasks.store(tasks.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+		return true;
 	}
 
 	T pop(BaseItem* boundary) {
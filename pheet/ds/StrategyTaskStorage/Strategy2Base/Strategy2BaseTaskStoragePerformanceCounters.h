@@ -10,6 +10,7 @@
 #define STRATEGY2BASETASKSTORAGEPERFORMANCECOUNTERS_H_
 
 #include <pheet/primitives/PerformanceCounter/Basic/BasicPerformanceCounter.h>
+#include <pheet/primitives/PerformanceCounter/Max/MaxPerformanceCounter.h>
 
 namespace pheet {
 
@@ -26,7 +27,9 @@ public:
 	 num_spied_tasks(other.num_spied_tasks),
 	 num_spied_global_tasks(other.num_spied_global_tasks),
 	 num_merges(other.num_merges),
-	 num_allocated_items(other.num_allocated_items) {}
+	 num_allocated_items(other.num_allocated_items),
+	 teardown_memory_bytes(other.teardown_memory_bytes),
+	 max_peak_memory_bytes(other.max_peak_memory_bytes) {}
 
 	~Strategy2BaseTaskStoragePerformanceCounters() {}
 
@@ -38,6 +41,8 @@ public:
 		BasicPerformanceCounter<Pheet, task_storage_count_spied_global_tasks>::print_header("num_spied_global_tasks\t");
 		BasicPerformanceCounter<Pheet, task_storage_count_merges>::print_header("num_merges\t");
 		BasicPerformanceCounter<Pheet, task_storage_count_allocated_items>::print_header("num_allocated_items\t");
+		BasicPerformanceCounter<Pheet, task_storage_measure_memory>::print_header("teardown_memory_bytes\t");
+		MaxPerformanceCounter<Pheet, size_t, task_storage_measure_memory>::print_header("max_place_peak_memory_bytes\t");
 	}
 
 	inline void print_values() {
@@ -48,6 +53,8 @@ public:
 		num_spied_global_tasks.print("%d\t");
 		num_merges.print("%d\t");
 		num_allocated_items.print("%d\t");
+		teardown_memory_bytes.print("%lu\t");
+		max_peak_memory_bytes.print("%lu\t");
 	}
 
 	BasicPerformanceCounter<Pheet, task_storage_count_blocks_created> num_blocks_created;
@@ -57,6 +64,11 @@ public:
 	BasicPerformanceCounter<Pheet, task_storage_count_spied_global_tasks> num_spied_global_tasks;
 	BasicPerformanceCounter<Pheet, task_storage_count_merges> num_merges;
 	BasicPerformanceCounter<Pheet, task_storage_count_allocated_items> num_allocated_items;
+	// Sum of the memory held by the item memory managers of all places when they are
+	// destroyed (memory given up to the pool before is not included)
+	BasicPerformanceCounter<Pheet, task_storage_measure_memory> teardown_memory_bytes;
+	// Peak memory of the item memory managers of a single place
+	MaxPerformanceCounter<Pheet, size_t, task_storage_measure_memory> max_peak_memory_bytes;
 
 };
 
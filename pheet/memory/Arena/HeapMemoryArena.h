@@ -0,0 +1,56 @@
+/*
+ * HeapMemoryArena.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef HEAPMEMORYARENA_H_
+#define HEAPMEMORYARENA_H_
+
+#include <cstddef>
+#include <iostream>
+#include <utility>
+
+namespace pheet {
+
+/*
+ * Default memory arena. Allocates from the global heap.
+ *
+ * Memory arenas are used by the memory managers to allocate their items and blocks.
+ * Objects have to be destroyed with the type they were created with.
+ */
+template <class Pheet>
+class HeapMemoryArena {
+public:
+	template <class T, typename ... Params>
+	static T* create(Params&& ... params) {
+		return new T(std::forward<Params>(params) ...);
+	}
+
+	template <class T>
+	static void destroy(T* item) {
+		delete item;
+	}
+
+	/*
+	 * Elements are default initialized
+	 */
+	template <class T>
+	static T* create_array(size_t size) {
+		return new T[size];
+	}
+
+	template <class T>
+	static void destroy_array(T* array, size_t) {
+		delete[] array;
+	}
+
+	static void print_name() {
+		std::cout << "HeapMemoryArena";
+	}
+};
+
+} /* namespace pheet */
+#endif /* HEAPMEMORYARENA_H_ */
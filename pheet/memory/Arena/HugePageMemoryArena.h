@@ -0,0 +1,232 @@
+/*
+ * HugePageMemoryArena.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef HUGEPAGEMEMORYARENA_H_
+#define HUGEPAGEMEMORYARENA_H_
+
+#include <pheet/settings.h>
+#include <pheet/misc/assert.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <new>
+#include <utility>
+#include <sys/mman.h>
+
+namespace pheet {
+
+/*
+ * Memory arena that carves objects out of RegionSize aligned regions.
+ *
+ * Each thread allocates from its own current region, which is mapped with huge pages
+ * (explicit huge pages if available, transparent huge pages otherwise) and bound to the
+ * NUMA node of the place the thread is bound to before it is touched. Allocations are
+ * bump allocated, memory of single objects is not reused. This is fine for the memory
+ * managers, which reuse their items themselves and only give them back at the end.
+ * Be aware that a single live object keeps its whole region mapped, so the arena is not
+ * suited for mixing a few long lived objects with many short lived ones.
+ *
+ * Every region counts its live objects, plus one reference held by the thread while it
+ * is allocating from it. A region is unmapped once the count drops to zero, so objects
+ * may be destroyed by any thread. If all objects in the current region of a thread have
+ * been destroyed once it is full, the thread starts over in the same region instead of
+ * mapping a new one. Objects larger than a quarter region get a region of their own,
+ * rounded up to a multiple of RegionSize.
+ *
+ * Objects have to be destroyed with the type they were created with.
+ */
+template <class Pheet, size_t RegionSize>
+class HugePageMemoryArenaImpl {
+public:
+	typedef HugePageMemoryArenaImpl<Pheet, RegionSize> Self;
+
+	template <size_t NewRegionSize>
+	using WithRegionSize = HugePageMemoryArenaImpl<Pheet, NewRegionSize>;
+
+	template <class T, typename ... Params>
+	static T* create(Params&& ... params) {
+		void* mem = allocate(sizeof(T), alignof(T));
+		return new (mem) T(std::forward<Params>(params) ...);
+	}
+
+	template <class T>
+	static void destroy(T* item) {
+		item->~T();
+		release(item);
+	}
+
+	/*
+	 * Elements are default initialized
+	 */
+	template <class T>
+	static T* create_array(size_t size) {
+		T* ret = reinterpret_cast<T*>(allocate(sizeof(T) * size, alignof(T)));
+		for(size_t i = 0; i < size; ++i) {
+			new (ret + i) T;
+		}
+		return ret;
+	}
+
+	template <class T>
+	static void destroy_array(T* array, size_t size) {
+		for(size_t i = 0; i < size; ++i) {
+			array[i].~T();
+		}
+		release(array);
+	}
+
+	static void print_name() {
+		std::cout << "HugePageMemoryArena<" << RegionSize << ">";
+	}
+
+private:
+	struct Region {
+		std::atomic<size_t> refs;
+		size_t bytes;
+	};
+
+	/*
+	 * Drops the reference to the current region when the thread exits
+	 */
+	struct LocalRegion {
+		LocalRegion()
+		: region(nullptr), offset(0) {}
+		~LocalRegion() {
+			if(region != nullptr) {
+				unref(region);
+			}
+		}
+
+		Region* region;
+		size_t offset;
+	};
+
+	static LocalRegion& local_region() {
+		static thread_local LocalRegion lr;
+		return lr;
+	}
+
+	static size_t align_up(size_t value, size_t alignment) {
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	static void* allocate(size_t size, size_t alignment) {
+		pheet_assert(alignment <= header_size);
+		if(size > (RegionSize - header_size) / 4) {
+			Region* r = map_region(align_up(header_size + size, RegionSize));
+			return reinterpret_cast<char*>(r) + header_size;
+		}
+
+		LocalRegion& lr = local_region();
+		size_t offset = align_up(lr.offset, alignment);
+		if(lr.region == nullptr || offset + size > RegionSize) {
+			// If only our own reference is left, all objects in the region are gone and we can start over
+			if(lr.region == nullptr || lr.region->refs.load(std::memory_order_acquire) != 1) {
+				if(lr.region != nullptr) {
+					unref(lr.region);
+				}
+				lr.region = map_region(RegionSize);
+			}
+			offset = header_size;
+		}
+		lr.region->refs.fetch_add(1, std::memory_order_relaxed);
+		lr.offset = offset + size;
+		return reinterpret_cast<char*>(lr.region) + offset;
+	}
+
+	/*
+	 * All objects start within the first RegionSize bytes of their region
+	 */
+	static void release(void* ptr) {
+		unref(reinterpret_cast<Region*>(reinterpret_cast<uintptr_t>(ptr) & ~static_cast<uintptr_t>(RegionSize - 1)));
+	}
+
+	static void unref(Region* r) {
+		if(r->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			munmap(r, r->bytes);
+		}
+	}
+
+	/*
+	 * Returns a region holding one reference
+	 */
+	static Region* map_region(size_t bytes) {
+		void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+		if(RegionSize % huge_page_size == 0 && !skip_hugetlb()) {
+			// Explicit huge pages are aligned to the huge page size
+			ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if(ptr == MAP_FAILED) {
+				// No huge pages available at the moment. They might be freed or reserved
+				// later, so only stop trying for a while
+				hugetlb_skip().store(hugetlb_retry_interval, std::memory_order_relaxed);
+			}
+			else if((reinterpret_cast<uintptr_t>(ptr) & (RegionSize - 1)) != 0) {
+				munmap(ptr, bytes);
+				ptr = MAP_FAILED;
+			}
+		}
+#endif
+		if(ptr == MAP_FAILED) {
+			// Over-allocate to be able to align the region, and give back the rest
+			void* raw = mmap(nullptr, bytes + RegionSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if(raw == MAP_FAILED) {
+				throw std::bad_alloc();
+			}
+			uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+			uintptr_t aligned = align_up(start, RegionSize);
+			if(aligned != start) {
+				munmap(raw, aligned - start);
+			}
+			if(aligned + bytes != start + bytes + RegionSize) {
+				munmap(reinterpret_cast<void*>(aligned + bytes), (start + bytes + RegionSize) - (aligned + bytes));
+			}
+			ptr = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+			madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+		}
+		// Needs to happen before the first touch, so pages are allocated on the node of the place
+		Pheet::MachineModel::bind_local_memory(ptr, bytes);
+
+		Region* r = new (ptr) Region;
+		r->refs.store(1, std::memory_order_relaxed);
+		r->bytes = bytes;
+		return r;
+	}
+
+	/*
+	 * Number of regions still to be mapped without trying explicit huge pages
+	 */
+	static std::atomic<size_t>& hugetlb_skip() {
+		static std::atomic<size_t> skip(0);
+		return skip;
+	}
+
+	static bool skip_hugetlb() {
+		size_t skip = hugetlb_skip().load(std::memory_order_relaxed);
+		while(skip != 0 && !hugetlb_skip().compare_exchange_weak(skip, skip - 1, std::memory_order_relaxed)) {}
+		return skip != 0;
+	}
+
+	static size_t const huge_page_size = static_cast<size_t>(2) << 20;
+	// Number of regions after a failed attempt until explicit huge pages are tried again
+	static size_t const hugetlb_retry_interval = 64;
+	// Also the maximum supported alignment
+	static size_t const header_size = 64;
+	static_assert(sizeof(Region) <= header_size, "Region header too large");
+	static_assert((RegionSize & (RegionSize - 1)) == 0, "RegionSize needs to be a power of two");
+};
+
+template <class Pheet>
+using HugePageMemoryArena = HugePageMemoryArenaImpl<Pheet, static_cast<size_t>(2) << 20>;
+
+} /* namespace pheet */
+#endif /* HUGEPAGEMEMORYARENA_H_ */
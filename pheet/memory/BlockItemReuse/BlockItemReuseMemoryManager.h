@@ -9,34 +9,58 @@
 #ifndef BLOCKITEMREUSEMEMORYMANAGER_H_
 #define BLOCKITEMREUSEMEMORYMANAGER_H_
 
+#include <algorithm>
+#include <limits>
+
 #include "BlockItemReuseMemoryManagerItem.h"
+#include "../ItemReuse/ItemReuseMemoryManagerPool.h"
 
 namespace pheet {
 
 /*
  * Similar to ItemReuseMemoryManager, but allocates blocks of items instead of single items
+ *
+ * If Trim is set, blocks are given up to a pool shared by all places when memory pressure
+ * is low: the amortization budget is full and all items of the block that was just passed
+ * were reused. In this case the next block is given up if all its items are reusable.
+ * Blocks are taken from the pool before new blocks are allocated. MaxPooled is the
+ * high-water mark of the pool in blocks (see ItemReuseMemoryManagerPoolImpl).
  */
-template <class Pheet, typename T, class ReuseCheck, size_t BlockSize, size_t Amortization>
+template <class Pheet, typename T, class ReuseCheck, size_t BlockSize, size_t Amortization, bool Trim, size_t MaxPooled>
 class BlockItemReuseMemoryManagerImpl {
 public:
 	typedef BlockItemReuseMemoryManagerItem<Pheet, T, BlockSize> Item;
+	typedef ItemReuseMemoryManagerPoolImpl<Pheet, Item, MaxPooled> Pool;
+	typedef typename Pheet::MemoryArena MemoryArena;
 
 	template <size_t NewAmortization>
-	using WithAmortization = BlockItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, BlockSize, NewAmortization>;
+	using WithAmortization = BlockItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, BlockSize, NewAmortization, Trim, MaxPooled>;
+
+	template <bool NewTrim>
+	using WithTrimming = BlockItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, BlockSize, Amortization, NewTrim, MaxPooled>;
+
+	template <size_t NewMaxPooled>
+	using WithMaxPooled = BlockItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, BlockSize, Amortization, Trim, NewMaxPooled>;
 
 	BlockItemReuseMemoryManagerImpl()
-	: head(new Item()), offset(0), amortized(0), total_size(BlockSize), new_block(true) {
+	: head(MemoryArena::template create<Item>()), offset(0), amortized(0), total_size(BlockSize), peak_size(BlockSize), reused(0), new_block(true) {
 		head->next = head;
+		if(Trim) {
+			Pool::get().attach();
+		}
 	}
 
 	~BlockItemReuseMemoryManagerImpl() {
 		Item* next = head->next;
 		while(next != head) {
 			Item* nnext = next->next;
-			delete next;
+			MemoryArena::destroy(next);
 			next = nnext;
 		}
-		delete head;
+		MemoryArena::destroy(head);
+		if(Trim) {
+			Pool::get().detach();
+		}
 	}
 
 	/*
@@ -54,27 +78,24 @@ public:
 					++offset;
 					// Successful access pays for 1 unsuccessful access
 					amortized += 1 + Amortization;
+					++reused;
 					return head->items[offset - 1];
 				}
 				++offset;
 			}
 			if(amortized < BlockSize) {
-				Item* tmp = new Item();
-				tmp->next = head->next;
-				head->next = tmp;
-				head = tmp;
-				total_size += BlockSize;
-
-				new_block = true;
+				add_block();
 			}
 			else {
 				amortized = std::min(amortized, total_size * Amortization);
+				trim();
 				amortized -= BlockSize;
 				head = head->next;
 
 				new_block = false;
 			}
 			offset = 0;
+			reused = 0;
 		}
 	}
 
@@ -94,28 +115,25 @@ public:
 					++offset;
 					// Successful access pays for 1 unsuccessful access
 					amortized += 1 + Amortization;
+					++reused;
 					head->items[offset] = std::move(assign);
 					return head->items[offset];
 				}
 				++offset;
 			}
 			if(amortized < BlockSize) {
-				Item* tmp = new Item();
-				tmp->next = head->next;
-				head->next = tmp;
-				head = tmp;
-				total_size += BlockSize;
-
-				new_block = true;
+				add_block();
 			}
 			else {
 				amortized = std::min(amortized, total_size * Amortization);
+				trim();
 				amortized -= BlockSize;
 				head = head->next;
 
 				new_block = false;
 			}
 			offset = 0;
+			reused = 0;
 //			pheet_assert(total_size < 1000000);
 		}
 	}
@@ -136,28 +154,25 @@ public:
 					++offset;
 					// Successful access pays for 1 unsuccessful access
 					amortized += 1 + Amortization;
+					++reused;
 					head->items[offset] = std::tuple<S, V ...>(std::move(assign), std::forward(assign_more ...));
 					return head->items[offset];
 				}
 				++offset;
 			}
 			if(amortized < BlockSize) {
-				Item* tmp = new Item();
-				tmp->next = head->next;
-				head->next = tmp;
-				head = tmp;
-				total_size += BlockSize;
-
-				new_block = true;
+				add_block();
 			}
 			else {
 				amortized = std::min(amortized, total_size * Amortization);
+				trim();
 				amortized -= BlockSize;
 				head = head->next;
 
 				new_block = false;
 			}
 			offset = 0;
+			reused = 0;
 //			pheet_assert(total_size < 1000000);
 		}
 	}
@@ -166,17 +181,69 @@ public:
 		return total_size;
 	}
 
+	/*
+	 * Memory currently held by this memory manager
+	 */
+	size_t memory_bytes() const {
+		return (total_size / BlockSize) * sizeof(Item);
+	}
+
+	size_t peak_memory_bytes() const {
+		return (peak_size / BlockSize) * sizeof(Item);
+	}
+
 private:
+	void add_block() {
+		Item* tmp = nullptr;
+		if(Trim) {
+			tmp = Pool::get().take();
+		}
+		// Items of pooled blocks have been used before, so they need to be checked
+		new_block = (tmp == nullptr);
+		if(new_block) {
+			tmp = MemoryArena::template create<Item>();
+		}
+		tmp->next = head->next;
+		head->next = tmp;
+		head = tmp;
+		total_size += BlockSize;
+		peak_size = std::max(peak_size, total_size);
+	}
+
+	/*
+	 * Called before moving on to the next block
+	 */
+	void trim() {
+		if(Trim && !new_block && reused == BlockSize && amortized == total_size * Amortization) {
+			Item* block = head->next;
+			if(block == head) {
+				return;
+			}
+			for(size_t i = 0; i < BlockSize; ++i) {
+				if(!reuse_check(block->items[i])) {
+					return;
+				}
+			}
+			head->next = block->next;
+			total_size -= BlockSize;
+			amortized = std::min(amortized, total_size * Amortization);
+			Pool::get().put(block);
+		}
+	}
+
 	Item* head;
 	size_t offset;
 	size_t amortized;
 	size_t total_size;
+	size_t peak_size;
+	// Items reused from the current block
+	size_t reused;
 	bool new_block;
 	ReuseCheck reuse_check;
 };
 
 template <class Pheet, typename T, class ReuseCheck>
-using BlockItemReuseMemoryManager = BlockItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, 256, 1>;
+using BlockItemReuseMemoryManager = BlockItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, 256, 1, false, std::numeric_limits<size_t>::max()>;
 
 } /* namespace pheet */
 #endif /* BLOCKITEMREUSEMEMORYMANAGER_H_ */
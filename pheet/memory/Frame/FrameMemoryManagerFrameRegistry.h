@@ -0,0 +1,199 @@
+/*
+ * FrameMemoryManagerFrameRegistry.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef FRAMEMEMORYMANAGERFRAMEREGISTRY_H_
+#define FRAMEMEMORYMANAGERFRAMEREGISTRY_H_
+
+#include <cstdint>
+
+#include "FrameMemoryManagerFrame.h"
+#include "FrameMemoryManagerFrameLocalView.h"
+
+namespace pheet {
+
+/*
+ * Registrations of a place at frames. Local views are stored in an open addressing table
+ * with linear probing, keyed by the frame pointer. Entries are removed by shifting back the
+ * following entries of the cluster, so no tombstones are needed and the table only
+ * allocates memory when it grows.
+ *
+ * The last BufferSize registrations released through rem_reg_buffered are kept alive in a
+ * buffer, so a frame that is accessed repeatedly does not need to register again each time.
+ *
+ * Only to be used by the owning place.
+ */
+template <class Pheet, size_t BufferSize>
+class FrameMemoryManagerFrameRegistry {
+public:
+	typedef FrameMemoryManagerFrame<Pheet> Frame;
+	typedef FrameMemoryManagerFrameLocalView<Pheet> LV;
+
+	FrameMemoryManagerFrameRegistry()
+	: table(new Entry[initial_capacity]), capacity(initial_capacity), shift(64 - log_initial_capacity),
+	  size(0), buffer_index(0) {
+		for(size_t i = 0; i < BufferSize; ++i) {
+			recent_regs[i] = nullptr;
+		}
+	}
+	~FrameMemoryManagerFrameRegistry() {
+		delete[] table;
+	}
+
+	void reg(Frame* frame, size_t& phase) {
+		// May grow the table, so it needs to be called before table is read
+		size_t i = find_or_insert(frame);
+		LV& reg = table[i].view;
+		phase = frame->get_phase();
+
+		while(!reg.try_reg(frame, phase)) {
+			phase = frame->get_phase();
+		}
+	}
+
+	bool try_reg(Frame* frame, size_t& phase) {
+		size_t i = find_or_insert(frame);
+		LV& reg = table[i].view;
+		phase = frame->get_phase();
+
+		if(reg.try_reg(frame, phase)) {
+			return true;
+		}
+		if(reg.empty()) {
+			erase(i);
+		}
+		return false;
+	}
+
+	void rem_reg(Frame* frame, size_t phase) {
+		size_t i = find(frame);
+		LV& reg = table[i].view;
+
+		reg.rem_reg(frame, phase);
+		if(reg.empty()) {
+			erase(i);
+		}
+	}
+
+	void rem_reg_buffered(Frame* frame, size_t phase) {
+		size_t i = find(frame);
+		LV& reg = table[i].view;
+
+		if(reg.is_last(phase)) {
+			buffer_index = (buffer_index + 1) % BufferSize;
+			if(recent_regs[buffer_index] != nullptr) {
+				rem_reg(recent_regs[buffer_index], recent_reg_phases[buffer_index]);
+			}
+			recent_regs[buffer_index] = frame;
+			recent_reg_phases[buffer_index] = phase;
+		}
+		else {
+			reg.rem_reg(frame, phase);
+			if(reg.empty()) {
+				erase(i);
+			}
+		}
+	}
+
+private:
+	struct Entry {
+		Entry()
+		: frame(nullptr) {}
+
+		Frame* frame;
+		LV view;
+	};
+
+	size_t home(Frame* frame) const {
+		// Fibonacci hashing, the upper bits of the product are well mixed
+		return static_cast<size_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(frame)) * 0x9E3779B97F4A7C15ULL) >> shift);
+	}
+
+	/*
+	 * Frame needs to be registered
+	 */
+	size_t find(Frame* frame) const {
+		size_t i = home(frame);
+		while(table[i].frame != frame) {
+			pheet_assert(table[i].frame != nullptr);
+			i = (i + 1) & (capacity - 1);
+		}
+		return i;
+	}
+
+	size_t find_or_insert(Frame* frame) {
+		if((size + 1) * 4 > capacity * 3) {
+			grow();
+		}
+		size_t i = home(frame);
+		while(table[i].frame != frame) {
+			if(table[i].frame == nullptr) {
+				table[i].frame = frame;
+				table[i].view = LV();
+				++size;
+				break;
+			}
+			i = (i + 1) & (capacity - 1);
+		}
+		return i;
+	}
+
+	/*
+	 * Moves following entries of the cluster back into the gap, if this does not move them
+	 * before their home slot
+	 */
+	void erase(size_t i) {
+		size_t mask = capacity - 1;
+		size_t j = i;
+		while(true) {
+			j = (j + 1) & mask;
+			if(table[j].frame == nullptr) {
+				break;
+			}
+			size_t h = home(table[j].frame);
+			if(((j - h) & mask) >= ((j - i) & mask)) {
+				table[i] = table[j];
+				i = j;
+			}
+		}
+		table[i].frame = nullptr;
+		--size;
+	}
+
+	void grow() {
+		Entry* old = table;
+		size_t old_capacity = capacity;
+		capacity <<= 1;
+		--shift;
+		table = new Entry[capacity];
+		for(size_t i = 0; i < old_capacity; ++i) {
+			if(old[i].frame != nullptr) {
+				size_t j = home(old[i].frame);
+				while(table[j].frame != nullptr) {
+					j = (j + 1) & (capacity - 1);
+				}
+				table[j] = old[i];
+			}
+		}
+		delete[] old;
+	}
+
+	static size_t const log_initial_capacity = 6;
+	static size_t const initial_capacity = static_cast<size_t>(1) << log_initial_capacity;
+
+	Entry* table;
+	size_t capacity;
+	size_t shift;
+	size_t size;
+
+	Frame* recent_regs[BufferSize];
+	size_t recent_reg_phases[BufferSize];
+	size_t buffer_index;
+};
+
+} /* namespace pheet */
+#endif /* FRAMEMEMORYMANAGERFRAMEREGISTRY_H_ */
@@ -9,11 +9,9 @@
 #ifndef FRAMEMEMORYMANAGERPLACESINGLETON_H_
 #define FRAMEMEMORYMANAGERPLACESINGLETON_H_
 
-#include <unordered_map>
-
 #include <pheet/memory/ItemReuse/ItemReuseMemoryManager.h>
 #include "FrameMemoryManagerFrame.h"
-#include "FrameMemoryManagerFrameLocalView.h"
+#include "FrameMemoryManagerFrameRegistry.h"
 
 namespace pheet {
 
@@ -21,41 +19,23 @@ template <class Pheet, size_t BufferSize>
 class FrameMemoryManagerPlaceSingletonImpl {
 public:
 	typedef FrameMemoryManagerFrame<Pheet> Frame;
-	typedef FrameMemoryManagerFrameLocalView<Pheet> LV;
+	typedef FrameMemoryManagerFrameRegistry<Pheet, BufferSize> Registry;
 
 	typedef ItemReuseMemoryManager<Pheet, Frame, FrameMemoryManagerFrameReuseCheck<Frame> > FrameMemoryManager;
 
-	FrameMemoryManagerPlaceSingletonImpl()
-	: buffer_index(0) {
-		for(size_t i = 0; i < BufferSize; ++i) {
-			recent_regs[i] = nullptr;
-		}
-	}
+	FrameMemoryManagerPlaceSingletonImpl() {}
 	~FrameMemoryManagerPlaceSingletonImpl() {}
 
 	void reg(Frame* frame, size_t& phase) {
-		LV& reg = frame_regs[frame];
-		phase = frame->get_phase();
-
-		while(!reg.try_reg(frame, phase)) {
-			phase = frame->get_phase();
-		}
+		frame_regs.reg(frame, phase);
 	}
 
 	bool try_reg(Frame* frame, size_t& phase) {
-		LV& reg = frame_regs[frame];
-		phase = frame->get_phase();
-
-		return reg.try_reg(frame, phase);
+		return frame_regs.try_reg(frame, phase);
 	}
 
 	void rem_reg(Frame* frame, size_t phase) {
-		LV& reg = frame_regs[frame];
-
-		reg.rem_reg(frame, phase);
-		if(reg.empty()) {
-			frame_regs.erase(frame);
-		}
+		frame_regs.rem_reg(frame, phase);
 	}
 
 	/*
@@ -63,22 +43,7 @@ public:
 	 * where the same frame is accessed every time
 	 */
 	void rem_reg_buffered(Frame* frame, size_t phase) {
-		LV& reg = frame_regs[frame];
-
-		if(reg.is_last(phase)) {
-			buffer_index = (buffer_index + 1) % BufferSize;
-			if(recent_regs[buffer_index] != nullptr) {
-				rem_reg(recent_regs[buffer_index], recent_reg_phases[buffer_index]);
-			}
-			recent_regs[buffer_index] = frame;
-			recent_reg_phases[buffer_index] = phase;
-		}
-		else {
-			reg.rem_reg(frame, phase);
-			if(reg.empty()) {
-				frame_regs.erase(frame);
-			}
-		}
+		frame_regs.rem_reg_buffered(frame, phase);
 	}
 
 	Frame* next_frame() {
@@ -87,11 +52,7 @@ public:
 
 private:
 	FrameMemoryManager frames;
-	std::unordered_map<Frame*, LV> frame_regs;
-
-	Frame* recent_regs[BufferSize];
-	size_t recent_reg_phases[BufferSize];
-	size_t buffer_index;
+	Registry frame_regs;
 };
 
 template <class Pheet>
@@ -9,28 +9,52 @@
 #ifndef ITEMREUSEMEMORYMANAGER_H_
 #define ITEMREUSEMEMORYMANAGER_H_
 
+#include <algorithm>
+#include <limits>
+
 #include "ItemReuseMemoryManagerItem.h"
+#include "ItemReuseMemoryManagerPool.h"
 
 namespace pheet {
 
-template <class Pheet, typename T, class ReuseCheck>
-class ItemReuseMemoryManager {
+/*
+ * If Trim is set, items are given up to a pool shared by all places once a whole round
+ * through the ring found only reusable items. Items are taken from the pool before new
+ * items are allocated. MaxPooled is the high-water mark of the pool (see
+ * ItemReuseMemoryManagerPoolImpl).
+ */
+template <class Pheet, typename T, class ReuseCheck, bool Trim, size_t MaxPooled>
+class ItemReuseMemoryManagerImpl {
 public:
 	typedef ItemReuseMemoryManagerItem<Pheet, T> Item;
+	typedef ItemReuseMemoryManagerPoolImpl<Pheet, Item, MaxPooled> Pool;
+	typedef typename Pheet::MemoryArena MemoryArena;
+
+	template <bool NewTrim>
+	using WithTrimming = ItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, NewTrim, MaxPooled>;
 
-	ItemReuseMemoryManager()
-	: head(new Item()), tail(head) {
+	template <size_t NewMaxPooled>
+	using WithMaxPooled = ItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, Trim, NewMaxPooled>;
+
+	ItemReuseMemoryManagerImpl()
+	: head(MemoryArena::template create<Item>()), tail(head), num_items(1), peak_items(1), reused(0) {
 		head->next = head;
+		if(Trim) {
+			Pool::get().attach();
+		}
 	}
 
-	~ItemReuseMemoryManager() {
+	~ItemReuseMemoryManagerImpl() {
 		Item* next = head->next;
 		while(next != head) {
 			Item* nnext = next->next;
-			delete next;
+			MemoryArena::destroy(next);
 			next = nnext;
 		}
-		delete head;
+		MemoryArena::destroy(head);
+		if(Trim) {
+			Pool::get().detach();
+		}
 	}
 
 	/*
@@ -51,14 +75,16 @@ public:
 				if(tail != head) {
 					tail = tail->next;
 				}
+				trim();
 				return head->item;
 			}
 			head = head->next;
+			reused = 0;
 		}
 
 		// Too many checks. Splice in new element
 		pheet_assert(head->next == tail);
-		head->next = new Item();
+		head->next = allocate_item();
 		head->next->next = tail;
 		head = head->next;
 		tail = tail->next;
@@ -84,15 +110,24 @@ public:
 				if(tail != head) {
 					tail = tail->next;
 				}
+				trim();
 				head->item = std::move(assign);
 				return head->item;
 			}
 			head = head->next;
+			reused = 0;
 		}
 
 		// Too many checks. Splice in new element
 		pheet_assert(head->next == tail);
-		head->next = new Item(std::move(assign));
+		Item* item = take_pooled_item();
+		if(item != nullptr) {
+			item->item = std::move(assign);
+		}
+		else {
+			item = MemoryArena::template create<Item>(std::move(assign));
+		}
+		head->next = item;
 		head->next->next = tail;
 		head = head->next;
 		tail = tail->next;
@@ -118,26 +153,91 @@ public:
 				if(tail != head) {
 					tail = tail->next;
 				}
+				trim();
 				head->item = std::tuple<S, V ...>(std::move(assign), std::forward(assign_more ...));
 				return head->item;
 			}
 			head = head->next;
+			reused = 0;
 		}
 
 		// Too many checks. Splice in new element
 		pheet_assert(head->next == tail);
-		head->next = new Item(std::move(assign), std::forward(assign_more ...));
+		Item* item = take_pooled_item();
+		if(item != nullptr) {
+			item->item = std::tuple<S, V ...>(std::move(assign), std::forward(assign_more ...));
+		}
+		else {
+			item = MemoryArena::template create<Item>(std::move(assign), std::forward(assign_more ...));
+		}
+		head->next = item;
 		head->next->next = tail;
 		head = head->next;
 		tail = tail->next;
 		return head->item;
 	}
 
+	/*
+	 * Memory currently held by this memory manager
+	 */
+	size_t memory_bytes() const {
+		return num_items * sizeof(Item);
+	}
+
+	size_t peak_memory_bytes() const {
+		return peak_items * sizeof(Item);
+	}
+
 private:
+	/*
+	 * Gives up the item after head if all items of the last round were reusable
+	 * (at most one item per successful acquire)
+	 */
+	void trim() {
+		if(Trim) {
+			++reused;
+			if(reused >= num_items && head->next != tail && reuse_check(head->next->item)) {
+				Item* item = head->next;
+				head->next = item->next;
+				--num_items;
+				Pool::get().put(item);
+			}
+		}
+	}
+
+	/*
+	 * Accounts for the item that is spliced in. Returns nullptr if no pooled item is
+	 * available, in which case the caller allocates a new one
+	 */
+	Item* take_pooled_item() {
+		Item* ret = nullptr;
+		if(Trim) {
+			ret = Pool::get().take();
+		}
+		++num_items;
+		peak_items = std::max(peak_items, num_items);
+		return ret;
+	}
+
+	Item* allocate_item() {
+		Item* ret = take_pooled_item();
+		if(ret == nullptr) {
+			ret = MemoryArena::template create<Item>();
+		}
+		return ret;
+	}
+
 	Item* head;
 	Item* tail;
+	size_t num_items;
+	size_t peak_items;
+	// Successful reuses since the last failed reuse check
+	size_t reused;
 	ReuseCheck reuse_check;
 };
 
+template <class Pheet, typename T, class ReuseCheck>
+using ItemReuseMemoryManager = ItemReuseMemoryManagerImpl<Pheet, T, ReuseCheck, false, std::numeric_limits<size_t>::max()>;
+
 } /* namespace pheet */
 #endif /* ITEMREUSEMEMORYMANAGER_H_ */
@@ -0,0 +1,110 @@
+/*
+ * ItemReuseMemoryManagerPool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ITEMREUSEMEMORYMANAGERPOOL_H_
+#define ITEMREUSEMEMORYMANAGERPOOL_H_
+
+#include <atomic>
+#include <limits>
+
+namespace pheet {
+
+/*
+ * Nodes (items or blocks of items) given up by the item reuse memory managers of all places.
+ * Other places take nodes from here before allocating new ones.
+ *
+ * Other places may still read from a node that passed the reuse check (that is also why
+ * nodes are reused instead of being deleted), so by default nodes are only deleted once the
+ * last memory manager using the pool has been destroyed. If the reuse check guarantees that
+ * no place can reach the node anymore, MaxPooled can be set to a high-water mark. Nodes put
+ * into a pool that already holds MaxPooled nodes are given back to the memory arena.
+ */
+template <class Pheet, class Node, size_t MaxPooled>
+class ItemReuseMemoryManagerPoolImpl {
+public:
+	typedef ItemReuseMemoryManagerPoolImpl<Pheet, Node, MaxPooled> Self;
+	typedef typename Pheet::Mutex Mutex;
+	typedef typename Pheet::LockGuard LockGuard;
+
+	static Self& get() {
+		static Self pool;
+		return pool;
+	}
+
+	~ItemReuseMemoryManagerPoolImpl() {
+		release();
+	}
+
+	void attach() {
+		LockGuard g(m);
+		++users;
+	}
+
+	void detach() {
+		LockGuard g(m);
+		pheet_assert(users > 0);
+		--users;
+		if(users == 0) {
+			release();
+		}
+	}
+
+	void put(Node* node) {
+		{
+			LockGuard g(m);
+			if(num_nodes.load(std::memory_order_relaxed) < MaxPooled) {
+				node->next = nodes;
+				nodes = node;
+				num_nodes.store(num_nodes.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		// Surplus above the high-water mark
+		Pheet::MemoryArena::destroy(node);
+	}
+
+	/*
+	 * Returns nullptr if the pool is empty
+	 */
+	Node* take() {
+		if(num_nodes.load(std::memory_order_relaxed) == 0) {
+			return nullptr;
+		}
+		LockGuard g(m);
+		Node* ret = nodes;
+		if(ret != nullptr) {
+			nodes = ret->next;
+			num_nodes.store(num_nodes.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+		}
+		return ret;
+	}
+
+private:
+	ItemReuseMemoryManagerPoolImpl()
+	: nodes(nullptr), num_nodes(0), users(0) {}
+
+	void release() {
+		while(nodes != nullptr) {
+			Node* next = nodes->next;
+			Pheet::MemoryArena::destroy(nodes);
+			nodes = next;
+		}
+		num_nodes.store(0, std::memory_order_relaxed);
+	}
+
+	Mutex m;
+	Node* nodes;
+	std::atomic<size_t> num_nodes;
+	size_t users;
+};
+
+template <class Pheet, class Node>
+using ItemReuseMemoryManagerPool = ItemReuseMemoryManagerPoolImpl<Pheet, Node, std::numeric_limits<size_t>::max()>;
+
+} /* namespace pheet */
+#endif /* ITEMREUSEMEMORYMANAGERPOOL_H_ */
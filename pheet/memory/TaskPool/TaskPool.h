@@ -0,0 +1,194 @@
+/*
+ * TaskPool.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef TASKPOOL_H_
+#define TASKPOOL_H_
+
+#include "../../settings.h"
+#include "TaskPoolPerformanceCounters.h"
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace pheet {
+
+/*
+ * Place-local size-class allocator for task objects.
+ *
+ * Each place owns one pool. Requests are rounded up to a multiple of Granularity and
+ * served from a per-size-class free list, which is refilled in chunks of BlocksPerChunk
+ * blocks. Every block carries a small header that points to the owning pool, so a task
+ * that was stolen and is freed on a different place is handed back to its owner through
+ * a lock-free remote-free list. The owner drains this list lazily once a local free list
+ * runs dry. Requests larger than the biggest size class fall back to the global heap.
+ *
+ * All methods except the remote-free push have to be called by the owning place only.
+ */
+template <class Pheet, size_t Granularity, size_t NumClasses, size_t BlocksPerChunk>
+class TaskPoolImpl {
+public:
+	typedef TaskPoolImpl<Pheet, Granularity, NumClasses, BlocksPerChunk> Self;
+	typedef TaskPoolPerformanceCounters<Pheet> PerformanceCounters;
+
+	template <size_t NewBlocksPerChunk>
+	using WithBlocksPerChunk = TaskPoolImpl<Pheet, Granularity, NumClasses, NewBlocksPerChunk>;
+
+	TaskPoolImpl(PerformanceCounters& pc)
+	: remote_frees(nullptr), pc(pc) {
+		for(size_t i = 0; i < NumClasses; ++i) {
+			free_lists[i] = nullptr;
+		}
+	}
+
+	~TaskPoolImpl() {
+		for(auto c : chunks) {
+			delete[] c;
+		}
+	}
+
+	/*
+	 * Allocates and constructs a new object of type T
+	 */
+	template <class T, typename ... Params>
+	T* create(Params&& ... params) {
+		static_assert(alignof(T) <= Granularity, "Type requires stricter alignment than supported by the task pool");
+		void* mem = allocate(sizeof(T));
+		return new (mem) T(std::forward<Params>(params) ...);
+	}
+
+	/*
+	 * Destroys an object previously created by any task pool of the same type.
+	 * T needs to be polymorphic (which tasks always are), as we need to find
+	 * the start of the most derived object.
+	 */
+	template <class T>
+	void destroy(T* item) {
+		void* mem = dynamic_cast<void*>(item);
+		item->~T();
+		release(mem);
+	}
+
+private:
+	struct Block {
+		Self* owner;
+		size_t size_class;
+		// Only valid while the block is free. Overlaps with the payload
+		Block* next;
+	};
+	static size_t const header_size = offsetof(Block, next);
+	static_assert(header_size % Granularity == 0, "Block header breaks payload alignment");
+
+	void* allocate(size_t size) {
+		size_t sc = (size + Granularity - 1) / Granularity;
+		if(sc > 0) {
+			--sc;
+		}
+		if(sc >= NumClasses) {
+			// Too large for pooling
+			pc.num_misses.incr();
+			Block* b = reinterpret_cast<Block*>(::operator new(header_size + size));
+			b->owner = nullptr;
+			b->size_class = NumClasses;
+			return reinterpret_cast<char*>(b) + header_size;
+		}
+
+		Block* b = free_lists[sc];
+		if(b == nullptr) {
+			drain_remote_frees();
+			b = free_lists[sc];
+			if(b == nullptr) {
+				pc.num_misses.incr();
+				allocate_chunk(sc);
+				b = free_lists[sc];
+				pheet_assert(b != nullptr);
+			}
+			else {
+				pc.num_hits.incr();
+			}
+		}
+		else {
+			pc.num_hits.incr();
+		}
+		free_lists[sc] = b->next;
+		return reinterpret_cast<char*>(b) + header_size;
+	}
+
+	void release(void* ptr) {
+		Block* b = reinterpret_cast<Block*>(reinterpret_cast<char*>(ptr) - header_size);
+		if(b->size_class == NumClasses) {
+			::operator delete(b);
+		}
+		else if(b->owner == this) {
+			b->next = free_lists[b->size_class];
+			free_lists[b->size_class] = b;
+		}
+		else {
+			pc.num_remote_frees.incr();
+			Self* owner = b->owner;
+			Block* head = owner->remote_frees.load(std::memory_order_relaxed);
+			do {
+				b->next = head;
+			} while(!owner->remote_frees.compare_exchange_weak(head, b, std::memory_order_release, std::memory_order_relaxed));
+		}
+	}
+
+	/*
+	 * Moves all blocks that have been freed by other places back to the local free lists.
+	 * Only the owner takes from the list, and always takes all of it, so there is no ABA problem.
+	 */
+	void drain_remote_frees() {
+		if(remote_frees.load(std::memory_order_relaxed) == nullptr) {
+			return;
+		}
+		Block* b = remote_frees.exchange(nullptr, std::memory_order_acquire);
+		while(b != nullptr) {
+			Block* next = b->next;
+			pheet_assert(b->owner == this);
+			pheet_assert(b->size_class < NumClasses);
+			b->next = free_lists[b->size_class];
+			free_lists[b->size_class] = b;
+			b = next;
+		}
+	}
+
+	void allocate_chunk(size_t sc) {
+		size_t block_size = header_size + (sc + 1) * Granularity;
+		char* chunk = new char[block_size * BlocksPerChunk];
+		chunks.push_back(chunk);
+
+		Block* head = free_lists[sc];
+		for(size_t i = 0; i < BlocksPerChunk; ++i) {
+			Block* b = reinterpret_cast<Block*>(chunk + i * block_size);
+			b->owner = this;
+			b->size_class = sc;
+			b->next = head;
+			head = b;
+		}
+		free_lists[sc] = head;
+	}
+
+	Block* free_lists[NumClasses];
+	std::vector<char*> chunks;
+
+	// Written by other places, so keep it away from the local data
+	char padding[64];
+	std::atomic<Block*> remote_frees;
+	char padding2[64];
+
+	PerformanceCounters pc;
+};
+
+template <class Pheet>
+using TaskPool = TaskPoolImpl<Pheet, 16, 16, 64>;
+
+}
+
+#endif /* TASKPOOL_H_ */
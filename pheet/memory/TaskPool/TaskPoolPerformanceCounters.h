@@ -0,0 +1,51 @@
+/*
+ * TaskPoolPerformanceCounters.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef TASKPOOLPERFORMANCECOUNTERS_H_
+#define TASKPOOLPERFORMANCECOUNTERS_H_
+
+#include "../../settings.h"
+#include "../../primitives/PerformanceCounter/Basic/BasicPerformanceCounter.h"
+
+namespace pheet {
+
+template <class Pheet>
+class TaskPoolPerformanceCounters {
+public:
+	TaskPoolPerformanceCounters() {}
+	TaskPoolPerformanceCounters(TaskPoolPerformanceCounters<Pheet>& other)
+		: num_hits(other.num_hits),
+		  num_misses(other.num_misses),
+		  num_remote_frees(other.num_remote_frees) {}
+	~TaskPoolPerformanceCounters() {}
+
+	static void print_headers();
+	void print_values();
+
+	BasicPerformanceCounter<Pheet, scheduler_count_task_alloc_hits> num_hits;
+	BasicPerformanceCounter<Pheet, scheduler_count_task_alloc_misses> num_misses;
+	BasicPerformanceCounter<Pheet, scheduler_count_task_remote_frees> num_remote_frees;
+};
+
+template <class Pheet>
+inline void TaskPoolPerformanceCounters<Pheet>::print_headers() {
+	BasicPerformanceCounter<Pheet, scheduler_count_task_alloc_hits>::print_header("task_alloc_hits\t");
+	BasicPerformanceCounter<Pheet, scheduler_count_task_alloc_misses>::print_header("task_alloc_misses\t");
+	BasicPerformanceCounter<Pheet, scheduler_count_task_remote_frees>::print_header("task_remote_frees\t");
+}
+
+template <class Pheet>
+inline void TaskPoolPerformanceCounters<Pheet>::print_values() {
+	num_hits.print("%lu\t");
+	num_misses.print("%lu\t");
+	num_remote_frees.print("%lu\t");
+}
+
+}
+
+#endif /* TASKPOOLPERFORMANCECOUNTERS_H_ */
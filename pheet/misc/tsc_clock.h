@@ -0,0 +1,86 @@
+/*
+ * tsc_clock.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef TSC_CLOCK_H_
+#define TSC_CLOCK_H_
+
+#include "../environment.h"
+
+#include <chrono>
+#include <stdint.h>
+
+#ifdef ENV_X86
+#include <x86intrin.h>
+#endif
+
+namespace pheet {
+
+/*
+ * Cheap clock for performance counters. Reads the time stamp counter on x86 (assumes an
+ * invariant TSC, which all recent x86 processors provide) and falls back to steady_clock
+ * in nanoseconds elsewhere.
+ *
+ * Ticks are converted to seconds by comparing against steady_clock over the time since
+ * the first call to now(), so the conversion gets more precise the longer the program runs.
+ */
+class TSCClock {
+public:
+	typedef uint64_t Ticks;
+
+	static Ticks now() {
+		static Calibration const& c = calibration();
+		(void)c;
+		return read();
+	}
+
+	static double to_seconds(Ticks ticks) {
+		return ticks / ticks_per_second();
+	}
+
+	static double ticks_per_second() {
+#ifdef ENV_X86
+		Calibration const& c = calibration();
+		uint64_t ns;
+		Ticks t;
+		do {
+			// Make sure the measured interval is long enough to be meaningful
+			ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - c.time).count();
+			t = read();
+		} while(ns < 10000000);
+		return (t - c.ticks) * 1.0e9 / ns;
+#else
+		return 1.0e9;
+#endif
+	}
+
+private:
+	struct Calibration {
+		Calibration()
+		: time(std::chrono::steady_clock::now()), ticks(read()) {}
+
+		std::chrono::steady_clock::time_point time;
+		Ticks ticks;
+	};
+
+	static Calibration const& calibration() {
+		static Calibration c;
+		return c;
+	}
+
+	static Ticks read() {
+#ifdef ENV_X86
+		return __rdtsc();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+};
+
+}
+
+#endif /* TSC_CLOCK_H_ */
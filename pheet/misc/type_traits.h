@@ -26,6 +26,24 @@ class nullable_traits<T*> {
 template <typename T>
 T* const nullable_traits<T*>::null_value = nullptr;
 
+/*
+ * Compile-time integer sequence, used to unpack tuples into argument lists
+ * (std::index_sequence is only available from C++14 on)
+ */
+template <size_t ... I>
+struct index_sequence {};
+
+template <size_t N, size_t ... I>
+struct make_index_sequence_helper : make_index_sequence_helper<N - 1, N - 1, I ...> {};
+
+template <size_t ... I>
+struct make_index_sequence_helper<0, I ...> {
+	typedef index_sequence<I ...> type;
+};
+
+template <size_t N>
+using make_index_sequence = typename make_index_sequence_helper<N>::type;
+
 }
 
 
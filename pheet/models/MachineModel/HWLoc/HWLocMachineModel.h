@@ -33,6 +33,7 @@ public:
 	hwloc_cpuset_t get_binding();
 	void bind(hwloc_cpuset_t cpus);
 	void free_binding(hwloc_cpuset_t cpus);
+	void bind_memory(hwloc_obj_t node, void const* addr, size_t size);
 
 	/*
 	 * This does not seem to be supported under linux, so use with care
@@ -169,6 +170,12 @@ void HWLocTopologyInfo<Pheet>::free_binding(hwloc_cpuset_t cpus) {
 	hwloc_bitmap_free(cpus);
 }
 
+template <class Pheet>
+void HWLocTopologyInfo<Pheet>::bind_memory(hwloc_obj_t node, void const* addr, size_t size) {
+	// Failure is not critical, we just lose the locality guarantee (e.g. if binding is not supported)
+	hwloc_set_area_membind(topology, addr, size, node->cpuset, HWLOC_MEMBIND_BIND, 0);
+}
+
 template <class Pheet>
 class HWLocMachineModel {
 public:
@@ -197,6 +204,12 @@ public:
 	void bind();
 	void unbind();
 
+	/*
+	 * Binds the given memory area to the NUMA node(s) of the node the calling thread
+	 * has been bound to. Does nothing if the thread is not bound.
+	 */
+	static void bind_local_memory(void const* addr, size_t size);
+
 	/*
 	 * This does not seem to be supported under linux, so use with care
 	 */
@@ -233,11 +246,20 @@ private:
 	bool root;
 
 	hwloc_cpuset_t prev_binding;
+
+	static THREAD_LOCAL HWLocTopologyInfo<Pheet>* local_topo;
+	static THREAD_LOCAL hwloc_obj_t local_node;
 #ifdef PHEET_DEBUG_MODE
 	bool bound;
 #endif
 };
 
+template <class Pheet>
+THREAD_LOCAL HWLocTopologyInfo<Pheet>* HWLocMachineModel<Pheet>::local_topo = nullptr;
+
+template <class Pheet>
+THREAD_LOCAL hwloc_obj_t HWLocMachineModel<Pheet>::local_node = nullptr;
+
 template <class Pheet>
 HWLocMachineModel<Pheet>::HWLocMachineModel()
 : topo(new HWLocTopologyInfo<Pheet>()), node(topo->get_root_obj()), root(true), prev_binding(nullptr) {
@@ -321,6 +343,8 @@ void HWLocMachineModel<Pheet>::bind() {
 #endif
 	prev_binding = topo->get_binding();
 	topo->bind(node->cpuset);
+	local_topo = topo;
+	local_node = node;
 }
 
 template <class Pheet>
@@ -330,6 +354,15 @@ void HWLocMachineModel<Pheet>::unbind() {
 	bound = false;
 #endif
 	topo->bind(prev_binding);
+	local_topo = nullptr;
+	local_node = nullptr;
+}
+
+template <class Pheet>
+void HWLocMachineModel<Pheet>::bind_local_memory(void const* addr, size_t size) {
+	if(local_topo != nullptr) {
+		local_topo->bind_memory(local_node, addr, size);
+	}
 }
 
 template <class Pheet>
@@ -374,7 +407,7 @@ procs_t HWLocMachineModel<Pheet>::get_memory_level() {
 
 template <class Pheet>
 procs_t HWLocMachineModel<Pheet>::get_numa_memory_level() {
-	return std::min(node->depth, topo->get_numa_depth());
+	return std::min<procs_t>(node->depth, topo->get_numa_depth());
 }
 
 }
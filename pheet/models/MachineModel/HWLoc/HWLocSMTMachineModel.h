@@ -31,6 +31,7 @@ public:
 	hwloc_cpuset_t get_binding();
 	void bind(hwloc_cpuset_t cpus);
 	void free_binding(hwloc_cpuset_t cpus);
+	void bind_memory(hwloc_obj_t node, void const* addr, size_t size);
 
 	template <typename T>
 	bool is_partially_numa_local(hwloc_obj_t node, T const* addr, size_t count) {
@@ -139,6 +140,12 @@ void HWLocSMTTopologyInfo<Pheet>::free_binding(hwloc_cpuset_t cpus) {
 	hwloc_bitmap_free(cpus);
 }
 
+template <class Pheet>
+void HWLocSMTTopologyInfo<Pheet>::bind_memory(hwloc_obj_t node, void const* addr, size_t size) {
+	// Failure is not critical, we just lose the locality guarantee (e.g. if binding is not supported)
+	hwloc_set_area_membind(topology, addr, size, node->cpuset, HWLOC_MEMBIND_BIND, 0);
+}
+
 template <class Pheet>
 class HWLocSMTMachineModel {
 public:
@@ -167,6 +174,12 @@ public:
 	void bind();
 	void unbind();
 
+	/*
+	 * Binds the given memory area to the NUMA node(s) of the node the calling thread
+	 * has been bound to. Does nothing if the thread is not bound.
+	 */
+	static void bind_local_memory(void const* addr, size_t size);
+
 	template <typename T>
 	bool is_partially_numa_local(T const* addr, size_t count) {
 		return topo->is_partially_numa_local(node, addr, count);
@@ -194,11 +207,20 @@ private:
 	bool root;
 
 	hwloc_cpuset_t prev_binding;
+
+	static THREAD_LOCAL HWLocSMTTopologyInfo<Pheet>* local_topo;
+	static THREAD_LOCAL hwloc_obj_t local_node;
 #ifdef PHEET_DEBUG_MODE
 	bool bound;
 #endif
 };
 
+template <class Pheet>
+THREAD_LOCAL HWLocSMTTopologyInfo<Pheet>* HWLocSMTMachineModel<Pheet>::local_topo = nullptr;
+
+template <class Pheet>
+THREAD_LOCAL hwloc_obj_t HWLocSMTMachineModel<Pheet>::local_node = nullptr;
+
 template <class Pheet>
 HWLocSMTMachineModel<Pheet>::HWLocSMTMachineModel()
 : topo(new HWLocSMTTopologyInfo<Pheet>()), node(topo->get_root_obj()), root(true), prev_binding(nullptr) {
@@ -282,6 +304,8 @@ void HWLocSMTMachineModel<Pheet>::bind() {
 #endif
 	prev_binding = topo->get_binding();
 	topo->bind(node->cpuset);
+	local_topo = topo;
+	local_node = node;
 }
 
 template <class Pheet>
@@ -291,6 +315,15 @@ void HWLocSMTMachineModel<Pheet>::unbind() {
 	bound = false;
 #endif
 	topo->bind(prev_binding);
+	local_topo = nullptr;
+	local_node = nullptr;
+}
+
+template <class Pheet>
+void HWLocSMTMachineModel<Pheet>::bind_local_memory(void const* addr, size_t size) {
+	if(local_topo != nullptr) {
+		local_topo->bind_memory(local_node, addr, size);
+	}
 }
 
 template <class Pheet>
@@ -335,7 +368,7 @@ procs_t HWLocSMTMachineModel<Pheet>::get_memory_level() {
 
 template <class Pheet>
 procs_t HWLocSMTMachineModel<Pheet>::get_numa_memory_level() {
-	return std::min(node->depth, topo->get_numa_depth());
+	return std::min<procs_t>(node->depth, topo->get_numa_depth());
 }
 
 }
@@ -20,11 +20,25 @@ bool const pc_all = true;
 bool const scheduler_count_tasks_at_level = pc_all | false;
 bool const scheduler_count_steal_calls_per_thread = pc_all | false;
 bool const scheduler_count_unsuccessful_steal_calls_per_thread = pc_all | false;
+bool const scheduler_count_steal_calls_per_level = pc_all | false;
+bool const scheduler_count_successful_steals_per_level = pc_all | false;
 bool const scheduler_count_spawns = pc_all | false;
 bool const scheduler_count_actual_spawns = pc_all | false;
 bool const scheduler_count_spawns_to_call = pc_all | false;
 bool const scheduler_count_calls = pc_all | false;
+bool const scheduler_count_reprioritizations = pc_all | false;
 bool const scheduler_count_finishes = pc_all | false;
+bool const scheduler_count_task_alloc_hits = pc_all | false;
+bool const scheduler_count_task_alloc_misses = pc_all | false;
+bool const scheduler_count_task_remote_frees = pc_all | false;
+
+// Per-place event trace, written to scheduler_trace_file on shutdown. Not part of pc_all, as it writes a file
+#ifndef PHEET_TRACE_EVENTS
+bool const scheduler_trace_events = false;
+#else
+bool const scheduler_trace_events = true;
+#endif
+char const* const scheduler_trace_file = "pheet_trace.json";
 
 bool const scheduler_measure_total_time = pc_all | false;
 bool const scheduler_measure_task_time = pc_all | false;
@@ -78,6 +92,7 @@ bool const task_storage_count_spied_global_tasks = pc_all | false;
 bool const task_storage_count_max_inspected_global_blocks = pc_all | false;
 bool const task_storage_count_merges = pc_all | false;
 bool const task_storage_count_allocated_items = pc_all | false;
+bool const task_storage_measure_memory = pc_all | false;
 
 bool const stealer_count_stream_tasks = pc_all | false;
 bool const stealer_count_stolen_tasks = pc_all | false;
@@ -0,0 +1,117 @@
+/*
+ * CombiningTreeCounter.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef COMBININGTREECOUNTER_H_
+#define COMBININGTREECOUNTER_H_
+
+#include "../../../settings.h"
+#include "../../../misc/align.h"
+
+#include <atomic>
+#include <iostream>
+#include <new>
+
+namespace pheet {
+
+/*
+ * Counter organized as a tree with Arity children per node and Leaves leaves. Places
+ * increment the leaf given by their place id modulo Leaves. Updates are combined on the
+ * way up: a leaf forwards Batch increments to its parent at once, and a node on level l
+ * forwards Batch * Arity^l at once. So each node is only written by Arity children, and
+ * the root sees one update per Batch * Arity^(depth - 1) increments.
+ *
+ * Unlike the classic software combining tree, no place ever waits for another one.
+ *
+ * get_sum adds the root and the parts of all other nodes not forwarded yet. It is only
+ * exact once all increments have completed.
+ */
+template <class Pheet, typename T, size_t Leaves, size_t Arity, size_t Batch>
+class CombiningTreeCounterImpl {
+public:
+	template <size_t NewBatch>
+	using WithBatch = CombiningTreeCounterImpl<Pheet, T, Leaves, Arity, NewBatch>;
+
+	CombiningTreeCounterImpl()
+	: nodes(num_nodes()) {
+		for(size_t i = 0; i < num_nodes(); ++i) {
+			new (nodes.ptr() + i) Node();
+		}
+	}
+	~CombiningTreeCounterImpl() {}
+
+	void incr() {
+		// Leaves are stored at the end of the array
+		size_t node = num_nodes() - Leaves + (Pheet::get_place_id() % Leaves);
+		T value = 1;
+		T threshold = Batch;
+		while(node != 0) {
+			T old = nodes.ptr()[node].value.fetch_add(value, std::memory_order_relaxed);
+			if((old / threshold) == ((old + value) / threshold)) {
+				return;
+			}
+			// Crossed a multiple of the threshold, forward it to the parent
+			value = threshold;
+			threshold *= Arity;
+			node = (node - 1) / Arity;
+		}
+		nodes.ptr()[0].value.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	T get_sum() {
+		T sum = nodes.ptr()[0].value.load(std::memory_order_relaxed);
+		size_t level_begin = 1;
+		size_t level_size = Arity;
+		T threshold = Batch;
+		for(size_t l = 1; l < depth(); ++l) {
+			threshold *= Arity;
+		}
+		// Levels from the top, leaves are the last level
+		while(level_begin < num_nodes()) {
+			for(size_t i = level_begin; i < level_begin + level_size; ++i) {
+				sum += nodes.ptr()[i].value.load(std::memory_order_relaxed) % threshold;
+			}
+			level_begin += level_size;
+			level_size *= Arity;
+			threshold /= Arity;
+		}
+		return sum;
+	}
+
+	static void print_name() {
+		std::cout << "CombiningTreeCounter<" << Leaves << ", " << Arity << ", " << Batch << ">";
+	}
+
+private:
+	/*
+	 * Number of levels below the root
+	 */
+	static constexpr size_t depth(size_t width = 1) {
+		return (width >= Leaves)?0:(1 + depth(width * Arity));
+	}
+
+	static constexpr size_t num_nodes(size_t width = 1) {
+		return (width >= Leaves)?width:(width + num_nodes(width * Arity));
+	}
+
+	struct Node {
+		Node() : value(0) {}
+
+		std::atomic<T> value;
+		char padding[64 - sizeof(std::atomic<T>)];
+	};
+
+	static_assert(Arity >= 2, "Tree needs an arity of at least 2");
+
+	aligned_data<Node, 64> nodes;
+};
+
+template <class Pheet, typename T>
+using CombiningTreeCounter = CombiningTreeCounterImpl<Pheet, T, 64, 4, 64>;
+
+} /* namespace pheet */
+#endif /* COMBININGTREECOUNTER_H_ */
@@ -0,0 +1,52 @@
+/*
+ * ShardedCounter.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SHARDEDCOUNTER_H_
+#define SHARDEDCOUNTER_H_
+
+#include "../../PerformanceCounter/PerPlace/PerPlaceCounterSlots.h"
+
+#include <iostream>
+
+namespace pheet {
+
+/*
+ * Counter with one cache-line padded shard per place. Increments of a place only touch
+ * its own shard (plain load and store, no atomic read-modify-write), increments from
+ * outside of a place go to a shared shard that is updated atomically (see
+ * PerPlaceCounterSlots). get_sum adds up all shards with relaxed loads, so it misses
+ * increments that are still in progress. It matches the number of increments once all
+ * of them have completed (e.g. after the finish region they were issued in).
+ */
+template <class Pheet, typename T>
+class ShardedCounter {
+public:
+	ShardedCounter() {}
+	~ShardedCounter() {}
+
+	void incr() {
+		shards.add(1);
+	}
+
+	void add(T value) {
+		shards.add(value);
+	}
+
+	T get_sum() {
+		return shards.get_sum();
+	}
+
+	static void print_name() {
+		std::cout << "ShardedCounter";
+	}
+private:
+	PerPlaceCounterSlots<Pheet, T> shards;
+};
+
+} /* namespace pheet */
+#endif /* SHARDEDCOUNTER_H_ */
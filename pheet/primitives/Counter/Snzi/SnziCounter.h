@@ -0,0 +1,154 @@
+/*
+ * SnziCounter.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SNZICOUNTER_H_
+#define SNZICOUNTER_H_
+
+#include "../../../settings.h"
+#include "../../../misc/align.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <new>
+
+namespace pheet {
+
+/*
+ * Counter optimized for "is it zero" queries, based on scalable nonzero indicators
+ * (Ellen, Lev, Luchangco and Moir, PODC 2007).
+ *
+ * Places increment and decrement a leaf (place id modulo Leaves). Only transitions of a
+ * leaf between zero and non-zero are propagated to the root, so is_zero reads a single
+ * word that is rarely written. A leaf in the middle of a transition is in a half state,
+ * which any place arriving at the leaf helps to complete.
+ *
+ * A decrement needs a matching increment that has completed before, but it may happen on
+ * a different place. If the leaf of the calling place is empty, the decrement is taken from
+ * another leaf.
+ *
+ * get_sum adds up the leaves and is only exact once all operations have completed.
+ */
+template <class Pheet, typename T, size_t Leaves>
+class SnziCounterImpl {
+public:
+	template <size_t NewLeaves>
+	using WithLeaves = SnziCounterImpl<Pheet, T, NewLeaves>;
+
+	SnziCounterImpl()
+	: leaves(Leaves), root(0) {
+		for(size_t i = 0; i < Leaves; ++i) {
+			new (leaves.ptr() + i) Leaf();
+		}
+	}
+	~SnziCounterImpl() {}
+
+	void incr() {
+		arrive(leaves.ptr()[Pheet::get_place_id() % Leaves].state);
+	}
+
+	void decr() {
+		size_t l = Pheet::get_place_id() % Leaves;
+		while(!depart(leaves.ptr()[l].state)) {
+			l = (l + 1) % Leaves;
+		}
+	}
+
+	bool is_zero() {
+		return root.load(std::memory_order_acquire) == 0;
+	}
+
+	T get_sum() {
+		T sum = T();
+		for(size_t i = 0; i < Leaves; ++i) {
+			sum += static_cast<T>(get_count(leaves.ptr()[i].state.load(std::memory_order_relaxed)) / 2);
+		}
+		return sum;
+	}
+
+	static void print_name() {
+		std::cout << "SnziCounter<" << Leaves << ">";
+	}
+
+private:
+	/*
+	 * Upper half: count in halves (1 = half state), lower half: version, which is
+	 * incremented on every transition from zero to prevent ABA
+	 */
+	static uint64_t make_state(uint64_t count, uint64_t version) {
+		return (count << 32) | (version & 0xFFFFFFFF);
+	}
+
+	static uint64_t get_count(uint64_t state) {
+		return state >> 32;
+	}
+
+	void arrive(std::atomic<uint64_t>& leaf) {
+		bool succ = false;
+		size_t undo = 0;
+		while(!succ) {
+			uint64_t x = leaf.load(std::memory_order_acquire);
+			if(get_count(x) >= 2) {
+				if(leaf.compare_exchange_weak(x, make_state(get_count(x) + 2, x), std::memory_order_acq_rel)) {
+					succ = true;
+				}
+			}
+			else if(get_count(x) == 0) {
+				uint64_t half = make_state(1, x + 1);
+				if(leaf.compare_exchange_weak(x, half, std::memory_order_acq_rel)) {
+					succ = true;
+					x = half;
+				}
+			}
+			if(get_count(x) == 1) {
+				// Help completing the transition, the root has to be non-zero before the leaf
+				root.fetch_add(1, std::memory_order_acq_rel);
+				if(!leaf.compare_exchange_strong(x, make_state(2, x), std::memory_order_acq_rel)) {
+					++undo;
+				}
+			}
+		}
+		while(undo > 0) {
+			root.fetch_sub(1, std::memory_order_acq_rel);
+			--undo;
+		}
+	}
+
+	/*
+	 * Returns false if there is nothing to take from this leaf
+	 */
+	bool depart(std::atomic<uint64_t>& leaf) {
+		uint64_t x = leaf.load(std::memory_order_acquire);
+		while(get_count(x) >= 2) {
+			if(leaf.compare_exchange_weak(x, make_state(get_count(x) - 2, x), std::memory_order_acq_rel)) {
+				if(get_count(x) == 2) {
+					root.fetch_sub(1, std::memory_order_acq_rel);
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+
+	struct Leaf {
+		Leaf() : state(0) {}
+
+		std::atomic<uint64_t> state;
+		char padding[64 - sizeof(std::atomic<uint64_t>)];
+	};
+
+	aligned_data<Leaf, 64> leaves;
+	char padding[64];
+	std::atomic<size_t> root;
+};
+
+template <class Pheet, typename T>
+using SnziCounter = SnziCounterImpl<Pheet, T, 64>;
+
+} /* namespace pheet */
+#endif /* SNZICOUNTER_H_ */
@@ -0,0 +1,171 @@
+/*
+ * FutexParking.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef FUTEXPARKING_H_
+#define FUTEXPARKING_H_
+
+#include "../../../settings.h"
+#include "../../../misc/types.h"
+
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <limits>
+#include <iostream>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+namespace pheet {
+
+/*
+ * Eventcount on top of a futex word. Idle places first spin (return to the caller,
+ * which retries its steal attempts), then yield, and finally park on the futex until
+ * some place calls notify() or the park timeout expires. Waking only happens if
+ * someone is actually parked, so notify() is cheap (one fence and a load) otherwise.
+ *
+ * The timeout is a safety net for work that becomes available without a notification
+ * (e.g. a finish region completed by another place). It doubles on every park of a
+ * waiter, starting at MinParkMicros, up to the maximum given to the waiter.
+ */
+template <class Pheet, unsigned int SpinRounds, unsigned int YieldRounds, procs_t WakeCount, unsigned int MinParkMicros, unsigned int MaxParkMicros>
+class FutexParkingImpl {
+public:
+	typedef FutexParkingImpl<Pheet, SpinRounds, YieldRounds, WakeCount, MinParkMicros, MaxParkMicros> Self;
+
+	template <unsigned int NewSpin, unsigned int NewYield>
+	using WithRounds = FutexParkingImpl<Pheet, NewSpin, NewYield, WakeCount, MinParkMicros, MaxParkMicros>;
+	template <procs_t NewWakeCount>
+	using WithWakeCount = FutexParkingImpl<Pheet, SpinRounds, YieldRounds, NewWakeCount, MinParkMicros, MaxParkMicros>;
+
+	/*
+	 * Per-thread state of an idle phase. Create one per idle loop (like a Backoff object)
+	 * and call wait() after every unsuccessful attempt to find work.
+	 */
+	class Waiter {
+	public:
+		Waiter(Self& parking)
+		: parking(parking), round(0), park_time(MinParkMicros), max_park_time(MaxParkMicros) {}
+		Waiter(Self& parking, unsigned int max_park_time)
+		: parking(parking), round(0), park_time(std::min(MinParkMicros, max_park_time)), max_park_time(max_park_time) {}
+
+		/*
+		 * check() is called after registering as a sleeper. It has to return true if
+		 * work is available (or the idle loop has to be left for another reason), in
+		 * which case the place does not park.
+		 * Any state change that makes check() return true either needs to be followed
+		 * by a notify(), or the place relies on the timeout to notice it.
+		 */
+		template <class Check>
+		void wait(Check&& check) {
+			if(round < SpinRounds) {
+				++round;
+			}
+			else if(round < SpinRounds + YieldRounds) {
+				++round;
+				std::this_thread::yield();
+			}
+			else {
+				parking.park(check, park_time);
+				park_time = std::min(park_time << 1, max_park_time);
+			}
+		}
+
+		void reset() {
+			round = 0;
+			park_time = std::min(MinParkMicros, max_park_time);
+		}
+
+	private:
+		Self& parking;
+		unsigned int round;
+		unsigned int park_time;
+		unsigned int max_park_time;
+	};
+
+	FutexParkingImpl()
+	: epoch(0), sleepers(0) {}
+	~FutexParkingImpl() {}
+
+	/*
+	 * Wakes up to WakeCount parked places. To be called after making work available.
+	 */
+	void notify() {
+		notify(WakeCount);
+	}
+
+	/*
+	 * Like notify(), but without ordering the publication of work before the check for
+	 * sleepers. Cheap enough to be called on every spawn, but a place that is just about
+	 * to park may miss the notification and only wakes up after its timeout.
+	 */
+	void notify_unordered() {
+		if(sleepers.load(std::memory_order_relaxed) != 0) {
+			notify(WakeCount);
+		}
+	}
+
+	/*
+	 * Wakes all parked places (e.g. on shutdown)
+	 */
+	void notify_all() {
+		notify(std::numeric_limits<int>::max());
+	}
+
+	procs_t get_num_sleepers() {
+		return sleepers.load(std::memory_order_relaxed);
+	}
+
+	static void print_name() {
+		std::cout << "FutexParking";
+	}
+
+private:
+	void notify(int count) {
+		// Orders the publication of work before the sleeper check. Pairs with the
+		// fetch_add in park, so either we see the sleeper or the sleeper sees the work
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if(sleepers.load(std::memory_order_relaxed) == 0) {
+			return;
+		}
+		epoch.fetch_add(1, std::memory_order_seq_cst);
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+	}
+
+	template <class Check>
+	void park(Check& check, unsigned int micros) {
+		sleepers.fetch_add(1, std::memory_order_seq_cst);
+		uint32_t key = epoch.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if(!check()) {
+			struct timespec ts;
+			ts.tv_sec = micros / 1000000;
+			ts.tv_nsec = (micros % 1000000) * 1000;
+			// Returns immediately if epoch changed in the meantime
+			syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAIT_PRIVATE, key, &ts, nullptr, 0);
+		}
+		sleepers.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	std::atomic<uint32_t> epoch;
+	// Updated on every park, keep it away from whatever is placed next to us
+	char padding[64];
+	std::atomic<procs_t> sleepers;
+	char padding2[64];
+
+	static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex word needs to be a plain 32 bit integer");
+};
+
+template <class Pheet>
+using FutexParking = FutexParkingImpl<Pheet, 64, 16, 2, 50, 10000>;
+
+}
+
+#endif /* FUTEXPARKING_H_ */
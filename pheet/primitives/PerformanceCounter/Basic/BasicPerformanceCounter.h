@@ -11,9 +11,10 @@
 
 #include <stdio.h>
 #include <iostream>
+#include <memory>
 
 #include "../../../settings.h"
-#include "../../Reducer/Sum/SumReducer.h"
+#include "../PerPlace/PerPlaceCounterSlots.h"
 
 /*
  *
@@ -89,19 +90,21 @@ public:
 	void print(char const* formatting_string);
 	static void print_header(char const* const string);
 private:
-	SumReducer<Pheet, size_t> reducer;
+	// Shared by all copies of the counter
+	std::shared_ptr<PerPlaceCounterSlots<Pheet, size_t> > slots;
 };
 
 template <class Pheet>
 inline
-BasicPerformanceCounter<Pheet, true>::BasicPerformanceCounter() {
+BasicPerformanceCounter<Pheet, true>::BasicPerformanceCounter()
+: slots(std::make_shared<PerPlaceCounterSlots<Pheet, size_t> >()) {
 
 }
 
 template <class Pheet>
 inline
 BasicPerformanceCounter<Pheet, true>::BasicPerformanceCounter(BasicPerformanceCounter<Pheet, true>& other)
-: reducer(other.reducer) {
+: slots(other.slots) {
 
 }
 
@@ -114,19 +117,19 @@ BasicPerformanceCounter<Pheet, true>::~BasicPerformanceCounter() {
 template <class Pheet>
 inline
 void BasicPerformanceCounter<Pheet, true>::incr() {
-	reducer.incr();
+	slots->add(1);
 }
 
 template <class Pheet>
 inline
 void BasicPerformanceCounter<Pheet, true>::add(size_t value) {
-	reducer.add(value);
+	slots->add(value);
 }
 
 template <class Pheet>
 inline
 void BasicPerformanceCounter<Pheet, true>::print(char const* const formatting_string) {
-	printf(formatting_string, reducer.get_sum());
+	printf(formatting_string, slots->get_sum());
 }
 
 template <class Pheet>
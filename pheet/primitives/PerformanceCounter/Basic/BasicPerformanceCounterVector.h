@@ -31,20 +31,20 @@ public:
 
 	void incr(size_t i);
 	void print(size_t i, char const* const formatting_string);
-	void print_header(size_t i, char const* const string);
+	static void print_header(char const* const string);
 
 //	size_t get_length();
 };
 
 template <class Pheet>
 inline
-BasicPerformanceCounterVector<Pheet, false>::BasicPerformanceCounterVector(size_t length) {
+BasicPerformanceCounterVector<Pheet, false>::BasicPerformanceCounterVector(size_t) {
 
 }
 
 template <class Pheet>
 inline
-BasicPerformanceCounterVector<Pheet, false>::BasicPerformanceCounterVector(BasicPerformanceCounterVector<Pheet, false>& other) {
+BasicPerformanceCounterVector<Pheet, false>::BasicPerformanceCounterVector(BasicPerformanceCounterVector<Pheet, false>&) {
 
 }
 
@@ -56,19 +56,19 @@ BasicPerformanceCounterVector<Pheet, false>::~BasicPerformanceCounterVector() {
 
 template <class Pheet>
 inline
-void BasicPerformanceCounterVector<Pheet, false>::incr(size_t i) {
+void BasicPerformanceCounterVector<Pheet, false>::incr(size_t) {
 
 }
 
 template <class Pheet>
 inline
-void BasicPerformanceCounterVector<Pheet, false>::print(size_t i, char const* const formatting_string) {
+void BasicPerformanceCounterVector<Pheet, false>::print(size_t, char const* const) {
 
 }
 
 template <class Pheet>
 inline
-void BasicPerformanceCounterVector<Pheet, false>::print_header(size_t i, char const* const string) {
+void BasicPerformanceCounterVector<Pheet, false>::print_header(char const* const) {
 
 }
 /*
@@ -85,7 +85,7 @@ public:
 
 	void incr(size_t i);
 	void print(size_t i, char const* const formatting_string);
-	void print_header(char const* const string);
+	static void print_header(char const* const string);
 
 //	size_t get_length();
 private:
@@ -0,0 +1,186 @@
+/*
+ * EventTrace.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef EVENTTRACE_H_
+#define EVENTTRACE_H_
+
+#include "../../../settings.h"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <stdint.h>
+
+namespace pheet {
+
+enum class TraceEventType : uint32_t {
+	task_begin, task_end,
+	steal_attempt, steal_success,
+	finish_enter, finish_exit,
+	idle_begin, idle_end
+};
+
+struct TraceEvent {
+	uint64_t time;
+	TraceEventType type;
+	uint32_t arg;
+};
+
+template <class Pheet, size_t Capacity, bool enabled>
+class EventTraceImpl;
+
+/*
+ * Per-place event trace. Works like the other performance counters: the object passed to
+ * the environment is the root, and every place gets its own copy. Each copy owns a
+ * preallocated ring buffer that only the owning place writes to, so recording an event
+ * is a timestamp and a store. If a place records more than Capacity events, the oldest
+ * ones are overwritten.
+ *
+ * The buffers are registered (lock-free) with the root, so after all places have been
+ * joined, any copy can dump all of them in the Chrome trace event format
+ * (chrome://tracing, Perfetto).
+ */
+template <class Pheet, size_t Capacity, bool enabled>
+class EventTraceImpl {
+public:
+	typedef EventTraceImpl<Pheet, Capacity, enabled> Self;
+	typedef std::chrono::steady_clock Clock;
+
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity needs to be a power of two");
+
+	EventTraceImpl()
+	: registry(new Registry()), buffer(nullptr), owns_registry(true) {}
+
+	EventTraceImpl(Self& other)
+	: registry(other.registry), buffer(new Buffer()), owns_registry(false) {
+		Buffer* head = registry->head.load(std::memory_order_relaxed);
+		do {
+			buffer->next = head;
+		} while(!registry->head.compare_exchange_weak(head, buffer, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	~EventTraceImpl() {
+		// Buffers are owned by the registry, as they have to survive the places
+		if(owns_registry) {
+			delete registry;
+		}
+	}
+
+	void set_place_id(procs_t id) {
+		if(buffer != nullptr) {
+			buffer->place_id = id;
+		}
+	}
+
+	void add(TraceEventType type, uint32_t arg = 0) {
+		if(buffer != nullptr) {
+			TraceEvent& e = buffer->events[buffer->count & (Capacity - 1)];
+			e.time = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+			e.type = type;
+			e.arg = arg;
+			++buffer->count;
+		}
+	}
+
+	/*
+	 * Writes all registered buffers to the given file and releases them.
+	 * No place may record events during or after the dump.
+	 */
+	void dump(char const* file_name) {
+		std::ofstream out(file_name);
+		if(!out) {
+			std::cerr << "Unable to open trace file " << file_name << std::endl;
+			return;
+		}
+		uint64_t start = std::chrono::duration_cast<std::chrono::nanoseconds>(registry->start.time_since_epoch()).count();
+
+		out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		bool first = true;
+		Buffer* b = registry->head.exchange(nullptr, std::memory_order_acquire);
+		while(b != nullptr) {
+			size_t begin = (b->count > Capacity)?(b->count - Capacity):0;
+			for(size_t i = begin; i < b->count; ++i) {
+				TraceEvent const& e = b->events[i & (Capacity - 1)];
+				out << (first?"\n":",\n");
+				first = false;
+				write_event(out, e, b->place_id, start);
+			}
+			Buffer* next = b->next;
+			delete b;
+			b = next;
+		}
+		out << "\n]}\n";
+		buffer = nullptr;
+	}
+
+private:
+	struct Buffer {
+		Buffer() : count(0), place_id(0), next(nullptr) {}
+
+		TraceEvent events[Capacity];
+		size_t count;
+		procs_t place_id;
+		Buffer* next;
+	};
+
+	struct Registry {
+		Registry() : start(Clock::now()), head(nullptr) {}
+		~Registry() {
+			Buffer* b = head.load(std::memory_order_relaxed);
+			while(b != nullptr) {
+				Buffer* next = b->next;
+				delete b;
+				b = next;
+			}
+		}
+
+		Clock::time_point start;
+		std::atomic<Buffer*> head;
+	};
+
+	static void write_event(std::ostream& out, TraceEvent const& e, procs_t place_id, uint64_t start) {
+		static char const* const names[] = {"task", "task", "steal_attempt", "steal", "finish", "finish", "idle", "idle"};
+		static char const* const phases[] = {"B", "E", "i", "i", "B", "E", "B", "E"};
+		size_t t = static_cast<size_t>(e.type);
+
+		// Events recorded before the registry was created (e.g. when reusing counters) are clamped
+		uint64_t ns = (e.time > start)?(e.time - start):0;
+		out << "{\"name\":\"" << names[t] << "\",\"ph\":\"" << phases[t] << "\",\"ts\":" << (ns / 1000) << "." << (ns % 1000 / 100) << (ns % 100 / 10) << (ns % 10)
+			<< ",\"pid\":0,\"tid\":" << place_id;
+		if(e.type == TraceEventType::steal_attempt || e.type == TraceEventType::steal_success) {
+			out << ",\"s\":\"t\",\"args\":{\"victim\":" << e.arg << "}";
+		}
+		out << "}";
+	}
+
+	Registry* registry;
+	Buffer* buffer;
+	bool owns_registry;
+};
+
+template <class Pheet, size_t Capacity>
+class EventTraceImpl<Pheet, Capacity, false> {
+public:
+	typedef EventTraceImpl<Pheet, Capacity, false> Self;
+
+	EventTraceImpl() {}
+	EventTraceImpl(Self&) {}
+	~EventTraceImpl() {}
+
+	void set_place_id(procs_t) {}
+	void add(TraceEventType, uint32_t = 0) {}
+	void dump(char const*) {}
+};
+
+template <class Pheet, bool enabled>
+using EventTrace = EventTraceImpl<Pheet, 65536, enabled>;
+
+}
+
+#endif /* EVENTTRACE_H_ */
@@ -50,7 +50,7 @@ public:
 		: start(std::chrono::high_resolution_clock::now()) {}
 
 	inline EventsList(EventsList<Pheet, E, true> const& other)
-		: events(other.events) {}
+		: events(other.events), start(other.start) {}
 
 	void add(E const& value)
 	{
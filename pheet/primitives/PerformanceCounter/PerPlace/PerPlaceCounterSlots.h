@@ -0,0 +1,118 @@
+/*
+ * PerPlaceCounterSlots.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PERPLACECOUNTERSLOTS_H_
+#define PERPLACECOUNTERSLOTS_H_
+
+#include "../../../settings.h"
+#include "../../../misc/align.h"
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+namespace pheet {
+
+/*
+ * Backend for performance counters. Holds one cache-line sized slot per place, indexed by
+ * the place id. Each place only writes to its own slot (plain load and store, no atomic
+ * read-modify-write), values are aggregated when the counter is read.
+ *
+ * Slots are allocated lazily in chunks of 64 places, so the number of places does not need
+ * to be known when the counter is created (counters are usually created before the
+ * environment). Code running outside of a place (e.g. a place thread after it has left the
+ * scheduler) may run concurrently with other such code, so it uses a separate slot that is
+ * updated atomically.
+ */
+template <class Pheet, typename T>
+class PerPlaceCounterSlots {
+public:
+	typedef PerPlaceCounterSlots<Pheet, T> Self;
+
+	PerPlaceCounterSlots() {
+		for(size_t i = 0; i < num_chunks; ++i) {
+			chunks[i].store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	~PerPlaceCounterSlots() {
+		for(size_t i = 0; i < num_chunks; ++i) {
+			delete chunks[i].load(std::memory_order_relaxed);
+		}
+	}
+
+	void add(T value) {
+		if(Pheet::get_place() == nullptr) {
+			T old = off_place.value.load(std::memory_order_relaxed);
+			while(!off_place.value.compare_exchange_weak(old, old + value, std::memory_order_relaxed)) {}
+			return;
+		}
+		std::atomic<T>& s = get_slot(Pheet::get_place_id());
+		s.store(s.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	T get_sum() {
+		T sum = off_place.value.load(std::memory_order_relaxed);
+		for(size_t i = 0; i < num_chunks; ++i) {
+			Chunk* c = chunks[i].load(std::memory_order_acquire);
+			if(c != nullptr) {
+				for(size_t j = 0; j < chunk_size; ++j) {
+					sum += c->slots.ptr()[j].value.load(std::memory_order_relaxed);
+				}
+			}
+		}
+		return sum;
+	}
+
+private:
+	static size_t const chunk_size = 64;
+	static size_t const num_chunks = 64;
+
+	struct Slot {
+		Slot() : value(T()) {}
+
+		std::atomic<T> value;
+		char padding[64 - sizeof(std::atomic<T>)];
+	};
+
+	struct Chunk {
+		Chunk()
+		: slots(chunk_size) {
+			for(size_t i = 0; i < chunk_size; ++i) {
+				new (slots.ptr() + i) Slot();
+			}
+		}
+
+		aligned_data<Slot, 64> slots;
+	};
+
+	std::atomic<T>& get_slot(procs_t place_id) {
+		pheet_assert(place_id < chunk_size * num_chunks);
+		std::atomic<Chunk*>& chunk = chunks[place_id / chunk_size];
+		Chunk* c = chunk.load(std::memory_order_acquire);
+		if(c == nullptr) {
+			Chunk* nc = new Chunk();
+			if(chunk.compare_exchange_strong(c, nc, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				c = nc;
+			}
+			else {
+				// Some other place was faster
+				delete nc;
+			}
+		}
+		return c->slots.ptr()[place_id % chunk_size].value;
+	}
+
+	std::atomic<Chunk*> chunks[num_chunks];
+	// Used by code running outside of a place
+	Slot off_place;
+};
+
+}
+
+#endif /* PERPLACECOUNTERSLOTS_H_ */
@@ -11,10 +11,11 @@
 
 #include <stdio.h>
 #include <iostream>
-#include <chrono>
+#include <memory>
 
 #include "../../../settings.h"
-#include "../../Reducer/Sum/SumReducer.h"
+#include "../../../misc/tsc_clock.h"
+#include "../PerPlace/PerPlaceCounterSlots.h"
 
 /*
  *
@@ -90,8 +91,9 @@ public:
 	void print(char const* formatting_string);
 	static void print_header(char const* const string);
 private:
-	SumReducer<Pheet, double> reducer;
-	std::chrono::high_resolution_clock::time_point start_time;
+	// Shared by all copies of the counter. Accumulates TSC ticks, converted to seconds on print
+	std::shared_ptr<PerPlaceCounterSlots<Pheet, TSCClock::Ticks> > slots;
+	TSCClock::Ticks start_time;
 #ifdef PHEET_DEBUG_MODE
 	bool is_active;
 #endif
@@ -100,8 +102,9 @@ private:
 template <class Pheet>
 inline
 TimePerformanceCounter<Pheet, true>::TimePerformanceCounter()
+: slots(std::make_shared<PerPlaceCounterSlots<Pheet, TSCClock::Ticks> >()), start_time(0)
 #ifdef PHEET_DEBUG_MODE
-: is_active(false)
+  , is_active(false)
 #endif
 {
 
@@ -110,7 +113,7 @@ TimePerformanceCounter<Pheet, true>::TimePerformanceCounter()
 template <class Pheet>
 inline
 TimePerformanceCounter<Pheet, true>::TimePerformanceCounter(TimePerformanceCounter<Pheet, true>& other)
-: reducer(other.reducer)
+: slots(other.slots), start_time(0)
 #ifdef PHEET_DEBUG_MODE
   , is_active(false)
 #endif
@@ -131,15 +134,13 @@ void TimePerformanceCounter<Pheet, true>::start_timer() {
 	pheet_assert(!is_active);
 	is_active = true;
 #endif
-	start_time = std::chrono::high_resolution_clock::now();
+	start_time = TSCClock::now();
 }
 
 template <class Pheet>
 inline
 void TimePerformanceCounter<Pheet, true>::stop_timer() {
-	auto stop_time = std::chrono::high_resolution_clock::now();
-	double time = 1.0e-6 * std::chrono::duration_cast<std::chrono::microseconds>(stop_time - start_time).count();
-	reducer.add(time);
+	slots->add(TSCClock::now() - start_time);
 #ifdef PHEET_DEBUG_MODE
 	pheet_assert(is_active);
 	is_active = false;
@@ -152,7 +153,7 @@ void TimePerformanceCounter<Pheet, true>::print(char const* const formatting_str
 #ifdef PHEET_DEBUG_MODE
 	pheet_assert(!is_active);
 #endif
-	printf(formatting_string, reducer.get_sum());
+	printf(formatting_string, TSCClock::to_seconds(slots->get_sum()));
 }
 
 template <class Pheet>
@@ -21,6 +21,7 @@
 #include "../../models/MachineModel/BinaryTree/BinaryTreeMachineModel.h"
 #include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
 
 #include <pheet/ds/FinishStack/MM/MMFinishStack.h>
 
@@ -32,6 +33,7 @@ struct BStrategySchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 	typename Pheet::Scheduler::Task* startup_task;
 };
 
@@ -52,6 +54,8 @@ public:
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 	using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+	using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef BStrategySchedulerTaskStorageItem<Pheet, Task, typename FinishStack<Pheet>::Element> TaskStorageItem;
 	typedef TaskStorageT<Pheet, TaskStorageItem> TaskStorage;
 	typedef BStrategySchedulerPlace<Pheet, FinishStack, 4> Place;
@@ -71,6 +75,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
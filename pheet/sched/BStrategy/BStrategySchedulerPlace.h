@@ -58,10 +58,12 @@ public:
 	typedef BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold> Self;
 	typedef Self Place;
 	typedef BStrategySchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinishStackT<Pheet> FinishStack;
 	typedef typename FinishStack::Element StackElement;
 	typedef typename Pheet::Scheduler::TaskStorageItem TaskStorageItem;
@@ -119,6 +121,8 @@ public:
 	void start_finish_region();
 	void end_finish_region();
 
+	bool execute_local_task();
+
 	ptrdiff_t next_task_id() { return task_id++; }
 
 	TaskStorage& get_task_storage() { return task_storage; }
@@ -240,6 +244,7 @@ BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::~BStrategyScheduler
 
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		// Cleans out any remaining references to tasks
 		task_storage.clean_up();
@@ -409,7 +414,7 @@ void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::execute_task(T
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
 void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::main_loop() {
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 1000);
 	while(true) {
 		TaskStorageItem di = task_storage.pop();
 		while(di.task != NULL) {
@@ -421,7 +426,7 @@ void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::main_loop() {
 			delete di.task;
 			di = task_storage.pop();
 
-			bo.reset();
+			waiter.reset();
 		}
 
 		if(scheduler_state->current_state >= 2) {
@@ -431,13 +436,13 @@ void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::main_loop() {
 //			performance_counters.idle_time.stop_timer();
 			return;
 		}
-		bo.backoff();
+		waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 	}
 }
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
 void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::wait_for_finish(StackElement* parent) {
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 100);
 	while(true) {
 		TaskStorageItem di = task_storage.pop();
 		while(di.task != NULL) {
@@ -456,8 +461,27 @@ void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::wait_for_finis
 		if(finish_stack.unique(parent)) {
 			return;
 		}
-		bo.backoff();
+		waiter.wait([this, parent]() { return finish_stack.unique(parent); });
+	}
+}
+
+/*
+ * Executes one task from the queue of this place inside the currently running task
+ */
+template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
+bool BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::execute_local_task() {
+	TaskStorageItem di = task_storage.pop();
+	if(di.task == NULL) {
+		return false;
 	}
+	performance_counters.task_time.stop_timer();
+	// The nested task overwrites the parent of the running task
+	StackElement* parent = current_task_parent;
+	execute_task(di.task, di.stack_element);
+	delete di.task;
+	current_task_parent = parent;
+	performance_counters.task_time.start_timer();
+	return true;
 }
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
@@ -599,6 +623,7 @@ inline void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spawn_s
 			di.task = task;
 			di.stack_element = current_task_parent;
 			task_storage.push(std::forward<Strategy&&>(s), di);
+			scheduler_state->parking.notify_unordered();
 		}
 		else {
 			performance_counters.num_spawns_to_call.incr();
@@ -624,15 +649,15 @@ inline void BStrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spawn_s
 			pheet_assert(s.get_transitive_weight() > 0);
 
 			performance_counters.num_actual_spawns.incr();
-			auto bound = std::bind(f, params ...);
-
-			FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+			typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+			TaskType* task = new TaskType(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 			pheet_assert(current_task_parent != NULL);
 			finish_stack.spawn(current_task_parent);
 			TaskStorageItem di;
 			di.task = task;
 			di.stack_element = current_task_parent;
 			task_storage.push(std::forward<Strategy&&>(s), di);
+			scheduler_state->parking.notify_unordered();
 		}
 		else {
 			performance_counters.num_spawns_to_call.incr();
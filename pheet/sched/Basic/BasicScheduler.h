@@ -11,8 +11,13 @@
 
 #include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
 #include "../common/FinishRegion.h"
 #include "BasicSchedulerPlace.h"
+#include "VictimSelector/UniformVictimSelector.h"
+#include "VictimSelector/LastVictimSelector.h"
+#include "VictimSelector/NumaWeightedVictimSelector.h"
+#include "VictimSelector/RoundRobinVictimSelector.h"
 #include "../common/CPUThreadExecutor.h"
 #include "../common/DummyBaseStrategy.h"
 #include "../../models/MachineModel/BinaryTree/BinaryTreeMachineModel.h"
@@ -31,6 +36,7 @@ struct BasicSchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 //	typename Pheet::Scheduler::Task *startup_task;
 };
 
@@ -43,17 +49,19 @@ BasicSchedulerState<Pheet>::BasicSchedulerState()
 /*
  * May only be used once
  */
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 class BasicSchedulerImpl {
 public:
 	typedef typename Pheet::Backoff Backoff;
 	typedef typename Pheet::MachineModel MachineModel;
 	typedef BinaryTreeMachineModel<Pheet, MachineModel> InternalMachineModel;
-	typedef BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold> Self;
+	typedef BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold> Self;
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 		using FunctorTask = SchedulerFunctorTask<Pheet, F>;
-	typedef BasicSchedulerPlace<Pheet, StealingDeque, FinishStack, CallThreshold> Place;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
+	typedef BasicSchedulerPlace<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold> Place;
 	typedef BasicSchedulerState<Pheet> State;
 	typedef FinishRegion<Pheet> Finish;
 	typedef typename Place::PerformanceCounters PerformanceCounters;
@@ -61,18 +69,20 @@ public:
 	typedef DummyBaseStrategy<Pheet> BaseStrategy;
 
 	template <class NP>
-	using BT = BasicSchedulerImpl<NP, StealingDeque, FinishStack, CallThreshold>;
+	using BT = BasicSchedulerImpl<NP, StealingDeque, FinishStack, VictimSelector, CallThreshold>;
 
 	template<uint8_t NewVal>
-		using WithCallThreshold = BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, NewVal>;
+		using WithCallThreshold = BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, NewVal>;
 	template <template <class, typename> class NewTS>
-		using WithTaskStorage = BasicSchedulerImpl<Pheet, NewTS, FinishStack, CallThreshold>;
+		using WithTaskStorage = BasicSchedulerImpl<Pheet, NewTS, FinishStack, VictimSelector, CallThreshold>;
 	template <template <class, typename, typename> class NewTS>
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
 	template <template <class> class NewFS>
-		using WithFinishStack = BasicSchedulerImpl<Pheet, StealingDeque, NewFS, CallThreshold>;
+		using WithFinishStack = BasicSchedulerImpl<Pheet, StealingDeque, NewFS, VictimSelector, CallThreshold>;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, NewVS, CallThreshold>;
 
 	/*
 	 * Uses complete machine
@@ -90,9 +100,13 @@ public:
 
 	static void print_name();
 
+	static Self* get() {
+		return singleton;
+	}
 	static Place* get_place();
 	static procs_t get_place_id();
 	Place* get_place_at(procs_t place_id);
+	procs_t get_num_places() { return num_places; }
 
 	template<class CallTaskType, typename ... TaskParams>
 	static void finish(TaskParams&& ... params);
@@ -129,134 +143,151 @@ private:
 	State state;
 
 	PerformanceCounters performance_counters;
+
+	static Self* singleton;
 };
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-char const BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::name[] = "BasicScheduler";
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+char const BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::name[] = "BasicScheduler";
+
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+procs_t const BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::max_cpus = std::numeric_limits<procs_t>::max() >> 1;
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-procs_t const BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::max_cpus = std::numeric_limits<procs_t>::max() >> 1;
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>* BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::singleton = nullptr;
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::BasicSchedulerImpl()
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::BasicSchedulerImpl()
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
 	places[0]->prepare_root();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::BasicSchedulerImpl(typename Place::PerformanceCounters& performance_counters)
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::BasicSchedulerImpl(typename Place::PerformanceCounters& performance_counters)
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
 	places[0]->prepare_root();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::BasicSchedulerImpl(procs_t num_places)
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::BasicSchedulerImpl(procs_t num_places)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
 	places[0]->prepare_root();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::BasicSchedulerImpl(procs_t num_places, typename Place::PerformanceCounters& performance_counters)
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::BasicSchedulerImpl(procs_t num_places, typename Place::PerformanceCounters& performance_counters)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
 	places[0]->prepare_root();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::~BasicSchedulerImpl() {
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::~BasicSchedulerImpl() {
 	delete places[0];
 	delete[] places;
+
+	singleton = nullptr;
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::print_name() {
-	std::cout << name;
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::print_name() {
+	std::cout << name << "<";
+	Place::VictimSelector::print_name();
+	std::cout << ">";
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-typename BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::Place*
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::get_place() {
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+typename BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::Place*
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::get_place() {
 	return Place::get();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-procs_t BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::get_place_id() {
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+procs_t BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::get_place_id() {
 	return Place::get()->get_id();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
-typename BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::Place*
-BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::get_place_at(procs_t place_id) {
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
+typename BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::Place*
+BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::get_place_at(procs_t place_id) {
 	pheet_assert(place_id < num_places);
 	return places[place_id];
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<class CallTaskType, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::finish(TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::finish(TaskParams&& ... params) {
 	Place* p = get_place();
 	pheet_assert(p != NULL);
 	p->template finish<CallTaskType>(std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<typename F, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::finish(F&& f, TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::finish(F&& f, TaskParams&& ... params) {
 	Place* p = get_place();
 	pheet_assert(p != NULL);
 	p->finish(f, std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<class CallTaskType, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::spawn(TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::spawn(TaskParams&& ... params) {
 	Place* p = get_place();
 	pheet_assert(p != NULL);
 	p->template spawn<CallTaskType>(std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<typename F, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::spawn(F&& f, TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::spawn(F&& f, TaskParams&& ... params) {
 	Place* p = get_place();
 	pheet_assert(p != NULL);
 	p->spawn(f, std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<class CallTaskType, class Strategy, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::spawn_prio(Strategy, TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::spawn_prio(Strategy, TaskParams&& ... params) {
 	spawn<CallTaskType>(std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<class Strategy, typename F, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::spawn_prio(Strategy, F&& f, TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::spawn_prio(Strategy, F&& f, TaskParams&& ... params) {
 	spawn(f, std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<class CallTaskType, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::call(TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::call(TaskParams&& ... params) {
 	Place* p = get_place();
 	pheet_assert(p != NULL);
 	p->template call<CallTaskType>(std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDeque, template <class> class FinishStack, template <class P, class Pl> class VictimSelector, uint8_t CallThreshold>
 template<typename F, typename ... TaskParams>
-void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, CallThreshold>::call(F&& f, TaskParams&& ... params) {
+void BasicSchedulerImpl<Pheet, StealingDeque, FinishStack, VictimSelector, CallThreshold>::call(F&& f, TaskParams&& ... params) {
 	Place* p = get_place();
 	pheet_assert(p != NULL);
 	p->call(f, std::forward<TaskParams&&>(params) ...);
@@ -266,7 +297,7 @@ template<class Pheet, typename T>
 using BasicSchedulerDefaultStealingDeque = typename Pheet::CDS::template StealingDeque<T>;
 
 template<class Pheet>
-using BasicScheduler = BasicSchedulerImpl<Pheet, BasicSchedulerDefaultStealingDeque, MMFinishStack, 3>;
+using BasicScheduler = BasicSchedulerImpl<Pheet, BasicSchedulerDefaultStealingDeque, MMFinishStack, UniformVictimSelector, 3>;
 
 }
 
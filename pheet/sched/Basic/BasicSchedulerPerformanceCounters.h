@@ -11,9 +11,14 @@
 #include "../../settings.h"
 
 #include "../../primitives/PerformanceCounter/Basic/BasicPerformanceCounter.h"
+#include "../../primitives/PerformanceCounter/Basic/BasicPerformanceCounterVector.h"
 #include "../../primitives/PerformanceCounter/Max/MaxPerformanceCounter.h"
 #include "../../primitives/PerformanceCounter/Min/MinPerformanceCounter.h"
 #include "../../primitives/PerformanceCounter/Time/TimePerformanceCounter.h"
+#include "../../primitives/PerformanceCounter/Events/EventTrace.h"
+#include "../../memory/TaskPool/TaskPoolPerformanceCounters.h"
+
+#include <string>
 
 namespace pheet {
 
@@ -22,7 +27,12 @@ class BasicSchedulerPerformanceCounters {
 public:
 	typedef BasicSchedulerPerformanceCounters<Pheet, StealingDequePerformanceCounters, FinishStackPerformanceCounters> Self;
 
-	BasicSchedulerPerformanceCounters() {}
+	// Steals at deeper levels are counted in the last column
+	static procs_t const max_steal_levels = 12;
+
+	BasicSchedulerPerformanceCounters()
+		: num_steal_calls_at_level(max_steal_levels),
+		  num_successful_steals_at_level(max_steal_levels) {}
 	BasicSchedulerPerformanceCounters(Self& other)
 		: num_spawns(other.num_spawns), num_actual_spawns(other.num_actual_spawns),
 		  num_spawns_to_call(other.num_spawns_to_call),
@@ -33,13 +43,17 @@ public:
 //		  num_non_blocking_finish_regions(other.num_non_blocking_finish_regions),
 		  num_steals(other.num_steals), num_steal_calls(other.num_steal_calls),
 		  num_unsuccessful_steal_calls(other.num_unsuccessful_steal_calls),
+		  num_steal_calls_at_level(other.num_steal_calls_at_level),
+		  num_successful_steals_at_level(other.num_successful_steals_at_level),
 		  num_stealing_deque_pop_cas(other.num_stealing_deque_pop_cas),
 		  num_dequeued_tasks(other.num_dequeued_tasks),
 		  num_steal_executed_tasks(other.num_steal_executed_tasks),
 		  total_time(other.total_time), task_time(other.task_time),
 		  idle_time(other.idle_time),
+		  trace(other.trace),
 //		  finish_stack_nonblocking_max(other.finish_stack_nonblocking_max),
 //		  finish_stack_blocking_min(other.finish_stack_blocking_min),
+		  task_pool_performance_counters(other.task_pool_performance_counters),
 		  stealing_deque_performance_counters(other.stealing_deque_performance_counters),
 		  finish_stack_performance_counters(other.finish_stack_performance_counters) {}
 
@@ -60,6 +74,9 @@ public:
 	BasicPerformanceCounter<Pheet, task_storage_count_steals> num_steals;
 	BasicPerformanceCounter<Pheet, task_storage_count_steal_calls> num_steal_calls;
 	BasicPerformanceCounter<Pheet, task_storage_count_unsuccessful_steal_calls> num_unsuccessful_steal_calls;
+	// Indexed by the level of the victim (1 is the most distant level)
+	BasicPerformanceCounterVector<Pheet, scheduler_count_steal_calls_per_level> num_steal_calls_at_level;
+	BasicPerformanceCounterVector<Pheet, scheduler_count_successful_steals_per_level> num_successful_steals_at_level;
 	BasicPerformanceCounter<Pheet, task_storage_count_pop_cas> num_stealing_deque_pop_cas;
 
 	BasicPerformanceCounter<Pheet, task_storage_count_dequeued_tasks> num_dequeued_tasks;
@@ -69,9 +86,12 @@ public:
 	TimePerformanceCounter<Pheet, scheduler_measure_task_time> task_time;
 	TimePerformanceCounter<Pheet, scheduler_measure_idle_time> idle_time;
 
+	EventTrace<Pheet, scheduler_trace_events> trace;
+
 //	MaxPerformanceCounter<Pheet, size_t, scheduler_measure_finish_stack_nonblocking_max> finish_stack_nonblocking_max;
 //	MinPerformanceCounter<Pheet, size_t, scheduler_measure_finish_stack_blocking_min> finish_stack_blocking_min;
 
+	TaskPoolPerformanceCounters<Pheet> task_pool_performance_counters;
 	StealingDequePerformanceCounters stealing_deque_performance_counters;
 	FinishStackPerformanceCounters finish_stack_performance_counters;
 };
@@ -80,8 +100,8 @@ template <class Pheet, class StealingDequePerformanceCounters, class FinishStack
 inline void BasicSchedulerPerformanceCounters<Pheet, StealingDequePerformanceCounters, FinishStackPerformanceCounters>::print_headers() {
 	BasicPerformanceCounter<Pheet, scheduler_count_spawns>::print_header("spawns\t");
 	BasicPerformanceCounter<Pheet, scheduler_count_actual_spawns>::print_header("actual_spawns\t");
-	BasicPerformanceCounter<Pheet, scheduler_count_spawns_to_call>::print_header("calls\t");
-	BasicPerformanceCounter<Pheet, scheduler_count_calls>::print_header("spawns->call\t");
+	BasicPerformanceCounter<Pheet, scheduler_count_calls>::print_header("calls\t");
+	BasicPerformanceCounter<Pheet, scheduler_count_spawns_to_call>::print_header("spawns->call\t");
 	BasicPerformanceCounter<Pheet, scheduler_count_finishes>::print_header("finishes\t");
 //	BasicPerformanceCounter<Pheet, scheduler_count_completion_signals>::print_header("num_completion_signals\t");
 //	BasicPerformanceCounter<Pheet, scheduler_count_chained_completion_signals>::print_header("num_chained_completion_signals\t");
@@ -91,6 +111,11 @@ inline void BasicSchedulerPerformanceCounters<Pheet, StealingDequePerformanceCou
 	BasicPerformanceCounter<Pheet, task_storage_count_steals>::print_header("stolen\t");
 	BasicPerformanceCounter<Pheet, task_storage_count_steal_calls>::print_header("steal_calls\t");
 	BasicPerformanceCounter<Pheet, task_storage_count_unsuccessful_steal_calls>::print_header("unsuccessful_steal_calls\t");
+	for(procs_t i = 1; i < max_steal_levels; ++i) {
+		std::string suffix = std::to_string(i) + "\t";
+		BasicPerformanceCounterVector<Pheet, scheduler_count_steal_calls_per_level>::print_header(("steal_calls_l" + suffix).c_str());
+		BasicPerformanceCounterVector<Pheet, scheduler_count_successful_steals_per_level>::print_header(("successful_steals_l" + suffix).c_str());
+	}
 	BasicPerformanceCounter<Pheet, task_storage_count_pop_cas>::print_header("stealing_deque_pop_cas\t");
 
 	BasicPerformanceCounter<Pheet, task_storage_count_dequeued_tasks>::print_header("num_dequeued_tasks\t");
@@ -103,6 +128,7 @@ inline void BasicSchedulerPerformanceCounters<Pheet, StealingDequePerformanceCou
 //	MaxPerformanceCounter<Pheet, size_t, scheduler_measure_finish_stack_nonblocking_max>::print_header("finish_stack_nonblocking_max\t");
 //	MinPerformanceCounter<Pheet, size_t, scheduler_measure_finish_stack_blocking_min>::print_header("finish_stack_blocking_min\t");
 
+	TaskPoolPerformanceCounters<Pheet>::print_headers();
 	StealingDequePerformanceCounters::print_headers();
 	FinishStackPerformanceCounters::print_headers();
 }
@@ -121,6 +147,10 @@ inline void BasicSchedulerPerformanceCounters<Pheet, StealingDequePerformanceCou
 	num_steals.print("%lu\t");
 	num_steal_calls.print("%lu\t");
 	num_unsuccessful_steal_calls.print("%lu\t");
+	for(procs_t i = 1; i < max_steal_levels; ++i) {
+		num_steal_calls_at_level.print(i, "%lu\t");
+		num_successful_steals_at_level.print(i, "%lu\t");
+	}
 	num_stealing_deque_pop_cas.print("%lu\t");
 	num_dequeued_tasks.print("%lu\t");
 	num_steal_executed_tasks.print("%lu\t");
@@ -131,6 +161,7 @@ inline void BasicSchedulerPerformanceCounters<Pheet, StealingDequePerformanceCou
 //	finish_stack_nonblocking_max.print("%lu\t");
 //	finish_stack_blocking_min.print("%lu\t");
 
+	task_pool_performance_counters.print_values();
 	stealing_deque_performance_counters.print_values();
 	finish_stack_performance_counters.print_values();
 }
@@ -17,8 +17,11 @@
 #include "../../misc/bitops.h"
 #include "../../misc/type_traits.h"
 #include "BasicSchedulerPerformanceCounters.h"
+#include "../../memory/TaskPool/TaskPool.h"
 
 #include <functional>
+#include <algorithm>
+#include <atomic>
 
 namespace pheet {
 
@@ -70,20 +73,23 @@ public:
 template <class Pheet>
 BasicSchedulerPlaceDequeItem<Pheet> const nullable_traits<BasicSchedulerPlaceDequeItem<Pheet> >::null_value;
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 class BasicSchedulerPlace : public PlaceBase<Pheet> {
 public:
-	typedef BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold> Self;
+	typedef BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold> Self;
 	typedef Self Place;
 	typedef BasicSchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinishStackT<Pheet> FinishStack;
 	typedef typename FinishStack::Element StackElement;
 	typedef BasicSchedulerPlaceDequeItem<Pheet> DequeItem;
 	typedef StealingDequeT<Pheet, DequeItem> StealingDeque;
+	typedef VictimSelectorT<Pheet, Self> VictimSelector;
 	typedef BasicSchedulerPerformanceCounters<Pheet, typename StealingDeque::PerformanceCounters, typename FinishStack::PerformanceCounters> PerformanceCounters;
 	typedef typename Pheet::Scheduler::InternalMachineModel InternalMachineModel;
 
@@ -127,6 +133,8 @@ public:
 	void start_finish_region();
 	void end_finish_region();
 
+	bool execute_local_task();
+
 	ptrdiff_t next_task_id() { return task_id++; }
 
 
@@ -139,6 +147,9 @@ private:
 	void process_queue();
 	bool process_queue_until_finished(StackElement* parent);
 	void wait_for_finish(StackElement* parent);
+	bool work_available();
+	bool spawn_to_call();
+	void adapt_spawn_limit();
 
 	InternalMachineModel machine_model;
 	procs_t num_initialized_levels;
@@ -150,12 +161,23 @@ private:
 	typename Pheet::Scheduler::State* scheduler_state;
 
 	PerformanceCounters performance_counters;
+	TaskPool<Pheet> task_pool;
 
 	size_t preferred_queue_length;
 	size_t max_queue_length;
 	bool call_mode;
+	// Deque length above which spawns are executed as calls. Adapted to the steal pressure
+	size_t spawn_limit;
+	unsigned int spawns_until_adapt;
+	static unsigned int const spawn_adapt_interval = 64;
 	StealingDeque stealing_deque;
 	FinishStack finish_stack;
+	VictimSelector victim_selector;
+
+	// Set by thieves trying to steal from us, reset by the owner once the spawn limit is adapted
+	char padding[64];
+	std::atomic<bool> steal_pressure;
+	char padding2[64];
 
 	CPUThreadExecutor<Self> thread_executor;
 
@@ -167,21 +189,24 @@ private:
 		friend void execute_cpu_thread(T* param);
 };
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-THREAD_LOCAL BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>* BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::local_place = NULL;
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+THREAD_LOCAL BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>* BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::local_place = NULL;
 
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::BasicSchedulerPlace(InternalMachineModel model, Place** places, procs_t num_places, typename Pheet::Scheduler::State* scheduler_state, PerformanceCounters& perf_count)
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::BasicSchedulerPlace(InternalMachineModel model, Place** places, procs_t num_places, typename Pheet::Scheduler::State* scheduler_state, PerformanceCounters& perf_count)
 : machine_model(model),
   num_initialized_levels(1), num_levels(find_last_bit_set(num_places)), levels(new LevelDescription[num_levels]),
   current_task_parent(nullptr),
   scheduler_state(scheduler_state),
   performance_counters(perf_count),
+  task_pool(performance_counters.task_pool_performance_counters),
   preferred_queue_length(find_last_bit_set(num_places) << CallThreshold),
   max_queue_length(preferred_queue_length << 1),
-  call_mode(false), stealing_deque(max_queue_length, performance_counters.stealing_deque_performance_counters),
+  call_mode(false), spawn_limit(preferred_queue_length), spawns_until_adapt(spawn_adapt_interval),
+  stealing_deque(max_queue_length, performance_counters.stealing_deque_performance_counters),
   finish_stack(performance_counters.finish_stack_performance_counters),
+  steal_pressure(false),
   thread_executor(this),
   task_id(0){
 
@@ -200,18 +225,21 @@ BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::BasicSc
 	initialize_levels();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::BasicSchedulerPlace(LevelDescription* levels, procs_t num_initialized_levels, InternalMachineModel model, typename Pheet::Scheduler::State* scheduler_state, PerformanceCounters& perf_count)
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::BasicSchedulerPlace(LevelDescription* levels, procs_t num_initialized_levels, InternalMachineModel model, typename Pheet::Scheduler::State* scheduler_state, PerformanceCounters& perf_count)
 : machine_model(model),
   num_initialized_levels(num_initialized_levels), num_levels(num_initialized_levels + find_last_bit_set(levels[num_initialized_levels - 1].size >> 1)),
   levels(new LevelDescription[num_levels]),
   current_task_parent(nullptr),
   scheduler_state(scheduler_state),
   performance_counters(perf_count),
+  task_pool(performance_counters.task_pool_performance_counters),
   preferred_queue_length(find_last_bit_set(levels[0].size) << CallThreshold),
   max_queue_length(preferred_queue_length << 1),
-  call_mode(false), stealing_deque(max_queue_length, performance_counters.stealing_deque_performance_counters),
+  call_mode(false), spawn_limit(preferred_queue_length), spawns_until_adapt(spawn_adapt_interval),
+  stealing_deque(max_queue_length, performance_counters.stealing_deque_performance_counters),
   finish_stack(performance_counters.finish_stack_performance_counters),
+  steal_pressure(false),
   thread_executor(this) {
 
 	memcpy(this->levels, levels, sizeof(LevelDescription) * num_initialized_levels);
@@ -221,8 +249,8 @@ BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::BasicSc
 	thread_executor.run();
 }
 /*
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::BasicSchedulerPlace(std::vector<LevelDescription*> const* levels, std::vector<typename CPUHierarchy::CPUDescriptor*> const* cpus, typename Scheduler::State* scheduler_state, PerformanceCounters& perf_count)
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::BasicSchedulerPlace(std::vector<LevelDescription*> const* levels, std::vector<typename CPUHierarchy::CPUDescriptor*> const* cpus, typename Scheduler::State* scheduler_state, PerformanceCounters& perf_count)
 : performance_counters(perf_count), stack_filled_left(0), stack_filled_right(stack_size), stack_init_left(0), num_levels(levels->size()), thread_executor(cpus, this), scheduler_state(scheduler_state), preferred_queue_length(find_last_bit_set((*levels)[0]->total_size - 1) << 4), max_queue_length(preferred_queue_length << 1), call_mode(false), stealing_deque(max_queue_length, performance_counters.num_steals, performance_counters.num_stealing_deque_pop_cas) {
 	performance_counters.total_time.start_timer();
 
@@ -243,12 +271,13 @@ BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::BasicSc
 	thread_executor.run();
 }*/
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::~BasicSchedulerPlace() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::~BasicSchedulerPlace() {
 	if(get_id() == 0) {
 		end_finish_region();
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -262,16 +291,19 @@ BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::~BasicS
 
 		machine_model.unbind();
 		local_place = nullptr;
+
+		performance_counters.trace.dump(scheduler_trace_file);
 	}
 	delete[] levels;
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::prepare_root() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::prepare_root() {
 	scheduler_state->state_barrier.signal(0);
 
 	pheet_assert(local_place == NULL);
 	local_place = this;
+	performance_counters.trace.set_place_id(get_id());
 
 //	performance_counters.finish_stack_blocking_min.add_value(stack_size);
 //	performance_counters.finish_stack_nonblocking_max.add_value(0);
@@ -282,8 +314,8 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::pr
 	start_finish_region();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::initialize_levels() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::initialize_levels() {
 	procs_t base_offset;
 	procs_t size;
 
@@ -331,11 +363,12 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::in
 		levels[i].local_id = global_id - levels[i].global_id_offset;
 	}
 	num_levels = num_initialized_levels;
+	victim_selector.init(levels, num_levels);
 	machine_model.bind();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::grow_levels_structure() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::grow_levels_structure() {
 	if(num_initialized_levels == num_levels) {
 		// We have allocated to little levels
 		procs_t new_size = num_levels + find_last_bit_set(levels[num_levels - 1].size >> 1);
@@ -348,26 +381,27 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::gr
 	}
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::join() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::join() {
 	thread_executor.join();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>* BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::get() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>* BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::get() {
 	return local_place;
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 procs_t
-BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::get_id() {
+BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::get_id() {
 	return levels[0].local_id;
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::run() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::run() {
 	local_place = this;
 	initialize_levels();
+	performance_counters.trace.set_place_id(get_id());
 
 	// Releases all writes to this place to all other places. Will become visible after wait
 	scheduler_state->state_barrier.signal(0);
@@ -397,17 +431,19 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::ru
 	// Now we can safely finish execution
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::execute_task(Task* task, StackElement* parent) {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::execute_task(Task* task, StackElement* parent) {
 	parent = finish_stack.active_element(parent);
 
 	// Store parent (needed for spawns inside the task)
 	current_task_parent = parent;
 
 	// Execute task
+	performance_counters.trace.add(TraceEventType::task_begin);
 	performance_counters.task_time.start_timer();
 	(*task)();
 	performance_counters.task_time.stop_timer();
+	performance_counters.trace.add(TraceEventType::task_end);
 
 	// Check whether current_task_parent still is parent (if not, there is some error)
 	pheet_assert(current_task_parent == parent);
@@ -416,53 +452,65 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::ex
 	finish_stack.signal_completion(parent);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::main_loop() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::main_loop() {
 	while(true) {
 		// Make sure our queue is empty
 		process_queue();
 
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			typename Parking::Waiter waiter(scheduler_state->parking);
 			DequeItem di;
 			performance_counters.idle_time.start_timer();
+			performance_counters.trace.add(TraceEventType::idle_begin);
 			while(true) {
 				// Finalize elements in stack
-				// We do not steal from the last level as there are no partners
-				procs_t level = num_levels - 1;
-				while(level > 0) {
-					// For all except the last level we assume num_partners > 0
-					pheet_assert(levels[level].num_partners > 0);
-					std::uniform_int_distribution<procs_t> n_r_gen(0, levels[level].num_partners - 1);
-					procs_t next_rand = n_r_gen(this->get_rng());
-					pheet_assert(next_rand < levels[level].num_partners);
-					pheet_assert(levels[level].partners[next_rand] != this);
+				procs_t level;
+				Place* victim;
+				victim_selector.begin();
+				while((victim = victim_selector.next(this->get_rng(), level)) != nullptr) {
+					pheet_assert(level > 0 && level < num_levels);
+					pheet_assert(victim != this);
 
 					performance_counters.num_steal_calls.incr();
-					di = levels[level].partners[next_rand]->stealing_deque.steal_push(this->stealing_deque);
-				//	di = levels[level].partners[next_rand % levels[level].num_partners]->stealing_deque.steal();
+					performance_counters.num_steal_calls_at_level.incr(std::min(level, PerformanceCounters::max_steal_levels - 1));
+					if(!victim->steal_pressure.load(std::memory_order_relaxed)) {
+						victim->steal_pressure.store(true, std::memory_order_relaxed);
+					}
+					performance_counters.trace.add(TraceEventType::steal_attempt, victim->get_id());
+					di = victim->stealing_deque.steal_push(this->stealing_deque);
+				//	di = victim->stealing_deque.steal();
 
 					if(di.task != NULL) {
+						performance_counters.trace.add(TraceEventType::steal_success, victim->get_id());
+						victim_selector.stolen(level, victim);
+						performance_counters.num_successful_steals_at_level.incr(std::min(level, PerformanceCounters::max_steal_levels - 1));
 						performance_counters.num_steal_executed_tasks.incr();
 						performance_counters.idle_time.stop_timer();
+						performance_counters.trace.add(TraceEventType::idle_end);
+						if(!stealing_deque.is_empty()) {
+							// We stole more than we need, others may help
+							scheduler_state->parking.notify();
+						}
 
 						execute_task(di.task, di.stack_element);
-						delete di.task;
+						task_pool.destroy(di.task);
 						break;
 					}
 					else{
 						pheet_assert(stealing_deque.is_empty());
+						victim_selector.failed(level, victim);
 						performance_counters.num_unsuccessful_steal_calls.incr();
 					}
-					--level;
 				}
 				if(di.task == NULL) {
 					pheet_assert(stealing_deque.is_empty());
 					if(scheduler_state->current_state >= 2) {
 						performance_counters.idle_time.stop_timer();
+						performance_counters.trace.add(TraceEventType::idle_end);
 						return;
 					}
-					bo.backoff();
+					waiter.wait([this]() { return scheduler_state->current_state >= 2 || work_available(); });
 				}
 				else {
 					break;
@@ -472,8 +520,8 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::ma
 	}
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::wait_for_finish(StackElement* parent) {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::wait_for_finish(StackElement* parent) {
 	while(true) {
 		if(finish_stack.unique(parent)) {
 			return;
@@ -481,43 +529,56 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::wa
 
 		// Make sure our queue is empty
 		if(!process_queue_until_finished(parent))
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			// Completion of a finish region is not notified, so only park for a short time
+			typename Parking::Waiter waiter(scheduler_state->parking, 100);
 			DequeItem di;
+			performance_counters.trace.add(TraceEventType::idle_begin);
 			while(true) {
 				// Finalize elements in stack
-				// We do not steal from the last level as there are no partners
-				procs_t level = num_levels - 1;
-				while(level > 0) {
-					// For all except the last level we assume num_partners > 0
-					pheet_assert(levels[level].num_partners > 0);
-					std::uniform_int_distribution<procs_t> n_r_gen(0, levels[level].num_partners - 1);
-					procs_t next_rand = n_r_gen(this->get_rng());
-					pheet_assert(levels[level].partners[next_rand] != this);
+				procs_t level;
+				Place* victim;
+				victim_selector.begin();
+				while((victim = victim_selector.next(this->get_rng(), level)) != nullptr) {
+					pheet_assert(level > 0 && level < num_levels);
+					pheet_assert(victim != this);
 					performance_counters.num_steal_calls.incr();
-					di = levels[level].partners[next_rand]->stealing_deque.steal_push(this->stealing_deque);
-				//	di = levels[level].partners[next_rand % levels[level].num_partners]->stealing_deque.steal();
+					performance_counters.num_steal_calls_at_level.incr(std::min(level, PerformanceCounters::max_steal_levels - 1));
+					if(!victim->steal_pressure.load(std::memory_order_relaxed)) {
+						victim->steal_pressure.store(true, std::memory_order_relaxed);
+					}
+					performance_counters.trace.add(TraceEventType::steal_attempt, victim->get_id());
+					di = victim->stealing_deque.steal_push(this->stealing_deque);
+				//	di = victim->stealing_deque.steal();
 
 					if(di.task != NULL) {
+						performance_counters.trace.add(TraceEventType::steal_success, victim->get_id());
+						victim_selector.stolen(level, victim);
+						performance_counters.num_successful_steals_at_level.incr(std::min(level, PerformanceCounters::max_steal_levels - 1));
 						performance_counters.num_steal_executed_tasks.incr();
+						performance_counters.trace.add(TraceEventType::idle_end);
+						if(!stealing_deque.is_empty()) {
+							scheduler_state->parking.notify();
+						}
 
 						execute_task(di.task, di.stack_element);
-						delete di.task;
+						task_pool.destroy(di.task);
 						break;
 					}
 					else {
 						pheet_assert(stealing_deque.is_empty());
+						victim_selector.failed(level, victim);
 						performance_counters.num_unsuccessful_steal_calls.incr();
 					}
-					--level;
 				}
 				if(di.task == NULL) {
 					pheet_assert(stealing_deque.is_empty());
 
 					if(finish_stack.unique(parent)) {
+						performance_counters.trace.add(TraceEventType::idle_end);
 						return;
 					}
-					bo.backoff();
+					waiter.wait([this, parent]() { return finish_stack.unique(parent) || work_available(); });
 				}
 				else {
 					break;
@@ -527,8 +588,48 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::wa
 	}
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::process_queue() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::work_available() {
+	// Full scan, so no notification can be missed by a place that is about to park
+	for(procs_t i = 0; i < levels[0].size; ++i) {
+		if(!levels[0].partners[i]->stealing_deque.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * Lazy task creation: Once the deque holds more than spawn_limit tasks, spawns are
+ * executed as calls. The limit is halved whenever nobody tried to steal from us during
+ * the last spawn_adapt_interval spawns and doubled if someone did, so fine-grained
+ * recursive code gets close to a manual cutoff while thieves still find enough work.
+ * The hysteresis between call_mode and spawn mode avoids toggling on every spawn.
+ */
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+inline bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::spawn_to_call() {
+	if(--spawns_until_adapt == 0) {
+		adapt_spawn_limit();
+	}
+	size_t limit = call_mode?std::max(spawn_limit >> 1, (size_t)1):spawn_limit;
+	call_mode = stealing_deque.get_length() >= limit;
+	return call_mode;
+}
+
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::adapt_spawn_limit() {
+	spawns_until_adapt = spawn_adapt_interval;
+	if(steal_pressure.load(std::memory_order_relaxed)) {
+		steal_pressure.store(false, std::memory_order_relaxed);
+		spawn_limit = std::min(spawn_limit << 1, max_queue_length);
+	}
+	else {
+		spawn_limit = std::max(spawn_limit >> 1, (size_t)1);
+	}
+}
+
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::process_queue() {
 	DequeItem di = stealing_deque.pop();
 	while(di.task != NULL) {
 		performance_counters.num_dequeued_tasks.incr();
@@ -538,13 +639,13 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::pr
 		// Otherwise we would have to empty our deque on the next finish call
 		// which is bad for balancing
 		execute_task(di.task, di.stack_element);
-		delete di.task;
+		task_pool.destroy(di.task);
 		di = stealing_deque.pop();
 	}
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::process_queue_until_finished(StackElement* parent) {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::process_queue_until_finished(StackElement* parent) {
 	DequeItem di = stealing_deque.pop();
 	while(di.task != NULL) {
 		performance_counters.num_dequeued_tasks.incr();
@@ -554,7 +655,7 @@ bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::pr
 		// Otherwise we would have to empty our deque on the next finish call
 		// which is bad for balancing
 		execute_task(di.task, di.stack_element);
-		delete di.task;
+		task_pool.destroy(di.task);
 		if(finish_stack.unique(parent)) {
 			return true;
 		}
@@ -563,18 +664,39 @@ bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::pr
 	return false;
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::start_finish_region() {
+/*
+ * Executes one task from the queue of this place inside the currently running task
+ */
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+bool BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::execute_local_task() {
+	DequeItem di = stealing_deque.pop();
+	if(di.task == NULL) {
+		return false;
+	}
+	performance_counters.num_dequeued_tasks.incr();
+	performance_counters.task_time.stop_timer();
+	// The nested task overwrites the parent of the running task
+	StackElement* parent = current_task_parent;
+	execute_task(di.task, di.stack_element);
+	task_pool.destroy(di.task);
+	current_task_parent = parent;
+	performance_counters.task_time.start_timer();
+	return true;
+}
+
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::start_finish_region() {
 	performance_counters.task_time.stop_timer();
 	performance_counters.num_finishes.incr();
+	performance_counters.trace.add(TraceEventType::finish_enter);
 
 	current_task_parent = finish_stack.create_blocking(current_task_parent);
 
 	performance_counters.task_time.start_timer();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::end_finish_region() {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::end_finish_region() {
 	performance_counters.task_time.stop_timer();
 
 	// Make backup of parent since parent might change while waiting
@@ -585,13 +707,14 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::en
 
 	// Restore old parent
 	current_task_parent = finish_stack.destroy_blocking(parent);
+	performance_counters.trace.add(TraceEventType::finish_exit);
 
 	performance_counters.task_time.start_timer();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<class CallTaskType, typename ... TaskParams>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::finish(TaskParams&& ... params) {
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::finish(TaskParams&& ... params) {
 	start_finish_region();
 
 	call<CallTaskType>(std::forward<TaskParams&&>(params) ...);
@@ -599,9 +722,9 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::fi
 	end_finish_region();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<typename F, typename ... TaskParams>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::finish(F&& f, TaskParams&& ... params) {
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::finish(F&& f, TaskParams&& ... params) {
 	start_finish_region();
 
 	call(f, std::forward<TaskParams&&>(params) ...);
@@ -609,75 +732,78 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::fi
 	end_finish_region();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<class CallTaskType, typename ... TaskParams>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::spawn(TaskParams&& ... params) {
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::spawn(TaskParams&& ... params) {
 	performance_counters.num_spawns.incr();
 
-/*	size_t limit = call_mode?preferred_queue_length:max_queue_length;
-	if(stealing_deque.get_length() >= limit) {
-		call_mode = true;
+	if(spawn_to_call()) {
 		performance_counters.num_spawns_to_call.incr();
 		call<CallTaskType>(std::forward<TaskParams&&>(params) ...);
 	}
 	else {
-		call_mode = false;*/
 		performance_counters.num_actual_spawns.incr();
 
-		CallTaskType* task = new CallTaskType(params ...);
+		CallTaskType* task = task_pool.template create<CallTaskType>(params ...);
 		pheet_assert(current_task_parent != NULL);
 		finish_stack.spawn(current_task_parent);
 		DequeItem di;
 		di.task = task;
 		di.stack_element = current_task_parent;
+		bool was_empty = stealing_deque.is_empty();
 		stealing_deque.push(di);
-//	}
+		if(was_empty) {
+			// Parked places only need to be woken up when the deque becomes non-empty
+			scheduler_state->parking.notify();
+		}
+	}
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<typename F, typename ... TaskParams>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::spawn(F&& f, TaskParams&& ... params) {
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::spawn(F&& f, TaskParams&& ... params) {
 	performance_counters.num_spawns.incr();
 
-/*	size_t limit = call_mode?preferred_queue_length:max_queue_length;
-	if(stealing_deque.get_length() >= limit) {
-		call_mode = true;
+	if(spawn_to_call()) {
 		performance_counters.num_spawns_to_call.incr();
 		call(f, std::forward<TaskParams&&>(params) ...);
 	}
 	else {
-		call_mode = false;*/
 		performance_counters.num_actual_spawns.incr();
 
-		auto bound = std::bind(f, params ...);
-
-		FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+		typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+		TaskType* task = task_pool.template create<TaskType>(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 		pheet_assert(current_task_parent != NULL);
 		finish_stack.spawn(current_task_parent);
 		DequeItem di;
 		di.task = task;
 		di.stack_element = current_task_parent;
+		bool was_empty = stealing_deque.is_empty();
 		stealing_deque.push(di);
-//	}
+		if(was_empty) {
+			// Parked places only need to be woken up when the deque becomes non-empty
+			scheduler_state->parking.notify();
+		}
+	}
 }
 
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<class CallTaskType, class Strategy, typename ... TaskParams>
-inline void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::spawn_s(Strategy&&, TaskParams&& ... params) {
+inline void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::spawn_s(Strategy&&, TaskParams&& ... params) {
 	spawn<CallTaskType>(std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<class Strategy, typename F, typename ... TaskParams>
-inline void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::spawn_s(Strategy&&, F&& f, TaskParams&& ... params) {
+inline void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::spawn_s(Strategy&&, F&& f, TaskParams&& ... params) {
 	spawn(f, std::forward<TaskParams&&>(params) ...);
 }
 
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<class CallTaskType, typename ... TaskParams>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::call(TaskParams&& ... params) {
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::call(TaskParams&& ... params) {
 	performance_counters.num_calls.incr();
 	// Create task
 	CallTaskType task(std::forward<TaskParams&&>(params) ...);
@@ -685,16 +811,16 @@ void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::ca
 	task();
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
 template<typename F, typename ... TaskParams>
-void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::call(F&& f, TaskParams&& ... params) {
+void BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::call(F&& f, TaskParams&& ... params) {
 	performance_counters.num_calls.incr();
 	// Execute task
 	f(std::forward<TaskParams&&>(params) ...);
 }
 
-template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, uint8_t CallThreshold>
-procs_t BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, CallThreshold>::get_distance(Self* other) {
+template <class Pheet, template <class P, typename T> class StealingDequeT, template <class> class FinishStackT, template <class P, class Pl> class VictimSelectorT, uint8_t CallThreshold>
+procs_t BasicSchedulerPlace<Pheet, StealingDequeT, FinishStackT, VictimSelectorT, CallThreshold>::get_distance(Self* other) {
 	if(other == this) {
 		return 0;
 	}
@@ -0,0 +1,83 @@
+/*
+ * LastVictimSelector.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef LASTVICTIMSELECTOR_H_
+#define LASTVICTIMSELECTOR_H_
+
+#include "UniformVictimSelector.h"
+
+namespace pheet {
+
+/*
+ * Retries the last victim we successfully stole from before falling back to
+ * the base selector. Work tends to stay where it was spawned, so the last
+ * victim is likely to still have some. Forgotten as soon as a steal from it fails.
+ */
+template <class Pheet, class Place, template <class, class> class BaseSelector>
+class LastVictimSelectorImpl {
+public:
+	typedef typename Place::LevelDescription LevelDescription;
+
+	template <template <class, class> class NewBase>
+	using WithBaseSelector = LastVictimSelectorImpl<Pheet, Place, NewBase>;
+
+	LastVictimSelectorImpl()
+	: last_victim(nullptr), last_level(0), retry(false) {}
+	~LastVictimSelectorImpl() {}
+
+	void init(LevelDescription* levels, procs_t num_levels) {
+		base.init(levels, num_levels);
+	}
+
+	void begin() {
+		retry = (last_victim != nullptr);
+		base.begin();
+	}
+
+	template <class Rng>
+	Place* next(Rng& rng, procs_t& victim_level) {
+		if(retry) {
+			retry = false;
+			victim_level = last_level;
+			return last_victim;
+		}
+		return base.next(rng, victim_level);
+	}
+
+	void stolen(procs_t level, Place* victim) {
+		last_victim = victim;
+		last_level = level;
+		base.stolen(level, victim);
+	}
+
+	void failed(procs_t level, Place* victim) {
+		if(victim == last_victim) {
+			last_victim = nullptr;
+		}
+		base.failed(level, victim);
+	}
+
+	static void print_name() {
+		std::cout << "LastVictim<";
+		BaseSelector<Pheet, Place>::print_name();
+		std::cout << ">";
+	}
+
+private:
+	BaseSelector<Pheet, Place> base;
+	Place* last_victim;
+	procs_t last_level;
+	bool retry;
+};
+
+template <class Pheet, class Place>
+using LastVictimSelector = LastVictimSelectorImpl<Pheet, Place, UniformVictimSelector>;
+
+}
+
+#endif /* LASTVICTIMSELECTOR_H_ */
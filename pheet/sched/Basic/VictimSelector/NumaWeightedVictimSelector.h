@@ -0,0 +1,95 @@
+/*
+ * NumaWeightedVictimSelector.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef NUMAWEIGHTEDVICTIMSELECTOR_H_
+#define NUMAWEIGHTEDVICTIMSELECTOR_H_
+
+#include "UniformVictimSelector.h"
+
+#include <algorithm>
+
+namespace pheet {
+
+/*
+ * Picks the level of each steal attempt at random, weighted by the memory level
+ * of the partners. Each memory level closer to the stealing place multiplies the
+ * probability by 2^Shift, so remote sockets are only visited occasionally.
+ * A round consists of as many attempts as there are levels with partners.
+ */
+template <class Pheet, class Place, unsigned int Shift>
+class NumaWeightedVictimSelectorImpl {
+public:
+	typedef typename Place::LevelDescription LevelDescription;
+
+	template <unsigned int NewShift>
+	using WithShift = NumaWeightedVictimSelectorImpl<Pheet, Place, NewShift>;
+
+	NumaWeightedVictimSelectorImpl()
+	: levels(nullptr), num_levels(0), weights(nullptr), remaining(0) {}
+	~NumaWeightedVictimSelectorImpl() {
+		delete[] weights;
+	}
+
+	void init(LevelDescription* levels, procs_t num_levels) {
+		this->levels = levels;
+		this->num_levels = num_levels;
+		delete[] weights;
+		weights = new size_t[num_levels];
+
+		// Cumulative weights. Level 0 has no partners and is never selected
+		weights[0] = 0;
+		procs_t base_memory_level = (num_levels > 1)?levels[1].memory_level:0;
+		for(procs_t i = 1; i < num_levels; ++i) {
+			procs_t diff = (levels[i].memory_level > base_memory_level)?(levels[i].memory_level - base_memory_level):0;
+			diff = std::min<procs_t>(diff * Shift, 16);
+			weights[i] = weights[i - 1] + (((size_t)1) << diff);
+		}
+	}
+
+	void begin() {
+		remaining = num_levels - 1;
+	}
+
+	template <class Rng>
+	Place* next(Rng& rng, procs_t& victim_level) {
+		if(remaining == 0) {
+			return nullptr;
+		}
+		--remaining;
+
+		std::uniform_int_distribution<size_t> w_gen(0, weights[num_levels - 1] - 1);
+		size_t w = w_gen(rng);
+		procs_t level = 1;
+		while(weights[level] <= w) {
+			++level;
+		}
+		pheet_assert(level < num_levels);
+		victim_level = level;
+		return UniformVictimSelector<Pheet, Place>::random_partner(levels, level, rng);
+	}
+
+	void stolen(procs_t, Place*) {}
+	void failed(procs_t, Place*) {}
+
+	static void print_name() {
+		std::cout << "NumaWeighted<" << Shift << ">";
+	}
+
+private:
+	LevelDescription* levels;
+	procs_t num_levels;
+	size_t* weights;
+	procs_t remaining;
+};
+
+template <class Pheet, class Place>
+using NumaWeightedVictimSelector = NumaWeightedVictimSelectorImpl<Pheet, Place, 1>;
+
+}
+
+#endif /* NUMAWEIGHTEDVICTIMSELECTOR_H_ */
@@ -0,0 +1,79 @@
+/*
+ * RoundRobinVictimSelector.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ROUNDROBINVICTIMSELECTOR_H_
+#define ROUNDROBINVICTIMSELECTOR_H_
+
+#include "../../../settings.h"
+
+#include <iostream>
+
+namespace pheet {
+
+/*
+ * Hierarchical round-robin. Each round visits one partner per level, starting with
+ * the closest level. Per level, partners are visited in turn, starting at an offset
+ * derived from the id of the stealing place so that places do not all attack the
+ * same victim. Deterministic, so every partner is visited within num_partners rounds.
+ */
+template <class Pheet, class Place>
+class RoundRobinVictimSelector {
+public:
+	typedef typename Place::LevelDescription LevelDescription;
+
+	RoundRobinVictimSelector()
+	: levels(nullptr), num_levels(0), next_partner(nullptr), level(0) {}
+	~RoundRobinVictimSelector() {
+		delete[] next_partner;
+	}
+
+	void init(LevelDescription* levels, procs_t num_levels) {
+		this->levels = levels;
+		this->num_levels = num_levels;
+		delete[] next_partner;
+		next_partner = new procs_t[num_levels];
+		for(procs_t i = 1; i < num_levels; ++i) {
+			next_partner[i] = levels[i].local_id % levels[i].num_partners;
+		}
+	}
+
+	void begin() {
+		level = num_levels - 1;
+	}
+
+	template <class Rng>
+	Place* next(Rng&, procs_t& victim_level) {
+		if(level == 0) {
+			return nullptr;
+		}
+		victim_level = level;
+		--level;
+
+		pheet_assert(levels[victim_level].num_partners > 0);
+		procs_t p = next_partner[victim_level];
+		next_partner[victim_level] = (p + 1 == levels[victim_level].num_partners)?0:(p + 1);
+		return levels[victim_level].partners[p];
+	}
+
+	void stolen(procs_t, Place*) {}
+	void failed(procs_t, Place*) {}
+
+	static void print_name() {
+		std::cout << "RoundRobin";
+	}
+
+private:
+	LevelDescription* levels;
+	procs_t num_levels;
+	procs_t* next_partner;
+	procs_t level;
+};
+
+}
+
+#endif /* ROUNDROBINVICTIMSELECTOR_H_ */
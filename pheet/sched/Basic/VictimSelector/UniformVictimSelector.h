@@ -0,0 +1,81 @@
+/*
+ * UniformVictimSelector.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef UNIFORMVICTIMSELECTOR_H_
+#define UNIFORMVICTIMSELECTOR_H_
+
+#include "../../../settings.h"
+
+#include <random>
+#include <iostream>
+
+namespace pheet {
+
+/*
+ * Original victim selection of the basic scheduler. Each round tries one uniformly
+ * chosen partner per level, starting with the closest level.
+ */
+template <class Pheet, class Place>
+class UniformVictimSelector {
+public:
+	typedef typename Place::LevelDescription LevelDescription;
+
+	UniformVictimSelector()
+	: levels(nullptr), num_levels(0), level(0) {}
+	~UniformVictimSelector() {}
+
+	void init(LevelDescription* levels, procs_t num_levels) {
+		this->levels = levels;
+		this->num_levels = num_levels;
+	}
+
+	/*
+	 * Starts a new round of steal attempts
+	 */
+	void begin() {
+		level = num_levels - 1;
+	}
+
+	/*
+	 * Returns the next victim of the current round, or nullptr if the round is over
+	 */
+	template <class Rng>
+	Place* next(Rng& rng, procs_t& victim_level) {
+		// We do not steal from level 0 as there are no partners
+		if(level == 0) {
+			return nullptr;
+		}
+		victim_level = level;
+		--level;
+		return random_partner(levels, victim_level, rng);
+	}
+
+	void stolen(procs_t, Place*) {}
+	void failed(procs_t, Place*) {}
+
+	static void print_name() {
+		std::cout << "Uniform";
+	}
+
+	template <class Rng>
+	static Place* random_partner(LevelDescription* levels, procs_t level, Rng& rng) {
+		// For all except level 0 we assume num_partners > 0
+		pheet_assert(levels[level].num_partners > 0);
+		std::uniform_int_distribution<procs_t> n_r_gen(0, levels[level].num_partners - 1);
+		return levels[level].partners[n_r_gen(rng)];
+	}
+
+private:
+	LevelDescription* levels;
+	procs_t num_levels;
+	procs_t level;
+};
+
+}
+
+#endif /* UNIFORMVICTIMSELECTOR_H_ */
@@ -11,6 +11,7 @@
 
 #include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
 #include "../common/FinishRegion.h"
 #include "CentralizedSchedulerPlace.h"
 #include "../common/CPUThreadExecutor.h"
@@ -29,6 +30,7 @@ struct CentralizedSchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 //	typename Pheet::Scheduler::Task *startup_task;
 };
 
@@ -51,6 +53,8 @@ public:
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 		using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStack, CallThreshold> Place;
 	typedef CentralizedSchedulerState<Pheet> State;
 	typedef FinishRegion<Pheet> Finish;
@@ -69,6 +73,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 	template <template <class> class NewFS>
 		using WithFinishStack = CentralizedSchedulerImpl<Pheet, TaskStorageT, NewFS, CallThreshold>;
 
@@ -88,9 +94,13 @@ public:
 
 	static void print_name();
 
+	static Self* get() {
+		return singleton;
+	}
 	static Place* get_place();
 	static procs_t get_place_id();
 	Place* get_place_at(procs_t place_id);
+	procs_t get_num_places() { return num_places; }
 
 	template<class CallTaskType, typename ... TaskParams>
 	static void finish(TaskParams&& ... params);
@@ -129,6 +139,8 @@ private:
 	State state;
 
 	PerformanceCounters performance_counters;
+
+	static Self* singleton;
 };
 
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
@@ -137,9 +149,14 @@ char const CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThresh
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
 procs_t const CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::max_cpus = std::numeric_limits<procs_t>::max() >> 1;
 
+template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
+CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>* CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::singleton = nullptr;
+
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
 CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::CentralizedSchedulerImpl()
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -149,6 +166,8 @@ CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::Centr
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
 CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::CentralizedSchedulerImpl(typename Place::PerformanceCounters& performance_counters)
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -158,6 +177,8 @@ CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::Centr
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
 CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::CentralizedSchedulerImpl(procs_t num_places)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -167,6 +188,8 @@ CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::Centr
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
 CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::CentralizedSchedulerImpl(procs_t num_places, typename Place::PerformanceCounters& performance_counters)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -177,6 +200,8 @@ template <class Pheet, template <class P, typename T> class TaskStorageT, templa
 CentralizedSchedulerImpl<Pheet, TaskStorageT, FinishStack, CallThreshold>::~CentralizedSchedulerImpl() {
 	delete places[0];
 	delete[] places;
+
+	singleton = nullptr;
 }
 
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack, uint8_t CallThreshold>
@@ -76,10 +76,12 @@ public:
 	typedef CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThreshold> Self;
 	typedef Self Place;
 	typedef CentralizedSchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinishStackT<Pheet> FinishStack;
 	typedef typename FinishStack::Element StackElement;
 	typedef CentralizedSchedulerPlaceDequeItem<Pheet> DequeItem;
@@ -240,6 +242,7 @@ CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThreshold>::~Ce
 		end_finish_region();
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -418,12 +421,12 @@ void CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThreshold>
 			delete di.task;
 			di = task_storage.pop();
 		}
-		{Backoff bo;
+		{typename Parking::Waiter waiter(scheduler_state->parking, 1000);
 			do {
 				if(scheduler_state->current_state >= 2) {
 					return;
 				}
-				bo.backoff();
+				waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 				di = task_storage.pop();
 			}while(di.task == nullptr);
 		}
@@ -448,12 +451,12 @@ void CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThreshold>
 			}
 			di = task_storage.pop();
 		}
-		{Backoff bo;
+		{typename Parking::Waiter waiter(scheduler_state->parking, 100);
 			do {
 				if(finish_stack.unique(parent)) {
 					return;
 				}
-				bo.backoff();
+				waiter.wait([this, parent]() { return finish_stack.unique(parent); });
 				di = task_storage.pop();
 			}while(di.task == nullptr);
 		}
@@ -528,6 +531,7 @@ void CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThreshold>
 		di.task = task;
 		di.stack_element = current_task_parent;
 		task_storage.push(di);
+		scheduler_state->parking.notify_unordered();
 //	}
 }
 
@@ -546,15 +550,15 @@ void CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThreshold>
 		call_mode = false;*/
 		performance_counters.num_actual_spawns.incr();
 
-		auto bound = std::bind(f, params ...);
-
-		FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+		typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+		TaskType* task = new TaskType(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 		pheet_assert(current_task_parent != NULL);
 		finish_stack.spawn(current_task_parent);
 		DequeItem di;
 		di.task = task;
 		di.stack_element = current_task_parent;
 		task_storage.push(di);
+		scheduler_state->parking.notify_unordered();
 //	}
 }
 
@@ -583,7 +587,7 @@ procs_t CentralizedSchedulerPlace<Pheet, TaskStorageT, FinishStackT, CallThresho
 	}
 
 	procs_t offset = std::max(levels[num_levels - 1].memory_level, other->levels[other->num_levels - 1].memory_level);
-	procs_t i = min(num_levels - 1, other->num_levels - 1);
+	procs_t i = std::min(num_levels - 1, other->num_levels - 1);
 	while(levels[i].global_id_offset != other->levels[i].global_id_offset) {
 		pheet_assert(i > 0);
 		--i;
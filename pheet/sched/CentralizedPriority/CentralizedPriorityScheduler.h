@@ -12,6 +12,7 @@
 #include "../../settings.h"
 #include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
 #include "../common/FinishRegion.h"
 #include "CentralizedPrioritySchedulerPlace.h"
 #include "../../models/MachineModel/BinaryTree/BinaryTreeMachineModel.h"
@@ -32,6 +33,7 @@ struct CentralizedPrioritySchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 	typename Pheet::Scheduler::Task* startup_task;
 };
 
@@ -103,6 +105,8 @@ public:
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 	using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+	using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef CentralizedPrioritySchedulerTaskStorageItem<Pheet> TaskStorageItem;
 	typedef CentralizedPrioritySchedulerTaskStorageItemComparator<Pheet, TaskStorageItem> TaskStorageItemComparator;
 	typedef TaskStorageT<Pheet, TaskStorageItem, TaskStorageItemComparator> TaskStorage;
@@ -125,6 +129,8 @@ public:
 		using WithPriorityTaskStorage = CentralizedPrioritySchedulerImpl<Pheet, NewTS, FinishStack, DefaultStrategyT, CallThreshold>;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
@@ -146,9 +152,13 @@ public:
 
 //	static void print_performance_counter_headers();
 
+	static Self* get() {
+		return singleton;
+	}
 	static Place* get_place();
 	static procs_t get_place_id();
 	Place* get_place_at(procs_t place_id);
+	procs_t get_num_places() { return num_places; }
 
 	template<class CallTaskType, typename ... TaskParams>
 		void finish(TaskParams&& ... params);
@@ -187,6 +197,8 @@ private:
 	State state;
 
 	PerformanceCounters performance_counters;
+
+	static Self* singleton;
 };
 
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
@@ -195,9 +207,14 @@ char const CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, De
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
 procs_t const CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::max_cpus = std::numeric_limits<procs_t>::max() >> 1;
 
+template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
+CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>* CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::singleton = nullptr;
+
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
 CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::CentralizedPrioritySchedulerImpl()
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -207,6 +224,8 @@ CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrate
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
 CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::CentralizedPrioritySchedulerImpl(typename Place::PerformanceCounters& performance_counters)
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -216,6 +235,8 @@ CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrate
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
 CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::CentralizedPrioritySchedulerImpl(procs_t num_places)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -225,6 +246,8 @@ CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrate
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
 CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::CentralizedPrioritySchedulerImpl(procs_t num_places, typename Place::PerformanceCounters& performance_counters)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(task_storage, machine_model, places, num_places, &state, performance_counters);
@@ -235,6 +258,8 @@ template <class Pheet, template <class P, typename T, typename> class TaskStorag
 CentralizedPrioritySchedulerImpl<Pheet, TaskStorageT, FinishStack, DefaultStrategyT, CallThreshold>::~CentralizedPrioritySchedulerImpl() {
 	delete places[0];
 	delete[] places;
+
+	singleton = nullptr;
 }
 
 template <class Pheet, template <class P, typename T, typename> class TaskStorageT, template <class> class FinishStack, template <class P> class DefaultStrategyT, uint8_t CallThreshold>
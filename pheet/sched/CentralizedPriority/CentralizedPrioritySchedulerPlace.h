@@ -45,10 +45,12 @@ public:
 	typedef CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold> Self;
 	typedef Self Place;
 	typedef CentralizedPrioritySchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinishStackT<Pheet> FinishStack;
 	typedef typename FinishStack::Element StackElement;
 	typedef typename Pheet::Scheduler::TaskStorageItem TaskStorageItem;
@@ -199,6 +201,7 @@ CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold>::~Centrali
 		end_finish_region();
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -378,12 +381,12 @@ void CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold>::main
 			delete di.task;
 			di = task_storage.pop();
 		}
-		{Backoff bo;
+		{typename Parking::Waiter waiter(scheduler_state->parking, 1000);
 			do {
 				if(scheduler_state->current_state >= 2) {
 					return;
 				}
-				bo.backoff();
+				waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 				di = task_storage.pop();
 			}while(di.task == nullptr);
 		}
@@ -408,12 +411,12 @@ void CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold>::wait
 			}
 			di = task_storage.pop();
 		}
-		{Backoff bo;
+		{typename Parking::Waiter waiter(scheduler_state->parking, 100);
 			do {
 				if(finish_stack.unique(parent)) {
 					return;
 				}
-				bo.backoff();
+				waiter.wait([this, parent]() { return finish_stack.unique(parent); });
 				di = task_storage.pop();
 			}while(di.task == nullptr);
 		}
@@ -510,6 +513,7 @@ void CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spaw
 			di.stack_element = current_task_parent;
 			di.priority = s.get_pop_priority(task_id++);
 			task_storage.push(di);
+			scheduler_state->parking.notify_unordered();
 //		}
 	}
 }
@@ -538,9 +542,8 @@ void CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spaw
 		else {
 			call_mode = false;*/
 			performance_counters.num_actual_spawns.incr();
-			auto bound = std::bind(f, params ...);
-
-			FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+			typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+			TaskType* task = new TaskType(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 			pheet_assert(current_task_parent != NULL);
 			finish_stack.spawn(current_task_parent);
 			TaskStorageItem di;
@@ -548,6 +551,7 @@ void CentralizedPrioritySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spaw
 			di.stack_element = current_task_parent;
 			di.priority = s.get_pop_priority(task_id++);
 			task_storage.push(di);
+			scheduler_state->parking.notify_unordered();
 	//	}
 	}
 }
@@ -11,6 +11,7 @@
 
 //#include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
 #include "FinisherSchedulerFinishRegion.h"
 #include "FinisherSchedulerPlace.h"
 #include "FinisherSchedulerTask.h"
@@ -28,6 +29,7 @@ struct FinisherSchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 //	typename Pheet::Scheduler::Task *startup_task;
 };
 
@@ -50,6 +52,8 @@ public:
 	typedef FinisherSchedulerTask<Pheet> Task;
 	template <typename F>
 		using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef FinisherSchedulerPlace<Pheet, StealingDeque, CallThreshold> Place;
 	typedef FinisherSchedulerState<Pheet> State;
 	typedef FinisherSchedulerFinishRegion<Pheet> Finish;
@@ -66,6 +70,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
@@ -83,9 +89,13 @@ public:
 
 	static void print_name();
 
+	static Self* get() {
+		return singleton;
+	}
 	static Place* get_place();
 	static procs_t get_place_id();
 	Place* get_place_at(procs_t place_id);
+	procs_t get_num_places() { return num_places; }
 
 	template<class CallTaskType, typename ... TaskParams>
 	static void finish(TaskParams&& ... params);
@@ -122,6 +132,8 @@ private:
 	State state;
 
 	PerformanceCounters performance_counters;
+
+	static Self* singleton;
 };
 
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
@@ -130,9 +142,14 @@ char const FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::name[] =
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
 procs_t const FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::max_cpus = std::numeric_limits<procs_t>::max() >> 1;
 
+template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
+FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>* FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::singleton = nullptr;
+
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
 FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImpl()
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -142,6 +159,8 @@ FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImp
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
 FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImpl(typename Place::PerformanceCounters& performance_counters)
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -151,6 +170,8 @@ FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImp
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
 FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImpl(procs_t num_places)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -160,6 +181,8 @@ FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImp
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
 FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::FinisherSchedulerImpl(procs_t num_places, typename Place::PerformanceCounters& performance_counters)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -170,6 +193,8 @@ template <class Pheet, template <class P, typename T> class StealingDeque, uint8
 FinisherSchedulerImpl<Pheet, StealingDeque, CallThreshold>::~FinisherSchedulerImpl() {
 	delete places[0];
 	delete[] places;
+
+	singleton = nullptr;
 }
 
 template <class Pheet, template <class P, typename T> class StealingDeque, uint8_t CallThreshold>
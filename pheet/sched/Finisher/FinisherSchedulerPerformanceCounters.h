@@ -14,6 +14,7 @@
 #include "../../primitives/PerformanceCounter/Max/MaxPerformanceCounter.h"
 #include "../../primitives/PerformanceCounter/Min/MinPerformanceCounter.h"
 #include "../../primitives/PerformanceCounter/Time/TimePerformanceCounter.h"
+#include "../../memory/TaskPool/TaskPoolPerformanceCounters.h"
 
 namespace pheet {
 
@@ -38,6 +39,7 @@ public:
 		  num_steal_executed_tasks(other.num_steal_executed_tasks),
 		  total_time(other.total_time), task_time(other.task_time),
 		  idle_time(other.idle_time),
+		  task_pool_performance_counters(other.task_pool_performance_counters),
 		  stealing_deque_performance_counters(other.stealing_deque_performance_counters) {}
 
 	static void print_headers();
@@ -66,6 +68,7 @@ public:
 	TimePerformanceCounter<Pheet, scheduler_measure_task_time> task_time;
 	TimePerformanceCounter<Pheet, scheduler_measure_idle_time> idle_time;
 
+	TaskPoolPerformanceCounters<Pheet> task_pool_performance_counters;
 	StealingDequePerformanceCounters stealing_deque_performance_counters;
 };
 
@@ -93,6 +96,7 @@ inline void FinisherSchedulerPerformanceCounters<Pheet, StealingDequePerformance
 	TimePerformanceCounter<Pheet, scheduler_measure_task_time>::print_header("total_task_time\t");
 	TimePerformanceCounter<Pheet, scheduler_measure_idle_time>::print_header("total_idle_time\t");
 
+	TaskPoolPerformanceCounters<Pheet>::print_headers();
 	StealingDequePerformanceCounters::print_headers();
 }
 
@@ -117,6 +121,7 @@ inline void FinisherSchedulerPerformanceCounters<Pheet, StealingDequePerformance
 	task_time.print("%f\t");
 	idle_time.print("%f\t");
 
+	task_pool_performance_counters.print_values();
 	stealing_deque_performance_counters.print_values();
 }
 
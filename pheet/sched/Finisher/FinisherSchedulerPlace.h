@@ -17,6 +17,7 @@
 #include "../../misc/bitops.h"
 #include "../../misc/type_traits.h"
 #include "FinisherSchedulerPerformanceCounters.h"
+#include "../../memory/TaskPool/TaskPool.h"
 
 #include <functional>
 
@@ -76,10 +77,12 @@ public:
 	typedef FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold> Self;
 	typedef Self Place;
 	typedef FinisherSchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinisherSchedulerPlaceDequeItem<Pheet> DequeItem;
 	typedef StealingDequeT<Pheet, DequeItem> StealingDeque;
 	typedef FinisherSchedulerPerformanceCounters<Pheet, typename StealingDeque::PerformanceCounters> PerformanceCounters;
@@ -122,6 +125,7 @@ public:
 */
 	Finisher current_finisher;
 	void wait_for_finish(Finisher f);
+	bool work_available();
 
 private:
 	void initialize_levels();
@@ -145,6 +149,7 @@ private:
 	typename Pheet::Scheduler::State* scheduler_state;
 
 	PerformanceCounters performance_counters;
+	TaskPool<Pheet> task_pool;
 
 	size_t preferred_queue_length;
 	size_t max_queue_length;
@@ -169,6 +174,7 @@ FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::FinisherSchedulerP
   num_initialized_levels(1), num_levels(find_last_bit_set(num_places)), levels(new LevelDescription[num_levels]),
   scheduler_state(scheduler_state),
   performance_counters(perf_count),
+  task_pool(performance_counters.task_pool_performance_counters),
   preferred_queue_length(find_last_bit_set(num_places) << CallThreshold),
   max_queue_length(preferred_queue_length << 1),
   call_mode(false), stealing_deque(max_queue_length, performance_counters.stealing_deque_performance_counters),
@@ -197,6 +203,7 @@ FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::FinisherSchedulerP
   levels(new LevelDescription[num_levels]),
   scheduler_state(scheduler_state),
   performance_counters(perf_count),
+  task_pool(performance_counters.task_pool_performance_counters),
   preferred_queue_length(find_last_bit_set(levels[0].size) << CallThreshold),
   max_queue_length(preferred_queue_length << 1),
   call_mode(false), stealing_deque(max_queue_length, performance_counters.stealing_deque_performance_counters),
@@ -238,6 +245,7 @@ FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::~FinisherScheduler
 
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -403,8 +411,8 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::main_loop() {
 		// Make sure our queue is empty
 		process_queue();
 
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			typename Parking::Waiter waiter(scheduler_state->parking);
 			DequeItem di;
 			performance_counters.idle_time.start_timer();
 			while(true) {
@@ -426,9 +434,13 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::main_loop() {
 					if(di.task != NULL) {
 						performance_counters.num_steal_executed_tasks.incr();
 						performance_counters.idle_time.stop_timer();
+						if(!stealing_deque.is_empty()) {
+							// We stole more than we need, others may help
+							scheduler_state->parking.notify();
+						}
 
 						execute_task(di.task);
-						delete di.task;
+						task_pool.destroy(di.task);
 						break;
 					}
 					else{
@@ -443,7 +455,7 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::main_loop() {
 						performance_counters.idle_time.stop_timer();
 						return;
 					}
-					bo.backoff();
+					waiter.wait([this]() { return scheduler_state->current_state >= 2 || work_available(); });
 				}
 				else {
 					break;
@@ -463,8 +475,9 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::wait_for_fini
 
 		// Make sure our queue is empty
 		if(!process_queue_until_finished(f))
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			// Completion of a finish region is not notified, so only park for a short time
+			typename Parking::Waiter waiter(scheduler_state->parking, 100);
 			DequeItem di;
 			while(true) {
 				// Finalize elements in stack
@@ -482,9 +495,12 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::wait_for_fini
 
 					if(di.task != NULL) {
 						performance_counters.num_steal_executed_tasks.incr();
+						if(!stealing_deque.is_empty()) {
+							scheduler_state->parking.notify();
+						}
 
 						execute_task(di.task);
-						delete di.task;
+						task_pool.destroy(di.task);
 						break;
 					}
 					else {
@@ -500,7 +516,7 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::wait_for_fini
 						f.deactivate();
 						return;
 					}
-					bo.backoff();
+					waiter.wait([this, &f]() { return f.unique() || work_available(); });
 				}
 				else {
 					break;
@@ -510,6 +526,17 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::wait_for_fini
 	}
 }
 
+template <class Pheet, template <class P, typename T> class StealingDequeT, uint8_t CallThreshold>
+bool FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::work_available() {
+	// Full scan, so no notification can be missed by a place that is about to park
+	for(procs_t i = 0; i < levels[0].size; ++i) {
+		if(!levels[0].partners[i]->stealing_deque.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 template <class Pheet, template <class P, typename T> class StealingDequeT, uint8_t CallThreshold>
 void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::process_queue() {
 	DequeItem di = stealing_deque.pop();
@@ -521,7 +548,7 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::process_queue
 		// Otherwise we would have to empty our deque on the next finish call
 		// which is bad for balancing
 		execute_task(di.task);
-		delete di.task;
+		task_pool.destroy(di.task);
 		di = stealing_deque.pop();
 	}
 }
@@ -537,7 +564,7 @@ bool FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::process_queue
 		// Otherwise we would have to empty our deque on the next finish call
 		// which is bad for balancing
 		execute_task(di.task);
-		delete di.task;
+		task_pool.destroy(di.task);
 		if(f.unique()) {
 			return true;
 		}
@@ -617,14 +644,19 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::spawn(TaskPar
 		call_mode = false;*/
 		performance_counters.num_actual_spawns.incr();
 
-		CallTaskType* task = new CallTaskType(params ...);
+		CallTaskType* task = task_pool.template create<CallTaskType>(params ...);
 		task->fin = current_finisher;
 //		pheet_assert(current_task_parent != NULL);
 //		++(current_task_parent->num_spawned);
 		DequeItem di;
 		di.task = task;
 //		di.stack_element = current_task_parent;
+		bool was_empty = stealing_deque.is_empty();
 		stealing_deque.push(di);
+		if(was_empty) {
+			// Parked places only need to be woken up when the deque becomes non-empty
+			scheduler_state->parking.notify();
+		}
 //	}
 }
 
@@ -643,16 +675,20 @@ void FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::spawn(F&& f,
 		call_mode = false;*/
 		performance_counters.num_actual_spawns.incr();
 
-		auto bound = std::bind(f, params ...);
-
-		FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+		typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+		TaskType* task = task_pool.template create<TaskType>(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 		task->fin = current_finisher;
 //		pheet_assert(current_task_parent != NULL);
 //		++(current_task_parent->num_spawned);
 		DequeItem di;
 		di.task = task;
 //		di.stack_element = current_task_parent;
+		bool was_empty = stealing_deque.is_empty();
 		stealing_deque.push(di);
+		if(was_empty) {
+			// Parked places only need to be woken up when the deque becomes non-empty
+			scheduler_state->parking.notify();
+		}
 //	}
 }
 
@@ -681,7 +717,7 @@ procs_t FinisherSchedulerPlace<Pheet, StealingDequeT, CallThreshold>::get_distan
 	}
 
 	procs_t offset = std::max(levels[num_levels - 1].memory_level, other->levels[other->num_levels - 1].memory_level);
-	procs_t i = min(num_levels - 1, other->num_levels - 1);
+	procs_t i = std::min(num_levels - 1, other->num_levels - 1);
 	while(levels[i].global_id_offset != other->levels[i].global_id_offset) {
 		pheet_assert(i > 0);
 		--i;
@@ -32,6 +32,7 @@ struct MixedModeSchedulerState {
 //	procs_t team_size;
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 //	Task *startup_task;
 };
 
@@ -69,6 +70,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
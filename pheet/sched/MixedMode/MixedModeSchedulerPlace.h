@@ -159,6 +159,7 @@ public:
 	typedef Self Place;
 	typedef MixedModeSchedulerPlaceLevelDescription<Self> LevelDescription;
 	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	typedef MixedModeSchedulerPlaceFinishStackElement FinishStackElement;
 	typedef MixedModeSchedulerPlaceDequeItem<Self> DequeItem;
@@ -423,6 +424,7 @@ MixedModeSchedulerPlace<Pheet, StealingDequeT>::~MixedModeSchedulerPlace() {
 		end_finish_region();
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -1408,7 +1410,7 @@ void MixedModeSchedulerPlace<Pheet, StealingDequeT>::visit_partners() {
 	performance_counters.idle_time.start_timer();
 	performance_counters.visit_partners_time.start_timer();
 
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 100);
 	DequeItem di;
 	while(true) {
 		// We do not steal from the last level as there are no partners
@@ -1459,7 +1461,7 @@ void MixedModeSchedulerPlace<Pheet, StealingDequeT>::visit_partners() {
 		}
 		// We may perform the cleanup now, as we have to wait anyway (and this also makes debugging easier)
 		empty_finish_stack();
-		bo.backoff();
+		waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 	}
 }
 
@@ -1474,7 +1476,7 @@ void MixedModeSchedulerPlace<Pheet, StealingDequeT>::visit_partners_until_finish
 	performance_counters.idle_time.start_timer();
 	performance_counters.wait_for_finish_time.start_timer();
 
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 100);
 	DequeItem di;
 	while(true) {
 		// We do not steal from the last level as there are no partners
@@ -1526,7 +1528,7 @@ void MixedModeSchedulerPlace<Pheet, StealingDequeT>::visit_partners_until_finish
 		}
 		// We may perform the cleanup now, as we have to wait anyway (and this also makes debugging easier)
 		empty_finish_stack();
-		bo.backoff();
+		waiter.wait([parent]() { return parent->num_finished_remote == parent->num_spawned; });
 	}
 }
 
@@ -1541,7 +1543,7 @@ void MixedModeSchedulerPlace<Pheet, StealingDequeT>::visit_partners_until_synced
 
 	performance_counters.idle_time.start_timer();
 
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 100);
 	DequeItem di;
 	while(true) {
 		// We do not steal from the last level as there are no partners
@@ -1593,7 +1595,7 @@ void MixedModeSchedulerPlace<Pheet, StealingDequeT>::visit_partners_until_synced
 
 			return;
 		}
-		bo.backoff();
+		waiter.wait([my_team_announcement]() { return my_team_announcement->reg.parts.a == my_team_announcement->reg.parts.r; });
 	}
 }
 
@@ -2360,6 +2362,7 @@ template <class Pheet, template <class SP, typename T> class StealingDequeT>
 void MixedModeSchedulerPlace<Pheet, StealingDequeT>::store_item_in_deque(DequeItem di, procs_t level) {
 	pheet_assert(di.team_size <= this->levels[level].size);
 	stealing_deques[level]->push(di);
+	scheduler_state->parking.notify_unordered();
 	if(lowest_level_deque == NULL) {
 		lowest_level_deque = stealing_deques + level;
 		highest_level_deque = lowest_level_deque;
@@ -12,6 +12,7 @@
 #include "../../settings.h"
 #include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
 #include "../common/FinishRegion.h"
 #include "PrioritySchedulerPlace.h"
 #include "PrioritySchedulerStealerDescriptor.h"
@@ -30,6 +31,7 @@ struct PrioritySchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 	typename Pheet::Scheduler::Task* startup_task;
 };
 
@@ -92,6 +94,8 @@ public:
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 	using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+	using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef PrioritySchedulerTaskStorageItem<Pheet> TaskStorageItem;
 	typedef TaskStorageT<Pheet, TaskStorageItem> TaskStorage;
 	typedef PrioritySchedulerPlace<Pheet, CallThreshold> Place;
@@ -112,6 +116,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 
 	/*
@@ -65,10 +65,12 @@ public:
 	typedef PrioritySchedulerPlace<Pheet, CallThreshold> Self;
 	typedef Self Place;
 	typedef PrioritySchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef PrioritySchedulerPlaceStackElement StackElement;
 	typedef typename Pheet::Scheduler::TaskStorageItem TaskStorageItem;
 	typedef typename Pheet::Scheduler::TaskStorage TaskStorage;
@@ -230,6 +232,7 @@ PrioritySchedulerPlace<Pheet, CallThreshold>::~PrioritySchedulerPlace() {
 		end_finish_region();
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -415,8 +418,8 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::main_loop() {
 		// Make sure our queue is empty
 		process_queue();
 
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			typename Parking::Waiter waiter(scheduler_state->parking, 1000);
 			TaskStorageItem di;
 			performance_counters.idle_time.start_timer();
 			while(true) {
@@ -457,7 +460,7 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::main_loop() {
 						return;
 					}
 					task_storage.perform_maintenance(performance_counters.task_storage_performance_counters);
-					bo.backoff();
+					waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 				}
 				else {
 					break;
@@ -472,8 +475,8 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::wait_for_finish(StackElement*
 	while(parent->num_finished_remote + 1 != parent->num_spawned) {
 		// Make sure our queue is empty
 		if(!process_queue_until_finished(parent))
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			typename Parking::Waiter waiter(scheduler_state->parking, 100);
 			TaskStorageItem di;
 			while(true) {
 				// Finalize elements in stack
@@ -507,7 +510,7 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::wait_for_finish(StackElement*
 						return;
 					}
 					task_storage.perform_maintenance(performance_counters.task_storage_performance_counters);
-					bo.backoff();
+					waiter.wait([this, parent]() { return parent->num_finished_remote + 1 == parent->num_spawned; });
 				}
 				else {
 					break;
@@ -807,6 +810,7 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::spawn_prio(Strategy s, TaskPa
 			di.task = task;
 			di.stack_element = current_task_parent;
 			task_storage.push(s, di, performance_counters.task_storage_performance_counters);
+			scheduler_state->parking.notify_unordered();
 		}
 	}
 }
@@ -835,9 +839,8 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::spawn_prio(Strategy s, F&& f,
 		else {
 			call_mode = false;
 			performance_counters.num_actual_spawns.incr();
-			auto bound = std::bind(f, params ...);
-
-			FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+			typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+			TaskType* task = new TaskType(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 			pheet_assert(current_task_parent != NULL);
 			pheet_assert(current_task_parent >= stack && (current_task_parent < (stack + stack_size)));
 			++(current_task_parent->num_spawned);
@@ -845,6 +848,7 @@ void PrioritySchedulerPlace<Pheet, CallThreshold>::spawn_prio(Strategy s, F&& f,
 			di.task = task;
 			di.stack_element = current_task_parent;
 			task_storage.push(s, di, performance_counters.task_storage_performance_counters);
+			scheduler_state->parking.notify_unordered();
 		}
 	}
 }
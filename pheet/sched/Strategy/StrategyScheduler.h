@@ -19,6 +19,7 @@
 #include "base_strategies/LifoFifo/LifoFifoBaseStrategy.h"
 
 #include <pheet/ds/FinishStack/MM/MMFinishStack.h>
+#include "../common/SchedulerInlineFunctorTask.h"
 
 namespace pheet {
 
@@ -28,6 +29,7 @@ struct StrategySchedulerState {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 	typename Pheet::Scheduler::Task* startup_task;
 };
 
@@ -48,6 +50,8 @@ public:
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 	using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+	using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef StrategySchedulerTaskStorageItem<Pheet, Task, typename FinishStack<Pheet>::Element> TaskStorageItem;
 	typedef TaskStorageT<Pheet, TaskStorageItem, StealerT> TaskStorage;
 	typedef StealerT<Pheet, TaskStorage> Stealer;
@@ -68,6 +72,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = StrategySchedulerImpl<Pheet, NewTS, StealerT, FinishStack, BaseStrategyT>;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
@@ -89,9 +95,13 @@ public:
 
 //	static void print_performance_counter_headers();
 
+	static Self* get() {
+		return singleton;
+	}
 	static Place* get_place();
 	static procs_t get_place_id();
 	Place* get_place_at(procs_t place_id);
+	procs_t get_num_places() { return num_places; }
 
 	template<class CallTaskType, typename ... TaskParams>
 		void finish(TaskParams&& ... params);
@@ -134,6 +144,8 @@ private:
 	State state;
 
 	PerformanceCounters performance_counters;
+
+	static Self* singleton;
 };
 
 
@@ -143,9 +155,14 @@ char const StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, Bas
 template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
 procs_t const StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::max_cpus = std::numeric_limits<procs_t>::max() >> 1;
 
+template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
+StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>* StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::singleton = nullptr;
+
 template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
 StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::StrategySchedulerImpl()
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -155,6 +172,8 @@ StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>
 template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
 StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::StrategySchedulerImpl(typename Place::PerformanceCounters& performance_counters)
 : num_places(machine_model.get_num_leaves()) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -164,6 +183,8 @@ StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>
 template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
 StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::StrategySchedulerImpl(procs_t num_places)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -173,6 +194,8 @@ StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>
 template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
 StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::StrategySchedulerImpl(procs_t num_places, typename Place::PerformanceCounters& performance_counters)
 : num_places(num_places) {
+	pheet_assert(singleton == nullptr);
+	singleton = this;
 
 	places = new Place*[num_places];
 	places[0] = new Place(machine_model, places, num_places, &state, performance_counters);
@@ -183,6 +206,8 @@ template <class Pheet, template <class P, typename T, template <class, class> cl
 StrategySchedulerImpl<Pheet, TaskStorageT, StealerT, FinishStack, BaseStrategyT>::~StrategySchedulerImpl() {
 	delete places[0];
 	delete[] places;
+
+	singleton = nullptr;
 }
 
 template <class Pheet, template <class P, typename T, template <class, class> class> class TaskStorageT, template <class P, class TS> class StealerT, template <class> class FinishStack, template <class P> class BaseStrategyT>
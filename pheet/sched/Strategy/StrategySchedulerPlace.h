@@ -33,10 +33,12 @@ public:
 	typedef StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold> Self;
 	typedef Self Place;
 	typedef StrategySchedulerPlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinishStackT<Pheet> FinishStack;
 	typedef typename FinishStack::Element StackElement;
 	typedef typename Pheet::Scheduler::TaskStorageItem TaskStorageItem;
@@ -94,6 +96,8 @@ public:
 	void start_finish_region();
 	void end_finish_region();
 
+	bool execute_local_task();
+
 	ptrdiff_t next_task_id() { return task_id++; }
 
 	TaskStorage& get_task_storage() { return task_storage; }
@@ -204,6 +208,7 @@ StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::~StrategySchedulerPl
 
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		performance_counters.task_time.stop_timer();
 		performance_counters.total_time.stop_timer();
@@ -373,8 +378,8 @@ void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::main_loop() {
 		// Make sure our queue is empty
 		process_queue();
 
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			typename Parking::Waiter waiter(scheduler_state->parking, 1000);
 			TaskStorageItem di;
 			performance_counters.idle_time.start_timer();
 			while(true) {
@@ -416,7 +421,7 @@ void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::main_loop() {
 						return;
 					}
 //					task_storage.perform_maintenance(performance_counters.task_storage_performance_counters);
-					bo.backoff();
+					waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 				}
 				else {
 					break;
@@ -431,8 +436,8 @@ void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::wait_for_finish
 	while(!finish_stack.unique(parent)) {
 		// Make sure our queue is empty
 		if(!process_queue_until_finished(parent))
-		{	// Local scope so we have a new backoff object
-			Backoff bo;
+		{	// Local scope so we have a new waiter object
+			typename Parking::Waiter waiter(scheduler_state->parking, 100);
 			TaskStorageItem di;
 			while(true) {
 				// Finalize elements in stack
@@ -467,7 +472,7 @@ void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::wait_for_finish
 						return;
 					}
 //					task_storage.perform_maintenance(performance_counters.task_storage_performance_counters);
-					bo.backoff();
+					waiter.wait([this, parent]() { return finish_stack.unique(parent); });
 				}
 				else {
 					break;
@@ -509,6 +514,25 @@ bool StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::process_queue_u
 	return false;
 }
 
+/*
+ * Executes one task from the queue of this place inside the currently running task
+ */
+template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
+bool StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::execute_local_task() {
+	TaskStorageItem di = task_storage.pop();
+	if(di.task == NULL) {
+		return false;
+	}
+	performance_counters.task_time.stop_timer();
+	// The nested task overwrites the parent of the running task
+	StackElement* parent = current_task_parent;
+	execute_task(di.task, di.stack_element);
+	delete di.task;
+	current_task_parent = parent;
+	performance_counters.task_time.start_timer();
+	return true;
+}
+
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
 void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::start_finish_region() {
 	performance_counters.task_time.stop_timer();
@@ -601,6 +625,7 @@ inline void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spawn_s(
 			di.task = task;
 			di.stack_element = current_task_parent;
 			task_storage.push(std::forward<Strategy&&>(s), di);
+			scheduler_state->parking.notify_unordered();
 		}
 		else {
 			performance_counters.num_spawns_to_call.incr();
@@ -626,9 +651,8 @@ inline void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spawn_s(
 			pheet_assert(s.get_transitive_weight() > 0);
 
 			performance_counters.num_actual_spawns.incr();
-			auto bound = std::bind(f, params ...);
-
-			FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+			typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+			TaskType* task = new TaskType(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 			pheet_assert(current_task_parent != NULL);
 //			pheet_assert(current_task_parent >= stack && (current_task_parent < (stack + stack_size)));
 			finish_stack.spawn(current_task_parent);
@@ -636,6 +660,7 @@ inline void StrategySchedulerPlace<Pheet, FinishStackT, CallThreshold>::spawn_s(
 			di.task = task;
 			di.stack_element = current_task_parent;
 			task_storage.push(std::forward<Strategy&&>(s), di);
+			scheduler_state->parking.notify_unordered();
 		}
 		else {
 			performance_counters.num_spawns_to_call.incr();
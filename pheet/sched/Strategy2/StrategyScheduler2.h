@@ -13,15 +13,20 @@
 #include "StrategyScheduler2PerformanceCounters.h"
 #include "StrategyScheduler2TaskStorageItem.h"
 #include "StrategyScheduler2BaseStrategy.h"
+#include "StrategyScheduler2TaskHandle.h"
 
 #include "../../settings.h"
 #include "../../models/MachineModel/BinaryTree/BinaryTreeMachineModel.h"
 #include "../common/SchedulerTask.h"
 #include "../common/SchedulerFunctorTask.h"
+#include "../common/SchedulerInlineFunctorTask.h"
+#include "../../memory/Arena/HeapMemoryArena.h"
 
 #include <pheet/ds/FinishStack/MM/MMFinishStack.h>
 #include <pheet/ds/StrategyTaskStorage/Strategy2Base/Strategy2BaseTaskStorage.h>
 
+#include <type_traits>
+
 namespace pheet {
 
 template <class Pheet>
@@ -30,6 +35,7 @@ struct StrategyScheduler2State {
 
 	uint8_t current_state;
 	typename Pheet::Barrier state_barrier;
+	typename Pheet::Parking parking;
 	typename Pheet::Scheduler::Task* startup_task;
 };
 
@@ -50,9 +56,12 @@ public:
 	typedef SchedulerTask<Pheet> Task;
 	template <typename F>
 	using FunctorTask = SchedulerFunctorTask<Pheet, F>;
+	template <typename F, typename ... Args>
+	using InlineFunctorTask = SchedulerInlineFunctorTask<Pheet, F, Args ...>;
 	typedef StrategyScheduler2TaskStorageItem<Pheet, Task, typename FinishStack<Pheet>::Element> TaskStorageItem;
 	typedef TaskStorageT<Pheet, TaskStorageItem> TaskStorage;
 	typedef typename TaskStorage::BaseTaskStorage BaseTaskStorage;
+	typedef StrategyScheduler2TaskHandle<Pheet, typename TaskStorage::BaseItem> TaskHandle;
 	typedef StrategyScheduler2Place<Pheet, FinishStack, 4> Place;
 	typedef StrategyScheduler2State<Pheet> State;
 	typedef FinishRegion<Pheet> Finish;
@@ -70,6 +79,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
@@ -122,6 +133,12 @@ public:
 
 	template<class Strategy, typename F, typename ... TaskParams>
 		void spawn_s(Strategy s, F&& f, TaskParams&& ... params);
+
+	template<class CallTaskType, class Strategy, typename ... TaskParams>
+		TaskHandle spawn_s_handle(Strategy s, TaskParams&& ... params);
+
+	template<class CallTaskType, class Strategy, typename ... TaskParams>
+		void reprioritize(TaskHandle& handle, Strategy s, TaskParams&& ... params);
 /*
 	template<class CallTaskType, class Strategy, typename ... TaskParams>
 		void spawn_s(Strategy&& s, TaskParams&& ... params);
@@ -211,6 +228,11 @@ template <class Pheet, template <class P, typename T> class TaskStorageT, templa
 void StrategyScheduler2Impl<Pheet, TaskStorageT, FinishStack>::print_name() {
 	std::cout << name << "<";
 	TaskStorage::print_name();
+	// Only non-default arenas, so benchmark results stay comparable with earlier runs
+	if(!std::is_same<typename Pheet::MemoryArena, HeapMemoryArena<Pheet> >::value) {
+		std::cout << ", ";
+		Pheet::MemoryArena::print_name();
+	}
 	std::cout /*<< ", " << (int)CallThreshold*/ << ">";
 }
 
@@ -277,6 +299,22 @@ inline void StrategyScheduler2Impl<Pheet, TaskStorageT, FinishStack>::spawn_s(St
 	pheet_assert(p != NULL);
 	p->spawn_s(std::move(s), f, std::forward<TaskParams&&>(params) ...);
 }
+
+template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack>
+template<class CallTaskType, class Strategy, typename ... TaskParams>
+inline typename StrategyScheduler2Impl<Pheet, TaskStorageT, FinishStack>::TaskHandle StrategyScheduler2Impl<Pheet, TaskStorageT, FinishStack>::spawn_s_handle(Strategy s, TaskParams&& ... params) {
+	Place* p = get_place();
+	pheet_assert(p != NULL);
+	return p->template spawn_s_handle<CallTaskType>(std::move(s), std::forward<TaskParams&&>(params) ...);
+}
+
+template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack>
+template<class CallTaskType, class Strategy, typename ... TaskParams>
+inline void StrategyScheduler2Impl<Pheet, TaskStorageT, FinishStack>::reprioritize(TaskHandle& handle, Strategy s, TaskParams&& ... params) {
+	Place* p = get_place();
+	pheet_assert(p != NULL);
+	p->template reprioritize<CallTaskType>(handle, std::move(s), std::forward<TaskParams&&>(params) ...);
+}
 /*
 template <class Pheet, template <class P, typename T> class TaskStorageT, template <class> class FinishStack>
 template<class CallTaskType, class Strategy, typename ... TaskParams>
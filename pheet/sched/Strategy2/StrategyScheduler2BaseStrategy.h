@@ -20,6 +20,7 @@ public:
 	typedef Self BaseStrategy;
 	typedef typename Pheet::Place Place;
 	typedef typename Pheet::Scheduler::TaskStorage TaskStorage;
+	typedef typename Pheet::Scheduler::TaskHandle TaskHandle;
 
 	StrategyScheduler2BaseStrategy()
 	{
@@ -38,6 +39,16 @@ public:
 	Self& operator=(Self&&) {
 	}
 
+	/*
+	 * Checks whether a queued task with the given strategy may be replaced by a task with
+	 * this strategy in reprioritize. Strategies can use this to make sure a (possibly stale)
+	 * handle still refers to the right task.
+	 */
+	template <class Strategy>
+	bool can_reprioritize(Strategy&) {
+		return true;
+	}
+
 private:
 };
 
@@ -15,6 +15,7 @@
 #include "../../primitives/PerformanceCounter/Max/MaxPerformanceCounter.h"
 #include "../../primitives/PerformanceCounter/Min/MinPerformanceCounter.h"
 #include "../../primitives/PerformanceCounter/Time/TimePerformanceCounter.h"
+#include "../../memory/TaskPool/TaskPoolPerformanceCounters.h"
 
 namespace pheet {
 
@@ -26,10 +27,12 @@ public:
 		: num_spawns(other.num_spawns), num_actual_spawns(other.num_actual_spawns),
 		  num_spawns_to_call(other.num_spawns_to_call),
 		  num_calls(other.num_calls), num_finishes(other.num_finishes),
+		  num_reprioritizations(other.num_reprioritizations),
 		  num_steal_calls(other.num_steal_calls),
 		  num_unsuccessful_steal_calls(other.num_unsuccessful_steal_calls),
 		  total_time(other.total_time), task_time(other.task_time),
 		  idle_time(other.idle_time), steal_time(other.steal_time),
+		  task_pool_performance_counters(other.task_pool_performance_counters),
 		  task_storage_performance_counters(other.task_storage_performance_counters),
 		  finish_stack_performance_counters(other.finish_stack_performance_counters)
 		  {}
@@ -43,6 +46,7 @@ public:
 	BasicPerformanceCounter<Pheet, scheduler_count_spawns_to_call> num_spawns_to_call;
 	BasicPerformanceCounter<Pheet, scheduler_count_calls> num_calls;
 	BasicPerformanceCounter<Pheet, scheduler_count_finishes> num_finishes;
+	BasicPerformanceCounter<Pheet, scheduler_count_reprioritizations> num_reprioritizations;
 
 	BasicPerformanceCounter<Pheet, task_storage_count_steal_calls> num_steal_calls;
 	BasicPerformanceCounter<Pheet, task_storage_count_unsuccessful_steal_calls> num_unsuccessful_steal_calls;
@@ -52,6 +56,7 @@ public:
 	TimePerformanceCounter<Pheet, scheduler_measure_idle_time> idle_time;
 	TimePerformanceCounter<Pheet, scheduler_measure_idle_time> steal_time;
 
+	TaskPoolPerformanceCounters<Pheet> task_pool_performance_counters;
 	TaskStoragePerformanceCounters task_storage_performance_counters;
 	FinishStackPerformanceCounters finish_stack_performance_counters;
 };
@@ -63,6 +68,7 @@ inline void StrategyScheduler2PerformanceCounters<Pheet, TaskStoragePerformanceC
 	BasicPerformanceCounter<Pheet, scheduler_count_calls>::print_header("calls\t");
 	BasicPerformanceCounter<Pheet, scheduler_count_spawns_to_call>::print_header("spawns->call\t");
 	BasicPerformanceCounter<Pheet, scheduler_count_finishes>::print_header("finishes\t");
+	BasicPerformanceCounter<Pheet, scheduler_count_reprioritizations>::print_header("reprioritizations\t");
 
 	BasicPerformanceCounter<Pheet, task_storage_count_steal_calls>::print_header("steal_calls\t");
 	BasicPerformanceCounter<Pheet, task_storage_count_unsuccessful_steal_calls>::print_header("unsuccessful_steal_calls\t");
@@ -72,6 +78,7 @@ inline void StrategyScheduler2PerformanceCounters<Pheet, TaskStoragePerformanceC
 	TimePerformanceCounter<Pheet, scheduler_measure_idle_time>::print_header("total_idle_time\t");
 	TimePerformanceCounter<Pheet, scheduler_measure_steal_time>::print_header("total_steal_time\t");
 
+	TaskPoolPerformanceCounters<Pheet>::print_headers();
 	TaskStoragePerformanceCounters::print_headers();
 	FinishStackPerformanceCounters::print_headers();
 }
@@ -83,6 +90,7 @@ inline void StrategyScheduler2PerformanceCounters<Pheet, TaskStoragePerformanceC
 	num_calls.print("%lu\t");
 	num_spawns_to_call.print("%lu\t");
 	num_finishes.print("%lu\t");
+	num_reprioritizations.print("%lu\t");
 	num_steal_calls.print("%lu\t");
 	num_unsuccessful_steal_calls.print("%lu\t");
 	total_time.print("%f\t");
@@ -90,6 +98,7 @@ inline void StrategyScheduler2PerformanceCounters<Pheet, TaskStoragePerformanceC
 	idle_time.print("%f\t");
 	steal_time.print("%f\t");
 
+	task_pool_performance_counters.print_values();
 	task_storage_performance_counters.print_values();
 	finish_stack_performance_counters.print_values();
 }
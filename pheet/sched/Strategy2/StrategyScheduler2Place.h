@@ -14,6 +14,8 @@
 #include "../common/CPUThreadExecutor.h"
 #include "../common/FinishRegion.h"
 #include "../common/PlaceBase.h"
+#include "../common/PlaceLocalStorage.h"
+#include "../../memory/TaskPool/TaskPool.h"
 
 #include <map>
 
@@ -38,16 +40,19 @@ public:
 	typedef StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold> Self;
 	typedef Self Place;
 	typedef StrategyScheduler2PlaceLevelDescription<Self> LevelDescription;
-	typedef typename Pheet::Backoff Backoff;
+	typedef typename Pheet::Parking Parking;
 	typedef typename Pheet::Scheduler::Task Task;
 	template <typename F>
 		using FunctorTask = typename Pheet::Scheduler::template FunctorTask<F>;
+	template <typename F, typename ... Args>
+		using InlineFunctorTask = typename Pheet::Scheduler::template InlineFunctorTask<F, Args ...>;
 	typedef FinishStackT<Pheet> FinishStack;
 	typedef typename FinishStack::Element StackElement;
 	typedef typename Pheet::Scheduler::TaskStorageItem TaskStorageItem;
 	typedef typename Pheet::Scheduler::TaskStorage CentralTaskStorage;
 	typedef typename Pheet::Scheduler::TaskStorage::Place TaskStorage;
 	typedef typename Pheet::Scheduler::TaskStorage::BasePlace TaskStorageBase;
+	typedef typename Pheet::Scheduler::TaskHandle TaskHandle;
 //	typedef typename Pheet::Scheduler::TaskDesc TaskDesc;
 //	typedef typename Pheet::Scheduler::PlaceDesc PlaceDesc;
 	typedef StrategyScheduler2PerformanceCounters<Pheet, typename TaskStorage::PerformanceCounters, typename FinishStack::PerformanceCounters> PerformanceCounters;
@@ -92,6 +97,22 @@ public:
 	template<class Strategy, typename F, typename ... TaskParams>
 		void spawn_s(Strategy&& s, F&& f, TaskParams&& ... params);
 
+	/*
+	 * Same as spawn_s, but returns a handle to the queued task, which can be used to
+	 * reprioritize it. Only supported by task storages providing take_local.
+	 */
+	template<class CallTaskType, class Strategy, typename ... TaskParams>
+		TaskHandle spawn_s_handle(Strategy&& s, TaskParams&& ... params);
+
+	/*
+	 * Replaces the task referred to by the handle with a new task of the given type and strategy.
+	 * If the task is still queued at this place, the queued task is taken and the new task
+	 * reuses its slot in the finish stack. Otherwise a new task is spawned (and the old task
+	 * is expected to be filtered out as a dead task). Updates the handle.
+	 */
+	template<class CallTaskType, class Strategy, typename ... TaskParams>
+		void reprioritize(TaskHandle& handle, Strategy&& s, TaskParams&& ... params);
+
 	procs_t get_distance(Self* other) const;
 	procs_t get_numa_distance(Self* other) const;
 //	procs_t get_distance(Self* other, procs_t max_granularity_level);
@@ -101,6 +122,8 @@ public:
 	void start_finish_region();
 	void end_finish_region();
 
+	bool execute_local_task();
+
 	ptrdiff_t next_task_id() { return task_id++; }
 
 	TaskStorage& get_base_task_storage() { return task_storage; }
@@ -126,7 +149,7 @@ public:
 	}
 
 	void drop_item(TaskStorageItem* item) {
-		delete item->task;
+		task_pool.destroy(item->task);
 		finish_stack.signal_completion(item->stack_element);
 	}
 
@@ -177,12 +200,16 @@ private:
 	typename Pheet::Scheduler::State* scheduler_state;
 
 	PerformanceCounters performance_counters;
+	TaskPool<Pheet> task_pool;
 
 //	PlaceDesc place_desc;
 	TaskStorage task_storage;
 	FinishStack finish_stack;
 
-	std::unordered_map<std::type_index, TaskStorageBase*> task_storages;
+	// Task storage places by type, for constant time lookup on spawn. Additional task storages are owned
+	PlaceLocalStorage task_storages;
+	// All task storages, for cleaning up
+	std::vector<TaskStorageBase*> task_storage_list;
 
 //	size_t spawn2call_counter;
 
@@ -211,14 +238,16 @@ StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::StrategyScheduler2P
   current_task_parent(nullptr),
   scheduler_state(scheduler_state),
   performance_counters(perf_count),
+  task_pool(performance_counters.task_pool_performance_counters),
   task_storage(ctask_storage, this, performance_counters.task_storage_performance_counters),
   finish_stack(performance_counters.finish_stack_performance_counters),
 //  spawn2call_counter(0),
   thread_executor(this),
   task_id(0) {
 
-	// Add base task storage to map of all task storages
-	task_storages[std::type_index(typeid(CentralTaskStorage))] = &task_storage;
+	// Add base task storage to all task storages
+	task_storages.put(&task_storage);
+	task_storage_list.push_back(&task_storage);
 
 	// This is the root task execution context. It differs from the others in that it reuses the existing thread instead of creating a new one
 
@@ -245,13 +274,15 @@ StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::StrategyScheduler2P
   current_task_parent(nullptr),
   scheduler_state(scheduler_state),
   performance_counters(perf_count),
+  task_pool(performance_counters.task_pool_performance_counters),
   task_storage(ctask_storage, this, performance_counters.task_storage_performance_counters),
   finish_stack(performance_counters.finish_stack_performance_counters),
 //  spawn2call_counter(0),
   thread_executor(this) {
 
-	// Add base task storage to map of all task storages
-	task_storages[std::type_index(typeid(CentralTaskStorage))] = &task_storage;
+	// Add base task storage to all task storages
+	task_storages.put(&task_storage);
+	task_storage_list.push_back(&task_storage);
 
 	memcpy(this->levels, levels, sizeof(LevelDescription) * num_initialized_levels);
 	// We have to initialize this now, as the value is already used by performance counters during initialization
@@ -267,10 +298,11 @@ StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::~StrategyScheduler2
 
 		// we can shut down the scheduler
 		scheduler_state->current_state = 2;
+		scheduler_state->parking.notify_all();
 
 		// Clean up all task storages
-		for(auto ts : task_storages) {
-			ts.second->clean_up();
+		for(auto ts : task_storage_list) {
+			ts->clean_up();
 		}
 
 		performance_counters.task_time.stop_timer();
@@ -286,12 +318,7 @@ StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::~StrategyScheduler2
 		machine_model.unbind();
 		local_place = NULL;
 	}
-	// Delete all additional task storages that were created
-	for(auto ts : task_storages) {
-		if(ts.second != &task_storage) {
-			delete ts.second;
-		}
-	}
+	// Additional task storages are deleted by task_storages
 	delete[] levels;
 }
 
@@ -447,7 +474,7 @@ void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::execute_task(T
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
 void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::main_loop() {
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 1000);
 	while(true) {
 		TaskStorageItem di = task_storage.pop();
 		while(di.task != NULL) {
@@ -456,28 +483,28 @@ void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::main_loop() {
 			// Otherwise we would have to empty our deque on the next finish call
 			// which is bad for balancing
 			execute_task(di.task, di.stack_element);
-			delete di.task;
+			task_pool.destroy(di.task);
 			di = task_storage.pop();
 
-			bo.reset();
+			waiter.reset();
 		}
 
 		if(scheduler_state->current_state >= 2) {
 			// Cleans out any remaining references to tasks
-			for(auto ts : task_storages) {
-				ts.second->clean_up();
+			for(auto ts : task_storage_list) {
+				ts->clean_up();
 			}
 
 //			performance_counters.idle_time.stop_timer();
 			return;
 		}
-		bo.backoff();
+		waiter.wait([this]() { return scheduler_state->current_state >= 2; });
 	}
 }
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
 void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::wait_for_finish(StackElement* parent) {
-	Backoff bo;
+	typename Parking::Waiter waiter(scheduler_state->parking, 100);
 	while(true) {
 		TaskStorageItem di = task_storage.pop();
 		while(di.task != NULL) {
@@ -486,7 +513,7 @@ void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::wait_for_finis
 			// Otherwise we would have to empty our deque on the next finish call
 			// which is bad for balancing
 			execute_task(di.task, di.stack_element);
-			delete di.task;
+			task_pool.destroy(di.task);
 			if(finish_stack.unique(parent)) {
 				return;
 			}
@@ -496,8 +523,27 @@ void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::wait_for_finis
 		if(finish_stack.unique(parent)) {
 			return;
 		}
-		bo.backoff();
+		waiter.wait([this, parent]() { return finish_stack.unique(parent); });
+	}
+}
+
+/*
+ * Executes one task from the queue of this place inside the currently running task
+ */
+template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
+bool StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::execute_local_task() {
+	TaskStorageItem di = task_storage.pop();
+	if(di.task == NULL) {
+		return false;
 	}
+	performance_counters.task_time.stop_timer();
+	// The nested task overwrites the parent of the running task
+	StackElement* parent = current_task_parent;
+	execute_task(di.task, di.stack_element);
+	task_pool.destroy(di.task);
+	current_task_parent = parent;
+	performance_counters.task_time.start_timer();
+	return true;
 }
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
@@ -577,11 +623,13 @@ void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::end_finish_reg
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
 template<class Strategy>
 typename Strategy::TaskStorage::Place* StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::get_task_storage() {
-	std::type_index ti = std::type_index(typeid(typename Strategy::TaskStorage));
-	typename Strategy::TaskStorage::Place* ts = reinterpret_cast<typename Strategy::TaskStorage::Place*>(task_storages[ti]);
+	typedef typename Strategy::TaskStorage::Place TaskStoragePlace;
+	TaskStoragePlace* ts = task_storages.get<TaskStoragePlace>();
 	if(ts == nullptr) {
-		ts = new typename Strategy::TaskStorage::Place(get_task_storage<typename Strategy::BaseStrategy>());
-		task_storages[ti] = ts;
+		// Base task storages are created first, so they are deleted last
+		ts = new TaskStoragePlace(get_task_storage<typename Strategy::BaseStrategy>());
+		task_storages.put_owned(ts);
+		task_storage_list.push_back(ts);
 	}
 	return ts;
 }
@@ -611,13 +659,14 @@ template<class CallTaskType, typename ... TaskParams>
 void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::spawn(TaskParams&& ... params) {
 	performance_counters.num_spawns.incr();
 	performance_counters.num_actual_spawns.incr();
-	CallTaskType* task = new CallTaskType(params ...);
+	CallTaskType* task = task_pool.template create<CallTaskType>(params ...);
 	pheet_assert(current_task_parent != NULL);
 	finish_stack.spawn(current_task_parent);
 	TaskStorageItem di;
 	di.task = task;
 	di.stack_element = current_task_parent;
 	task_storage.push(di);
+	scheduler_state->parking.notify_unordered();
 }
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
@@ -625,15 +674,15 @@ template<typename F, typename ... TaskParams>
 void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::spawn(F&& f, TaskParams&& ... params) {
 	performance_counters.num_spawns.incr();
 	performance_counters.num_actual_spawns.incr();
-	auto bound = std::bind(f, params ...);
-
-	FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+	typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+	TaskType* task = task_pool.template create<TaskType>(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 	pheet_assert(current_task_parent != NULL);
 	finish_stack.spawn(current_task_parent);
 	TaskStorageItem di;
 	di.task = task;
 	di.stack_element = current_task_parent;
 	task_storage.push(di);
+	scheduler_state->parking.notify_unordered();
 }
 
 template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
@@ -650,13 +699,14 @@ inline void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::spawn_s
 	}
 	else {
 		performance_counters.num_actual_spawns.incr();
-		CallTaskType* task = new CallTaskType(params ...);
+		CallTaskType* task = task_pool.template create<CallTaskType>(params ...);
 		pheet_assert(current_task_parent != NULL);
 		finish_stack.spawn(current_task_parent);
 		TaskStorageItem di;
 		di.task = task;
 		di.stack_element = current_task_parent;
 		ts->push(std::forward<Strategy&&>(s), di);
+		scheduler_state->parking.notify_unordered();
 	}
 }
 
@@ -674,15 +724,70 @@ inline void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::spawn_s
 	}
 	else {
 		performance_counters.num_actual_spawns.incr();
-		auto bound = std::bind(f, params ...);
-
-		FunctorTask<decltype(bound)>* task = new FunctorTask<decltype(bound)>(bound);
+		typedef InlineFunctorTask<F, TaskParams ...> TaskType;
+		TaskType* task = task_pool.template create<TaskType>(std::forward<F>(f), std::forward<TaskParams>(params) ...);
 		pheet_assert(current_task_parent != NULL);
 		finish_stack.spawn(current_task_parent);
 		TaskStorageItem di;
 		di.task = task;
 		di.stack_element = current_task_parent;
 		task_storage.push(std::forward<Strategy&&>(s), di);
+		scheduler_state->parking.notify_unordered();
+	}
+}
+
+template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
+template<class CallTaskType, class Strategy, typename ... TaskParams>
+inline typename StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::TaskHandle StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::spawn_s_handle(Strategy&& s, TaskParams&& ... params) {
+	performance_counters.num_spawns.incr();
+
+	auto ts = get_task_storage<Strategy>();
+
+	// Check whether we can convert task to a function call (determined in strategy)
+	if(s.can_call(ts)) {
+		performance_counters.num_spawns_to_call.incr();
+		call<CallTaskType>(std::forward<TaskParams&&>(params) ...);
+		return TaskHandle();
+	}
+	else {
+		performance_counters.num_actual_spawns.incr();
+		CallTaskType* task = task_pool.template create<CallTaskType>(params ...);
+		pheet_assert(current_task_parent != NULL);
+		finish_stack.spawn(current_task_parent);
+		TaskStorageItem di;
+		di.task = task;
+		di.stack_element = current_task_parent;
+		auto item = ts->push(std::forward<Strategy&&>(s), di);
+		scheduler_state->parking.notify_unordered();
+		return TaskHandle(item, item->version.load(std::memory_order_relaxed));
+	}
+}
+
+template <class Pheet, template <class> class FinishStackT, uint8_t CallThreshold>
+template<class CallTaskType, class Strategy, typename ... TaskParams>
+inline void StrategyScheduler2Place<Pheet, FinishStackT, CallThreshold>::reprioritize(TaskHandle& handle, Strategy&& s, TaskParams&& ... params) {
+	auto ts = get_task_storage<Strategy>();
+
+	TaskStorageItem di;
+	if(handle.valid() && ts->take_local(handle.item, handle.version, s, di)) {
+		performance_counters.num_reprioritizations.incr();
+
+		// The old task never runs. If it was spawned in the current finish region, the new
+		// task takes over its place in the finish stack. Otherwise the new task needs to be
+		// registered with the current region, and the old one completes its region.
+		task_pool.destroy(di.task);
+		di.task = task_pool.template create<CallTaskType>(params ...);
+		if(di.stack_element != current_task_parent) {
+			pheet_assert(current_task_parent != NULL);
+			finish_stack.spawn(current_task_parent);
+			finish_stack.signal_completion(di.stack_element);
+			di.stack_element = current_task_parent;
+		}
+		auto item = ts->push(std::forward<Strategy&&>(s), di);
+		handle = TaskHandle(item, item->version.load(std::memory_order_relaxed));
+	}
+	else {
+		handle = spawn_s_handle<CallTaskType>(std::forward<Strategy&&>(s), std::forward<TaskParams&&>(params) ...);
 	}
 }
 
@@ -0,0 +1,41 @@
+/*
+ * StrategyScheduler2TaskHandle.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef STRATEGYSCHEDULER2TASKHANDLE_H_
+#define STRATEGYSCHEDULER2TASKHANDLE_H_
+
+#include <stddef.h>
+
+namespace pheet {
+
+/*
+ * Refers to a task spawned with spawn_s_handle, as long as it is queued. Items are reused,
+ * so the version of the item at spawn time is stored as well. A handle can be stale at
+ * any time, reprioritize then falls back to spawning a new task.
+ */
+template <class Pheet, class BaseItem>
+struct StrategyScheduler2TaskHandle {
+	typedef BaseItem Item;
+
+	StrategyScheduler2TaskHandle()
+	: item(nullptr), version(0) {}
+
+	StrategyScheduler2TaskHandle(BaseItem* item, size_t version)
+	: item(item), version(version) {}
+
+	bool valid() const {
+		return item != nullptr;
+	}
+
+	BaseItem* item;
+	size_t version;
+};
+
+}
+
+#endif /* STRATEGYSCHEDULER2TASKHANDLE_H_ */
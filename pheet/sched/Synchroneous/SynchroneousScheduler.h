@@ -43,6 +43,8 @@ public:
 		using WithPriorityTaskStorage = Self;
 	template <template <class, typename, template <class, class> class> class NewTS>
 		using WithStrategyTaskStorage = Self;
+	template <template <class, class> class NewVS>
+		using WithVictimSelector = Self;
 
 	/*
 	 * Uses complete machine
@@ -65,6 +67,7 @@ public:
 	static procs_t get_id();
 	static procs_t get_place_id();
 	Place* get_place_at(procs_t place_id);
+	procs_t get_num_places() { return 1; }
 
 	template<class CallTaskType, typename ... TaskParams>
 		void finish(TaskParams&& ... params);
@@ -9,35 +9,17 @@
 #ifndef PLACEBASE_H_
 #define PLACEBASE_H_
 
+#include "PlaceLocalStorage.h"
+
 #include <random>
-#include <unordered_map>
-#include <typeindex>
 
 namespace pheet {
 
-class PlaceBaseSingletonBase {
-public:
-	virtual ~PlaceBaseSingletonBase() {}
-};
-
-template <class T>
-class PlaceBaseSingleton : public PlaceBaseSingletonBase {
-public:
-	virtual ~PlaceBaseSingleton() {}
-
-	T content;
-};
-
 template <class Pheet>
 class PlaceBase {
 public:
 	PlaceBase() {}
-	~PlaceBase() {
-		for(auto i = singletons.begin(); i != singletons.end(); ++i) {
-			pheet_assert(i->second != nullptr);
-			delete i->second;
-		}
-	}
+	~PlaceBase() {}
 
 	inline std::mt19937& get_rng() {
 		return rng;
@@ -45,11 +27,7 @@ public:
 
 	template <class T>
 	T& singleton() {
-		PlaceBaseSingletonBase*& s = singletons[std::type_index(typeid(T))];
-		if(s == nullptr) {
-			s = new PlaceBaseSingleton<T>();
-		}
-		return static_cast<PlaceBaseSingleton<T>*>(s)->content;
+		return singletons.singleton<T>();
 	}
 
 	template<class CallTaskType, typename ... TaskParams>
@@ -58,9 +36,18 @@ public:
 	template<typename F, typename ... TaskParams>
 		void call(F&& f, TaskParams&& ... params);
 
+	/*
+	 * Executes one task of this place from inside a running task, so tasks waiting on a
+	 * data structure can keep the place busy. Returns false if there was nothing to execute.
+	 * Schedulers without support never execute anything.
+	 */
+	bool execute_local_task() {
+		return false;
+	}
+
 private:
 	std::mt19937 rng;
-	std::unordered_map<std::type_index, PlaceBaseSingletonBase*> singletons;
+	PlaceLocalStorage singletons;
 
 };
 
@@ -0,0 +1,138 @@
+/*
+ * PlaceLocalStorage.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PLACELOCALSTORAGE_H_
+#define PLACELOCALSTORAGE_H_
+
+#include "../../misc/assert.h"
+
+#include <atomic>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Slot 0 is never handed out, so an access before static initialization is caught by the assert
+ */
+inline std::atomic<size_t>& place_local_storage_slot_counter() {
+	static std::atomic<size_t> counter(1);
+	return counter;
+}
+
+inline size_t place_local_storage_num_slots() {
+	return place_local_storage_slot_counter().load(std::memory_order_relaxed);
+}
+
+/*
+ * Dense slot index of type T, assigned during static initialization
+ */
+template <class T>
+struct PlaceLocalStorageSlot {
+	static size_t const index;
+};
+
+template <class T>
+size_t const PlaceLocalStorageSlot<T>::index = place_local_storage_slot_counter().fetch_add(1, std::memory_order_relaxed);
+
+/*
+ * Per-place storage of one object per type. Objects are stored in an array indexed by the
+ * slot of their type, so accessing them is a single indexed load. Owned objects are deleted
+ * in reverse order of insertion.
+ *
+ * Not thread-safe, only to be used by the owning place.
+ */
+class PlaceLocalStorage {
+public:
+	PlaceLocalStorage()
+	: entries(place_local_storage_num_slots()) {}
+
+	~PlaceLocalStorage() {
+		for(auto i = owned.rbegin(); i != owned.rend(); ++i) {
+			Entry& e = entries[*i];
+			e.destroy(e.item);
+		}
+	}
+
+	/*
+	 * Returns nullptr if no object has been stored for T
+	 */
+	template <class T>
+	T* get() {
+		size_t index = PlaceLocalStorageSlot<T>::index;
+		pheet_assert(index != 0);
+		if(index < entries.size()) {
+			return static_cast<T*>(entries[index].item);
+		}
+		return nullptr;
+	}
+
+	/*
+	 * Stores an object that is not owned by the storage
+	 */
+	template <class T>
+	void put(T* item) {
+		Entry& e = entry(PlaceLocalStorageSlot<T>::index);
+		pheet_assert(e.item == nullptr);
+		e.item = item;
+	}
+
+	/*
+	 * Stores an object that is deleted together with the storage
+	 */
+	template <class T>
+	void put_owned(T* item) {
+		size_t index = PlaceLocalStorageSlot<T>::index;
+		put(item);
+		entries[index].destroy = &destroy<T>;
+		owned.push_back(index);
+	}
+
+	/*
+	 * Returns the object stored for T, default constructing it on first access
+	 */
+	template <class T>
+	T& singleton() {
+		T* ret = get<T>();
+		if(ret == nullptr) {
+			ret = new T();
+			put_owned(ret);
+		}
+		return *ret;
+	}
+
+private:
+	struct Entry {
+		Entry()
+		: item(nullptr), destroy(nullptr) {}
+
+		void* item;
+		void (*destroy)(void*);
+	};
+
+	/*
+	 * Only types registered after the storage was created need to grow the array
+	 */
+	Entry& entry(size_t index) {
+		pheet_assert(index != 0);
+		if(index >= entries.size()) {
+			entries.resize(place_local_storage_num_slots());
+		}
+		return entries[index];
+	}
+
+	template <class T>
+	static void destroy(void* item) {
+		delete static_cast<T*>(item);
+	}
+
+	std::vector<Entry> entries;
+	std::vector<size_t> owned;
+};
+
+} /* namespace pheet */
+#endif /* PLACELOCALSTORAGE_H_ */
@@ -0,0 +1,123 @@
+/*
+ * SchedulerInlineFunctorTask.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SCHEDULERINLINEFUNCTORTASK_H_
+#define SCHEDULERINLINEFUNCTORTASK_H_
+
+#include "../../misc/type_traits.h"
+
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+namespace pheet {
+
+/*
+ * Callable and bound arguments of a functor task.
+ * Arguments are stored by value (like std::bind) and passed to the callable as lvalues.
+ */
+template <typename F, typename ... Args>
+struct SchedulerInlineFunctorTaskCallable {
+	template <typename FF, typename ... AA>
+	SchedulerInlineFunctorTaskCallable(FF&& f, AA&& ... args)
+	: f(std::forward<FF>(f)), args(std::forward<AA>(args) ...) {}
+
+	void operator()() {
+		invoke(make_index_sequence<sizeof...(Args)>());
+	}
+
+	template <size_t ... I>
+	void invoke(index_sequence<I ...>) {
+		f(std::get<I>(args) ...);
+	}
+
+	F f;
+	std::tuple<Args ...> args;
+};
+
+/*
+ * Keeps the callable inside the task object if it fits
+ */
+template <class Callable, bool Inline>
+class SchedulerInlineFunctorTaskStorage {
+public:
+	template <typename ... A>
+	SchedulerInlineFunctorTaskStorage(A&& ... a)
+	: callable(std::forward<A>(a) ...) {}
+
+	Callable& get() { return callable; }
+
+private:
+	Callable callable;
+};
+
+/*
+ * Oversized captures are moved to the heap
+ */
+template <class Callable>
+class SchedulerInlineFunctorTaskStorage<Callable, false> {
+public:
+	template <typename ... A>
+	SchedulerInlineFunctorTaskStorage(A&& ... a)
+	: callable(new Callable(std::forward<A>(a) ...)) {}
+	~SchedulerInlineFunctorTaskStorage() { delete callable; }
+
+	SchedulerInlineFunctorTaskStorage(SchedulerInlineFunctorTaskStorage const&) = delete;
+	SchedulerInlineFunctorTaskStorage& operator=(SchedulerInlineFunctorTaskStorage const&) = delete;
+
+	Callable& get() { return *callable; }
+
+private:
+	Callable* callable;
+};
+
+/*
+ * Alternative to SchedulerFunctorTask that does not need std::bind.
+ * The callable and its arguments are perfect-forwarded into storage inside the task object
+ * (up to InlineSize bytes), so spawning a lambda or function requires only the allocation
+ * of the task itself. Larger captures fall back to a separate heap allocation.
+ */
+template <class Pheet, size_t InlineSize, typename F, typename ... Args>
+class SchedulerInlineFunctorTaskImpl : public Pheet::Environment::Task {
+public:
+	typedef SchedulerInlineFunctorTaskCallable<typename std::decay<F>::type, typename std::decay<Args>::type ...> Callable;
+	static bool const is_inline = sizeof(Callable) <= InlineSize;
+
+	template <typename FF, typename ... AA>
+	SchedulerInlineFunctorTaskImpl(FF&& f, AA&& ... args);
+	virtual ~SchedulerInlineFunctorTaskImpl();
+
+	virtual void operator()();
+
+private:
+	SchedulerInlineFunctorTaskStorage<Callable, is_inline> storage;
+};
+
+template <class Pheet, size_t InlineSize, typename F, typename ... Args>
+template <typename FF, typename ... AA>
+SchedulerInlineFunctorTaskImpl<Pheet, InlineSize, F, Args ...>::SchedulerInlineFunctorTaskImpl(FF&& f, AA&& ... args)
+: storage(std::forward<FF>(f), std::forward<AA>(args) ...) {
+
+}
+
+template <class Pheet, size_t InlineSize, typename F, typename ... Args>
+SchedulerInlineFunctorTaskImpl<Pheet, InlineSize, F, Args ...>::~SchedulerInlineFunctorTaskImpl() {
+
+}
+
+template <class Pheet, size_t InlineSize, typename F, typename ... Args>
+void SchedulerInlineFunctorTaskImpl<Pheet, InlineSize, F, Args ...>::operator()() {
+	storage.get()();
+}
+
+template <class Pheet, typename F, typename ... Args>
+using SchedulerInlineFunctorTask = SchedulerInlineFunctorTaskImpl<Pheet, 192, F, Args ...>;
+
+}
+
+#endif /* SCHEDULERINLINEFUNCTORTASK_H_ */
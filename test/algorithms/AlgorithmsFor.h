@@ -0,0 +1,68 @@
+/*
+ * AlgorithmsFor.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMSFOR_H_
+#define ALGORITHMSFOR_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_for.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * parallel_for over indices, followed by parallel_for_range over pointers. Both add to
+ * the result, so elements visited twice or not at all are detected.
+ */
+template <class Pheet>
+class AlgorithmsFor : public Pheet::Task {
+public:
+	AlgorithmsFor(unsigned int* data, size_t length, size_t grain, std::vector<uint64_t>& result)
+	: data(data), length(length), grain(grain), result(result) {}
+	virtual ~AlgorithmsFor() {}
+
+	virtual void operator()() {
+		unsigned int* d = data;
+		std::vector<uint64_t>& r = result;
+		r.assign(length, 0);
+		parallel_for<Pheet>(static_cast<size_t>(0), length,
+			[d, &r](size_t i) {
+				r[i] += static_cast<uint64_t>(d[i]) * 2654435761u + i;
+			}, grain);
+		parallel_for_range<Pheet>(data, data + length,
+			[d, &r](unsigned int* begin, unsigned int* end) {
+				for(unsigned int* i = begin; i != end; ++i) {
+					r[i - d] += *i;
+				}
+			}, grain);
+	}
+
+	static void sequential(unsigned int* data, size_t length, std::vector<uint64_t>& result) {
+		result.assign(length, 0);
+		for(size_t i = 0; i < length; ++i) {
+			result[i] = static_cast<uint64_t>(data[i]) * 2654435761u + i + data[i];
+		}
+	}
+
+	static char const name[];
+
+private:
+	unsigned int* data;
+	size_t length;
+	size_t grain;
+	std::vector<uint64_t>& result;
+};
+
+template <class Pheet>
+char const AlgorithmsFor<Pheet>::name[] = "Algorithms parallel_for";
+
+}
+
+#endif /* ALGORITHMSFOR_H_ */
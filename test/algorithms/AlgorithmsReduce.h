@@ -0,0 +1,96 @@
+/*
+ * AlgorithmsReduce.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMSREDUCE_H_
+#define ALGORITHMSREDUCE_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_reduce.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * parallel_reduce computing a sum and a polynomial hash of the data. Combining hashes is
+ * associative but not commutative, so the hash only matches if chunks are combined in order.
+ */
+template <class Pheet>
+class AlgorithmsReduce : public Pheet::Task {
+public:
+	// Hash of a range and base^length of the range
+	typedef std::pair<uint64_t, uint64_t> Hash;
+
+	AlgorithmsReduce(unsigned int* data, size_t length, size_t grain, std::vector<uint64_t>& result)
+	: data(data), length(length), grain(grain), result(result) {}
+	virtual ~AlgorithmsReduce() {}
+
+	virtual void operator()() {
+		unsigned int* d = data;
+		uint64_t sum = parallel_reduce<Pheet>(static_cast<size_t>(0), length, static_cast<uint64_t>(0),
+			[d](size_t begin, size_t end) {
+				uint64_t s = 0;
+				for(size_t i = begin; i != end; ++i) {
+					s += d[i];
+				}
+				return s;
+			},
+			[](uint64_t a, uint64_t b) {
+				return a + b;
+			}, grain);
+		Hash hash = parallel_reduce<Pheet>(static_cast<size_t>(0), length, Hash(0, 1),
+			[d](size_t begin, size_t end) {
+				return hash_range(d + begin, d + end);
+			},
+			[](Hash const& a, Hash const& b) {
+				return Hash(a.first * b.second + b.first, a.second * b.second);
+			}, grain);
+		result.assign(1, sum);
+		result.push_back(hash.first);
+		result.push_back(hash.second);
+	}
+
+	static void sequential(unsigned int* data, size_t length, std::vector<uint64_t>& result) {
+		uint64_t sum = 0;
+		for(size_t i = 0; i < length; ++i) {
+			sum += data[i];
+		}
+		Hash hash = hash_range(data, data + length);
+		result.assign(1, sum);
+		result.push_back(hash.first);
+		result.push_back(hash.second);
+	}
+
+	static char const name[];
+
+private:
+	static Hash hash_range(unsigned int const* begin, unsigned int const* end) {
+		Hash h(0, 1);
+		for(unsigned int const* i = begin; i != end; ++i) {
+			h.first = h.first * base + *i;
+			h.second *= base;
+		}
+		return h;
+	}
+
+	static uint64_t const base = 1000003;
+
+	unsigned int* data;
+	size_t length;
+	size_t grain;
+	std::vector<uint64_t>& result;
+};
+
+template <class Pheet>
+char const AlgorithmsReduce<Pheet>::name[] = "Algorithms parallel_reduce";
+
+}
+
+#endif /* ALGORITHMSREDUCE_H_ */
@@ -0,0 +1,79 @@
+/*
+ * AlgorithmsScan.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMSSCAN_H_
+#define ALGORITHMSSCAN_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_scan.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Inclusive scan into a separate array, followed by an exclusive scan in place. The result
+ * holds both scans.
+ */
+template <class Pheet>
+class AlgorithmsScan : public Pheet::Task {
+public:
+	AlgorithmsScan(unsigned int* data, size_t length, size_t grain, std::vector<uint64_t>& result)
+	: data(data), length(length), grain(grain), result(result) {}
+	virtual ~AlgorithmsScan() {}
+
+	virtual void operator()() {
+		std::vector<unsigned int> inclusive(length);
+		std::vector<unsigned int> exclusive(data, data + length);
+		parallel_inclusive_scan<Pheet>(data, data + length, inclusive.begin(),
+			[](unsigned int a, unsigned int b) {
+				return a + b;
+			}, grain);
+		parallel_exclusive_scan<Pheet>(exclusive.begin(), exclusive.end(), exclusive.begin(), init,
+			[](unsigned int a, unsigned int b) {
+				return a + b;
+			}, grain);
+		result.assign(inclusive.begin(), inclusive.end());
+		result.insert(result.end(), exclusive.begin(), exclusive.end());
+	}
+
+	static void sequential(unsigned int* data, size_t length, std::vector<uint64_t>& result) {
+		result.assign(2 * length, 0);
+		unsigned int acc = 0;
+		for(size_t i = 0; i < length; ++i) {
+			acc += data[i];
+			result[i] = acc;
+		}
+		acc = init;
+		for(size_t i = 0; i < length; ++i) {
+			result[length + i] = acc;
+			acc += data[i];
+		}
+	}
+
+	static char const name[];
+
+private:
+	static unsigned int const init = 7;
+
+	unsigned int* data;
+	size_t length;
+	size_t grain;
+	std::vector<uint64_t>& result;
+};
+
+template <class Pheet>
+unsigned int const AlgorithmsScan<Pheet>::init;
+
+template <class Pheet>
+char const AlgorithmsScan<Pheet>::name[] = "Algorithms parallel_scan";
+
+}
+
+#endif /* ALGORITHMSSCAN_H_ */
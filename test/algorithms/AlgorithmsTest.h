@@ -0,0 +1,74 @@
+/*
+ * AlgorithmsTest.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMSTEST_H_
+#define ALGORITHMSTEST_H_
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <pheet/pheet.h>
+#include "../Test.h"
+
+namespace pheet {
+
+/*
+ * Runs Algorithm on random data and compares the result to Algorithm::sequential
+ */
+template <class Pheet, template <class P> class Algorithm>
+class AlgorithmsTest : Test {
+public:
+	AlgorithmsTest(procs_t cpus, size_t size, size_t grain, unsigned int seed)
+	: cpus(cpus), size(size), grain(grain), seed(seed) {}
+	~AlgorithmsTest() {}
+
+	void run_test();
+
+private:
+	procs_t cpus;
+	size_t size;
+	size_t grain;
+	unsigned int seed;
+};
+
+template <class Pheet, template <class P> class Algorithm>
+void AlgorithmsTest<Pheet, Algorithm>::run_test() {
+	std::vector<unsigned int> data(size);
+	std::mt19937 rng(seed);
+	for(size_t i = 0; i < size; ++i) {
+		data[i] = rng();
+	}
+	std::vector<uint64_t> expected;
+	Algorithm<Pheet>::sequential(data.data(), size, expected);
+
+	typename Pheet::Environment::PerformanceCounters pc;
+	std::vector<uint64_t> result;
+
+	Time start, end;
+	{typename Pheet::Environment env(cpus, pc);
+		check_time(start);
+		Pheet::template
+			finish<Algorithm<Pheet> >(data.data(), size, grain, result);
+		check_time(end);
+	}
+
+	bool correct = (result == expected);
+	double seconds = calculate_seconds(start, end);
+	std::cout << "test\talgorithm\tscheduler\tsize\tgrain\tseed\tcpus\ttotal_time\tcorrect\t";
+	Pheet::Environment::PerformanceCounters::print_headers();
+	std::cout << std::endl;
+	std::cout << "algorithms\t" << Algorithm<Pheet>::name << "\t";
+	Pheet::Environment::print_name();
+	std::cout << "\t" << size << "\t" << grain << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << correct << "\t";
+	pc.print_values();
+	std::cout << std::endl;
+}
+
+} /* namespace pheet */
+#endif /* ALGORITHMSTEST_H_ */
@@ -0,0 +1,49 @@
+/*
+ * AlgorithmsTests.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#include "AlgorithmsTests.h"
+
+#ifdef ALGORITHMS_TEST
+#include "AlgorithmsFor.h"
+#include "AlgorithmsReduce.h"
+#include "AlgorithmsScan.h"
+
+#include <pheet/sched/Basic/BasicScheduler.h>
+#include <pheet/sched/Strategy/StrategyScheduler.h>
+#endif
+
+namespace pheet {
+
+AlgorithmsTests::AlgorithmsTests() {
+
+}
+
+AlgorithmsTests::~AlgorithmsTests() {
+
+}
+
+void AlgorithmsTests::run_test() {
+#ifdef ALGORITHMS_TEST
+	std::cout << "----" << std::endl;
+
+	this->run_algorithm<	Pheet::WithScheduler<BasicScheduler>,
+						AlgorithmsFor>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler>,
+						AlgorithmsFor>();
+	this->run_algorithm<	Pheet::WithScheduler<BasicScheduler>,
+						AlgorithmsReduce>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler>,
+						AlgorithmsReduce>();
+	this->run_algorithm<	Pheet::WithScheduler<BasicScheduler>,
+						AlgorithmsScan>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler>,
+						AlgorithmsScan>();
+#endif
+}
+
+} /* namespace pheet */
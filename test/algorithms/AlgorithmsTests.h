@@ -0,0 +1,64 @@
+/*
+ * AlgorithmsTests.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMSTESTS_H_
+#define ALGORITHMSTESTS_H_
+
+#include "../init.h"
+#include "../Test.h"
+#ifdef ALGORITHMS_TEST
+#include "AlgorithmsTest.h"
+#endif
+
+namespace pheet {
+
+class AlgorithmsTests : Test {
+public:
+	AlgorithmsTests();
+	virtual ~AlgorithmsTests();
+
+	void run_test();
+
+private:
+	template<class Pheet, template <class P> class Algorithm>
+	void run_algorithm();
+};
+
+template <class Pheet, template <class P> class Algorithm>
+void AlgorithmsTests::run_algorithm() {
+#ifdef ALGORITHMS_TEST
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	for(size_t n = 0; n < sizeof(algorithms_test_n)/sizeof(algorithms_test_n[0]); n++) {
+		for(size_t g = 0; g < sizeof(algorithms_test_grain)/sizeof(algorithms_test_grain[0]); g++) {
+			bool max_processed = false;
+			procs_t cpus;
+			for(size_t c = 0; c < sizeof(algorithms_test_cpus)/sizeof(algorithms_test_cpus[0]); c++) {
+				cpus = algorithms_test_cpus[c];
+				if(cpus >= max_cpus) {
+					if(!max_processed) {
+						cpus = max_cpus;
+						max_processed = true;
+					}
+					else {
+						continue;
+					}
+				}
+				for(size_t s = 0; s < sizeof(algorithms_test_seeds)/sizeof(algorithms_test_seeds[0]); s++) {
+					AlgorithmsTest<Pheet, Algorithm> at(cpus, algorithms_test_n[n], algorithms_test_grain[g], algorithms_test_seeds[s]);
+					at.run_test();
+				}
+			}
+		}
+	}
+#endif
+}
+
+} /* namespace pheet */
+#endif /* ALGORITHMSTESTS_H_ */
@@ -0,0 +1,3 @@
+
+TEST_OBJS += lib/algorithms/AlgorithmsTests.o
+TEST_OBJS_MIC += lib_mic/algorithms/AlgorithmsTests.o
\ No newline at end of file
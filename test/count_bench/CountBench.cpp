@@ -12,6 +12,9 @@
 #include "CountBench.h"
 #ifdef COUNT_BENCH
 #include <pheet/primitives/Counter/Simple/SimpleCounter.h>
+#include <pheet/primitives/Counter/Sharded/ShardedCounter.h>
+#include <pheet/primitives/Counter/Snzi/SnziCounter.h>
+#include <pheet/primitives/Counter/CombiningTree/CombiningTreeCounter.h>
 #include <pheet/primitives/Reducer/Sum/SumReducer.h>
 #include "CountBenchTask.h"
 #include "CountBenchHyperTask.h"
@@ -45,6 +48,18 @@ void CountBench::run_test() {
 	this->run_bench<	Pheet,
 						SumReducerCounter,
 						CountBenchHyperTask>();
+	this->run_bench<	Pheet,
+						ShardedCounter,
+						CountBenchTask>();
+	this->run_bench<	Pheet,
+						SnziCounter,
+						CountBenchTask>();
+	this->run_bench<	Pheet,
+						CombiningTreeCounter,
+						CountBenchTask>();
+
+	this->run_snzi_test<	Pheet,
+							SnziCounter>();
 #endif
 }
 
@@ -13,6 +13,7 @@
 #include "../Test.h"
 #ifdef COUNT_BENCH
 #include "CountTest.h"
+#include "SnziTest.h"
 #endif
 
 namespace pheet {
@@ -27,6 +28,9 @@ public:
 private:
 	template<class Pheet, template <class, typename> class Count, template <class, class> class Benchmark>
 	void run_bench();
+
+	template<class Pheet, template <class, typename> class Count>
+	void run_snzi_test();
 };
 
 
@@ -62,6 +66,41 @@ void CountBench::run_bench() {
 		}
 	}
 
+#endif
+}
+
+template <class Pheet, template <class, typename> class Count>
+void CountBench::run_snzi_test() {
+#ifdef COUNT_BENCH
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	for(size_t p = 0; p < sizeof(count_bench_p)/sizeof(count_bench_p[0]); p++) {
+		for(size_t n = 0; n < sizeof(count_bench_n)/sizeof(count_bench_n[0]); n++) {
+			bool max_processed = false;
+			procs_t cpus;
+			for(size_t c = 0; c < sizeof(count_bench_cpus)/sizeof(count_bench_cpus[0]); c++) {
+				cpus = count_bench_cpus[c];
+				if(cpus >= max_cpus) {
+					if(!max_processed) {
+						cpus = max_cpus;
+						max_processed = true;
+					}
+					else {
+						continue;
+					}
+				}
+				for(size_t s = 0; s < sizeof(count_bench_seeds)/sizeof(count_bench_seeds[0]); s++) {
+					SnziTest<Pheet, Count> st(cpus,
+							count_bench_n[n],
+							count_bench_p[p],
+							count_bench_seeds[s]);
+					st.run_test();
+				}
+			}
+		}
+	}
+
 #endif
 }
 } /* namespace context */
@@ -11,8 +11,33 @@
 
 #include "../Test.h"
 
+#include <random>
+
 namespace pheet {
 
+/*
+ * Number of increments issued by the benchmark tasks (same splitting and random numbers)
+ */
+inline size_t count_bench_increments(unsigned int seed, size_t blocks, double p) {
+	size_t ret = 0;
+	while(blocks > 1) {
+		size_t half = blocks >> 1;
+		ret += count_bench_increments(seed + half, blocks - half, p);
+		blocks = half;
+	}
+
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<double> dis(0, 1);
+
+	for(size_t i = 0; i <= 16384; ++i) {
+		double op = dis(rng);
+		if(op < p) {
+			++ret;
+		}
+	}
+	return ret;
+}
+
 template <class Pheet, template <class, typename> class CountT, template <class, class> class Benchmark>
 class CountTest : Test {
 public:
@@ -49,15 +74,16 @@ void CountTest<Pheet, Count, Benchmark>::run_test() {
 	}
 
 	size_t sum = s.get_sum();
+	bool correct = sum == count_bench_increments(seed, blocks, p);
 	double seconds = calculate_seconds(start, end);
-	std::cout << "test\tcounter\tscheduler\tblocks\tp\tseed\tcpus\ttotal_time\tsum\t";
+	std::cout << "test\tcounter\tscheduler\tblocks\tp\tseed\tcpus\ttotal_time\tsum\tcorrect\t";
 	Pheet::Environment::PerformanceCounters::print_headers();
 	std::cout << std::endl;
 	std::cout << "count_bench\t";
 	Count::print_name();
 	std::cout << "\t";
 	Pheet::Environment::print_name();
-	std::cout << "\t" << blocks << "\t" << p << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << sum << "\t";
+	std::cout << "\t" << blocks << "\t" << p << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << sum << "\t" << correct << "\t";
 	pc.print_values();
 	std::cout << std::endl;
 }
@@ -0,0 +1,73 @@
+/*
+ * SnziTest.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SNZITEST_H_
+#define SNZITEST_H_
+
+#include "../Test.h"
+#include "SnziTestTask.h"
+
+#include <atomic>
+
+namespace pheet {
+
+/*
+ * Checks that a counter with decrements is non-zero while increments are held, and zero
+ * once all of them have been decremented again
+ */
+template <class Pheet, template <class, typename> class CountT>
+class SnziTest : Test {
+public:
+	typedef CountT<Pheet, size_t> Count;
+
+	SnziTest(procs_t cpus, size_t blocks, double p, unsigned int seed)
+	:cpus(cpus), blocks(blocks), p(p), seed(seed) {}
+	~SnziTest() {}
+
+	void run_test();
+
+private:
+	procs_t cpus;
+	size_t blocks;
+	double p;
+	unsigned int seed;
+};
+
+template <class Pheet, template <class, typename> class CountT>
+void SnziTest<Pheet, CountT>::run_test() {
+
+	typename Pheet::Environment::PerformanceCounters pc;
+
+	Count s;
+	std::atomic<size_t> errors(0);
+
+	Time start, end;
+	{typename Pheet::Environment env(cpus, pc);
+		check_time(start);
+
+		Pheet::template
+			finish<SnziTestTask<Pheet, Count> >(s, errors, seed, blocks, p);
+		check_time(end);
+	}
+
+	bool correct = errors.load(std::memory_order_relaxed) == 0 && s.is_zero() && s.get_sum() == 0;
+	double seconds = calculate_seconds(start, end);
+	std::cout << "test\tcounter\tscheduler\tblocks\tp\tseed\tcpus\ttotal_time\tcorrect\t";
+	Pheet::Environment::PerformanceCounters::print_headers();
+	std::cout << std::endl;
+	std::cout << "snzi_test\t";
+	Count::print_name();
+	std::cout << "\t";
+	Pheet::Environment::print_name();
+	std::cout << "\t" << blocks << "\t" << p << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << correct << "\t";
+	pc.print_values();
+	std::cout << std::endl;
+}
+
+} /* namespace pheet */
+#endif /* SNZITEST_H_ */
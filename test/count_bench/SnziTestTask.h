@@ -0,0 +1,74 @@
+/*
+ * SnziTestTask.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SNZITESTTASK_H_
+#define SNZITESTTASK_H_
+
+#include <atomic>
+#include <random>
+#include "../init.h"
+
+namespace pheet {
+
+/*
+ * Increments and decrements the counter in random order. As long as the task holds
+ * increments that are not decremented yet, the counter must not be zero.
+ */
+template <class Pheet, class Count>
+class SnziTestTask : public Pheet::Task {
+public:
+	typedef SnziTestTask<Pheet, Count> Self;
+
+	SnziTestTask(Count& count, std::atomic<size_t>& errors, unsigned int seed, size_t blocks, double p)
+	:count(count), errors(errors), seed(seed), blocks(blocks), p(p) {}
+	~SnziTestTask() {
+
+	}
+
+	virtual void operator()() {
+		while(blocks > 1) {
+			size_t half = blocks >> 1;
+			Pheet::template
+				spawn<Self>(count, errors, seed + half, blocks - half, p);
+			blocks = half;
+		}
+
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<double> dis(0, 1);
+
+		size_t held = 0;
+		for(size_t i = 0; i <= 16384; ++i) {
+			double op = dis(rng);
+			if(op < p) {
+				count.incr();
+				++held;
+			}
+			else if(held > 0) {
+				count.decr();
+				--held;
+			}
+			if(held > 0 && count.is_zero()) {
+				errors.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		while(held > 0) {
+			count.decr();
+			--held;
+		}
+	}
+
+private:
+	Count& count;
+	std::atomic<size_t>& errors;
+	unsigned int seed;
+	size_t blocks;
+	double p;
+};
+
+} /* namespace pheet */
+#endif /* SNZITESTTASK_H_ */
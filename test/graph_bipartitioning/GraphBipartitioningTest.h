@@ -10,6 +10,7 @@
 #define GRAPHBIPARTITIONINGTEST_H_
 
 #include "graph_helpers.h"
+#include "../graph_generators/graph_generators.h"
 
 #include "pheet/pheet.h"
 #include "../Test.h"
@@ -48,7 +49,7 @@ private:
 };
 
 template <class Pheet, template <class P> class Partitioner>
-char const* const GraphBipartitioningTest<Pheet, Partitioner>::types[] = {"random"};
+char const* const GraphBipartitioningTest<Pheet, Partitioner>::types[] = {"random", "gnp", "rmat", "grid", "geometric"};
 
 template <class Pheet, template <class P> class Partitioner>
 GraphBipartitioningTest<Pheet, Partitioner>::GraphBipartitioningTest(procs_t cpus, int type, size_t size, float p, size_t max_w, unsigned int seed)
@@ -97,28 +98,47 @@ void GraphBipartitioningTest<Pheet, Partitioner>::run_test() {
 	delete_data(data);
 }
 
-// JLT: would like to have more generators - template?
+// Graph types other than "random" come from graph_generators.h
 template <class Pheet, template <class P> class Partitioner>
 GraphVertex* GraphBipartitioningTest<Pheet, Partitioner>::generate_data() {
 	GraphVertex* data = new GraphVertex[size];
 
-	std::mt19937 rng;
-	rng.seed(seed);
-    std::uniform_real_distribution<float> rnd_f(0.0, 1.0);
-    std::uniform_int_distribution<size_t> rnd_st(1, max_w);
-
 	std::vector<GraphEdge>* edges = new std::vector<GraphEdge>[size];
-	for(size_t i = 0; i < size; ++i) {
-		for(size_t j = i + 1; j < size; ++j) {
-			if(rnd_f(rng) < p) {
-				GraphEdge e;
-				e.target = j;
-				e.weight = rnd_st(rng);
-				edges[i].push_back(e);
-				e.target = i;
-				edges[j].push_back(e);
+	if(type == 0) {
+		std::mt19937 rng;
+		rng.seed(seed);
+		std::uniform_real_distribution<float> rnd_f(0.0, 1.0);
+		std::uniform_int_distribution<size_t> rnd_st(1, max_w);
+
+		for(size_t i = 0; i < size; ++i) {
+			for(size_t j = i + 1; j < size; ++j) {
+				if(rnd_f(rng) < p) {
+					GraphEdge e;
+					e.target = j;
+					e.weight = rnd_st(rng);
+					edges[i].push_back(e);
+					e.target = i;
+					edges[j].push_back(e);
+				}
 			}
 		}
+	}
+	else {
+		GeneratedGraph g;
+		{pheet::Pheet::Environment env;
+			generate_graph<pheet::Pheet>(type, size, p, max_w, seed, g);
+		}
+		for(size_t i = 0; i < g.num_edges(); ++i) {
+			GraphEdge e;
+			e.target = g.targets[i];
+			e.weight = g.weights[i];
+			edges[g.sources[i]].push_back(e);
+			e.target = g.sources[i];
+			edges[g.targets[i]].push_back(e);
+		}
+	}
+
+	for(size_t i = 0; i < size; ++i) {
 		data[i].num_edges = edges[i].size();
 		if(edges[i].size() > 0) {
 			data[i].edges = new GraphEdge[edges[i].size()];
@@ -0,0 +1,362 @@
+/*
+ * graph_generators.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef GRAPH_GENERATORS_H_
+#define GRAPH_GENERATORS_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_for.h>
+#include <pheet/algorithms/parallel_sort.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Parallel generators for the undirected test graphs of the SSSP and graph bipartitioning
+ * tests. Graph types are selected by the *_test_types arrays of the test variants:
+ *
+ * 0 random:    G(n, p) generated sequentially by the tests themselves (kept to reproduce
+ *              the graphs of earlier runs)
+ * 1 gnp:       G(n, p), generated in O(n + m) by skipping over non-edges
+ * 2 rmat:      R-MAT/Kronecker graph with the Graph500 parameters (a, b, c) = (0.57, 0.19, 0.19)
+ *              and p * n * (n - 1) / 2 edge samples (duplicates and self-loops are removed).
+ *              Vertex ids are permuted, except that the vertex with the highest degree gets id 0
+ * 3 grid:      2D grid with 4-neighborhood, the last row may be partial, p is ignored
+ * 4 geometric: random geometric graph in the unit square, with a radius chosen for an expected
+ *              degree of p * (n - 1). Weights grow with the distance
+ *
+ * Weights are drawn uniformly from [1, max_w] unless stated otherwise.
+ * Work is split into a fixed number of chunks, each with its own random number generator
+ * seeded from (seed, type, chunk), so the generated graph only depends on the seed, not on
+ * the number of places. Each undirected edge is listed once.
+ */
+char const* const graph_generator_types[] = {"random", "gnp", "rmat", "grid", "geometric"};
+
+/*
+ * Number of vertices (or edge samples for R-MAT) handled by a single chunk
+ */
+size_t const graph_generator_chunk_size = 4096;
+
+struct GeneratedGraph {
+	size_t num_vertices;
+	std::vector<uint32_t> sources;
+	std::vector<uint32_t> targets;
+	std::vector<uint32_t> weights;
+
+	GeneratedGraph()
+	: num_vertices(0) {}
+
+	size_t num_edges() const {
+		return sources.size();
+	}
+
+	void add(uint32_t source, uint32_t target, uint32_t weight) {
+		sources.push_back(source);
+		targets.push_back(target);
+		weights.push_back(weight);
+	}
+};
+
+inline std::mt19937_64 graph_generator_rng(unsigned int seed, int type, size_t chunk) {
+	std::seed_seq seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(type), static_cast<uint32_t>(chunk), static_cast<uint32_t>(chunk >> 32)};
+	return std::mt19937_64(seq);
+}
+
+/*
+ * Runs f(chunk, part) for all chunks in parallel and concatenates the parts in chunk order
+ */
+template <class Pheet, class F>
+void graph_generator_run_chunks(size_t num_chunks, GeneratedGraph& g, F&& f) {
+	std::vector<GeneratedGraph> parts(num_chunks);
+	parallel_for<Pheet>(static_cast<size_t>(0), num_chunks,
+		[&](size_t c) {
+			f(c, parts[c]);
+		}, 1);
+
+	std::vector<size_t> offsets(num_chunks + 1, 0);
+	for(size_t c = 0; c < num_chunks; ++c) {
+		offsets[c + 1] = offsets[c] + parts[c].num_edges();
+	}
+	g.sources.resize(offsets[num_chunks]);
+	g.targets.resize(offsets[num_chunks]);
+	g.weights.resize(offsets[num_chunks]);
+	parallel_for<Pheet>(static_cast<size_t>(0), num_chunks,
+		[&](size_t c) {
+			std::copy(parts[c].sources.begin(), parts[c].sources.end(), g.sources.begin() + offsets[c]);
+			std::copy(parts[c].targets.begin(), parts[c].targets.end(), g.targets.begin() + offsets[c]);
+			std::copy(parts[c].weights.begin(), parts[c].weights.end(), g.weights.begin() + offsets[c]);
+		}, 1);
+}
+
+template <class Pheet>
+void generate_gnp_graph(size_t n, double p, size_t max_w, unsigned int seed, GeneratedGraph& g) {
+	g.num_vertices = n;
+	if(n < 2 || p <= 0.0) {
+		return;
+	}
+	double log_q = std::log(1.0 - std::min(p, 1.0));
+	size_t num_chunks = (n + graph_generator_chunk_size - 1) / graph_generator_chunk_size;
+	graph_generator_run_chunks<Pheet>(num_chunks, g,
+		[&](size_t c, GeneratedGraph& part) {
+			std::mt19937_64 rng = graph_generator_rng(seed, 1, c);
+			std::uniform_real_distribution<double> rnd_f(0.0, 1.0);
+			std::uniform_int_distribution<uint32_t> rnd_w(1, max_w);
+			size_t end = std::min(n, (c + 1) * graph_generator_chunk_size);
+			for(size_t i = c * graph_generator_chunk_size; i < end; ++i) {
+				size_t j = i;
+				while(true) {
+					if(p >= 1.0) {
+						++j;
+					}
+					else {
+						// Number of non-edges before the next edge is geometrically distributed
+						double skip = std::floor(std::log(1.0 - rnd_f(rng)) / log_q);
+						if(skip >= static_cast<double>(n)) {
+							break;
+						}
+						j += 1 + static_cast<size_t>(skip);
+					}
+					if(j >= n) {
+						break;
+					}
+					part.add(i, j, rnd_w(rng));
+				}
+			}
+		});
+}
+
+struct GraphGeneratorRmatEdge {
+	uint64_t key;
+	uint32_t weight;
+};
+
+template <class Pheet>
+void generate_rmat_graph(size_t n, double p, size_t max_w, unsigned int seed, GeneratedGraph& g) {
+	g.num_vertices = n;
+	if(n < 2) {
+		return;
+	}
+	double const a = 0.57;
+	double const b = 0.19;
+	double const c = 0.19;
+	size_t scale = 0;
+	while((static_cast<size_t>(1) << scale) < n) {
+		++scale;
+	}
+	size_t samples = static_cast<size_t>(std::llround(p * static_cast<double>(n) * static_cast<double>(n - 1) / 2.0));
+
+	std::vector<uint32_t> perm(n);
+	for(size_t i = 0; i < n; ++i) {
+		perm[i] = i;
+	}
+	{
+		std::mt19937_64 rng = graph_generator_rng(seed, 2, static_cast<size_t>(-1));
+		std::shuffle(perm.begin(), perm.end(), rng);
+	}
+
+	size_t num_chunks = (samples + graph_generator_chunk_size - 1) / graph_generator_chunk_size;
+	std::vector<GraphGeneratorRmatEdge> edges(samples);
+	parallel_for<Pheet>(static_cast<size_t>(0), num_chunks,
+		[&](size_t chunk) {
+			std::mt19937_64 rng = graph_generator_rng(seed, 2, chunk);
+			std::uniform_real_distribution<double> rnd_f(0.0, 1.0);
+			std::uniform_int_distribution<uint32_t> rnd_w(1, max_w);
+			size_t end = std::min(samples, (chunk + 1) * graph_generator_chunk_size);
+			for(size_t e = chunk * graph_generator_chunk_size; e < end; ++e) {
+				uint64_t u, v;
+				do {
+					u = 0;
+					v = 0;
+					for(size_t bit = 0; bit < scale; ++bit) {
+						double r = rnd_f(rng);
+						if(r >= a + b + c) {
+							u |= static_cast<uint64_t>(1) << bit;
+							v |= static_cast<uint64_t>(1) << bit;
+						}
+						else if(r >= a + b) {
+							u |= static_cast<uint64_t>(1) << bit;
+						}
+						else if(r >= a) {
+							v |= static_cast<uint64_t>(1) << bit;
+						}
+					}
+				} while(u >= n || v >= n || u == v);
+				u = perm[u];
+				v = perm[v];
+				edges[e].key = (std::min(u, v) << 32) | std::max(u, v);
+				edges[e].weight = rnd_w(rng);
+			}
+		}, 1);
+
+	// Vertex 0 is the source of the SSSP tests. Swap it with the vertex of the highest degree,
+	// so it is part of the large connected component
+	if(samples != 0) {
+		std::vector<size_t> degree(n, 0);
+		for(size_t e = 0; e < samples; ++e) {
+			++degree[edges[e].key >> 32];
+			++degree[edges[e].key & 0xFFFFFFFF];
+		}
+		uint64_t hub = std::max_element(degree.begin(), degree.end()) - degree.begin();
+		if(hub != 0) {
+			parallel_for<Pheet>(static_cast<size_t>(0), samples,
+				[&](size_t e) {
+					uint64_t u = edges[e].key >> 32;
+					uint64_t v = edges[e].key & 0xFFFFFFFF;
+					u = (u == hub)?0:((u == 0)?hub:u);
+					v = (v == hub)?0:((v == 0)?hub:v);
+					edges[e].key = (std::min(u, v) << 32) | std::max(u, v);
+				});
+		}
+	}
+
+	// Remove duplicates, keeping the smallest weight. Sorting by weight as well keeps this deterministic
+	parallel_sort<Pheet>(edges.begin(), edges.end(),
+		[](GraphGeneratorRmatEdge const& x, GraphGeneratorRmatEdge const& y) {
+			return x.key < y.key || (x.key == y.key && x.weight < y.weight);
+		});
+	for(size_t e = 0; e < samples; ++e) {
+		if(e == 0 || edges[e].key != edges[e - 1].key) {
+			g.add(edges[e].key >> 32, edges[e].key & 0xFFFFFFFF, edges[e].weight);
+		}
+	}
+}
+
+template <class Pheet>
+void generate_grid_graph(size_t n, size_t max_w, unsigned int seed, GeneratedGraph& g) {
+	g.num_vertices = n;
+	size_t side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(n))));
+	size_t num_chunks = (n + graph_generator_chunk_size - 1) / graph_generator_chunk_size;
+	graph_generator_run_chunks<Pheet>(num_chunks, g,
+		[&](size_t c, GeneratedGraph& part) {
+			std::mt19937_64 rng = graph_generator_rng(seed, 3, c);
+			std::uniform_int_distribution<uint32_t> rnd_w(1, max_w);
+			size_t end = std::min(n, (c + 1) * graph_generator_chunk_size);
+			for(size_t i = c * graph_generator_chunk_size; i < end; ++i) {
+				if((i % side) + 1 < side && i + 1 < n) {
+					part.add(i, i + 1, rnd_w(rng));
+				}
+				if(i + side < n) {
+					part.add(i, i + side, rnd_w(rng));
+				}
+			}
+		});
+}
+
+template <class Pheet>
+void generate_geometric_graph(size_t n, double p, size_t max_w, unsigned int seed, GeneratedGraph& g) {
+	g.num_vertices = n;
+	if(n < 2 || p <= 0.0) {
+		return;
+	}
+	double const pi = 3.14159265358979323846;
+	double r = std::sqrt(p * static_cast<double>(n - 1) / (pi * static_cast<double>(n)));
+	double r2 = r * r;
+
+	std::vector<double> x(n), y(n);
+	size_t num_chunks = (n + graph_generator_chunk_size - 1) / graph_generator_chunk_size;
+	parallel_for<Pheet>(static_cast<size_t>(0), num_chunks,
+		[&](size_t c) {
+			std::mt19937_64 rng = graph_generator_rng(seed, 4, c);
+			std::uniform_real_distribution<double> rnd_f(0.0, 1.0);
+			size_t end = std::min(n, (c + 1) * graph_generator_chunk_size);
+			for(size_t i = c * graph_generator_chunk_size; i < end; ++i) {
+				x[i] = rnd_f(rng);
+				y[i] = rnd_f(rng);
+			}
+		}, 1);
+
+	// Cells are at least r wide, so only neighboring cells need to be compared
+	size_t cells = std::max(static_cast<size_t>(1), std::min(static_cast<size_t>(1.0 / r), static_cast<size_t>(std::sqrt(static_cast<double>(n))) + 1));
+	std::vector<size_t> cell_begin(cells * cells + 1, 0);
+	std::vector<uint32_t> order(n);
+	auto cell_of = [&](size_t i) {
+		size_t cx = std::min(static_cast<size_t>(x[i] * cells), cells - 1);
+		size_t cy = std::min(static_cast<size_t>(y[i] * cells), cells - 1);
+		return cy * cells + cx;
+	};
+	for(size_t i = 0; i < n; ++i) {
+		++cell_begin[cell_of(i) + 1];
+	}
+	for(size_t i = 0; i < cells * cells; ++i) {
+		cell_begin[i + 1] += cell_begin[i];
+	}
+	{
+		std::vector<size_t> pos(cell_begin.begin(), cell_begin.end() - 1);
+		for(size_t i = 0; i < n; ++i) {
+			order[pos[cell_of(i)]++] = i;
+		}
+	}
+
+	// One chunk per row of cells. Each pair of cells is only compared once
+	graph_generator_run_chunks<Pheet>(cells, g,
+		[&](size_t cy, GeneratedGraph& part) {
+			for(size_t cx = 0; cx < cells; ++cx) {
+				size_t cell = cy * cells + cx;
+				for(size_t k = cell_begin[cell]; k < cell_begin[cell + 1]; ++k) {
+					uint32_t i = order[k];
+					auto compare = [&](size_t from, size_t to) {
+						for(size_t l = from; l < to; ++l) {
+							uint32_t j = order[l];
+							double dx = x[i] - x[j];
+							double dy = y[i] - y[j];
+							double d2 = dx * dx + dy * dy;
+							if(d2 <= r2) {
+								double w = std::ceil(std::sqrt(d2) / r * static_cast<double>(max_w));
+								part.add(i, j, static_cast<uint32_t>(std::min(std::max(w, 1.0), static_cast<double>(max_w))));
+							}
+						}
+					};
+					compare(k + 1, cell_begin[cell + 1]);
+					if(cx + 1 < cells) {
+						compare(cell_begin[cell + 1], cell_begin[cell + 2]);
+					}
+					if(cy + 1 < cells) {
+						size_t below = cell + cells;
+						size_t first = (cx > 0)?(below - 1):below;
+						size_t last = (cx + 1 < cells)?(below + 1):below;
+						// Cells first..last are consecutive
+						compare(cell_begin[first], cell_begin[last + 1]);
+					}
+				}
+			}
+		});
+}
+
+/*
+ * Generates a graph of the given type (see graph_generator_types, type 0 is not handled here).
+ * Needs to be called from within a place.
+ */
+template <class Pheet>
+void generate_graph(int type, size_t n, double p, size_t max_w, unsigned int seed, GeneratedGraph& g) {
+	switch(type) {
+	case 1:
+		generate_gnp_graph<Pheet>(n, p, max_w, seed, g);
+		break;
+	case 2:
+		generate_rmat_graph<Pheet>(n, p, max_w, seed, g);
+		break;
+	case 3:
+		generate_grid_graph<Pheet>(n, max_w, seed, g);
+		break;
+	case 4:
+		generate_geometric_graph<Pheet>(n, p, max_w, seed, g);
+		break;
+	default:
+		throw std::runtime_error("unknown graph type");
+	}
+}
+
+}
+
+#endif /* GRAPH_GENERATORS_H_ */
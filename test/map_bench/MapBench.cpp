@@ -0,0 +1,37 @@
+/*
+ * MapBench.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+
+#include "../init.h"
+
+#include "MapBench.h"
+#ifdef MAP_BENCH
+#include <pheet/ds/Map/ConcurrentCuckoo/ConcurrentCuckooHashMap.h>
+#endif
+
+namespace pheet {
+
+MapBench::MapBench() {
+
+}
+
+MapBench::~MapBench() {
+
+}
+
+
+void MapBench::run_test() {
+#ifdef MAP_BENCH
+	std::cout << "----" << std::endl;
+
+	this->run_bench<	Pheet,
+						ConcurrentCuckooHashMap>();
+#endif
+}
+
+} /* namespace pheet */
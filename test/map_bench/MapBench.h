@@ -0,0 +1,70 @@
+/*
+ * MapBench.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef MAPBENCH_H_
+#define MAPBENCH_H_
+
+#include "../init.h"
+#include "../Test.h"
+#ifdef MAP_BENCH
+#include "MapTest.h"
+#endif
+
+namespace pheet {
+
+class MapBench : Test {
+public:
+	MapBench();
+	~MapBench();
+
+	void run_test();
+
+private:
+	template<class Pheet, template <class, typename, typename> class Map>
+	void run_bench();
+};
+
+
+template <class Pheet, template <class, typename, typename> class Map>
+void MapBench::run_bench() {
+#ifdef MAP_BENCH
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	for(size_t r = 0; r < sizeof(map_bench_range)/sizeof(map_bench_range[0]); r++) {
+		for(size_t b = 0; b < sizeof(map_bench_blocks)/sizeof(map_bench_blocks[0]); b++) {
+			bool max_processed = false;
+			procs_t cpus;
+			for(size_t c = 0; c < sizeof(map_bench_cpus)/sizeof(map_bench_cpus[0]); c++) {
+				cpus = map_bench_cpus[c];
+				if(cpus >= max_cpus) {
+					if(!max_processed) {
+						cpus = max_cpus;
+						max_processed = true;
+					}
+					else {
+						continue;
+					}
+				}
+				for(size_t s = 0; s < sizeof(map_bench_seeds)/sizeof(map_bench_seeds[0]); s++) {
+					MapTest<Pheet, Map> gbt(cpus,
+							map_bench_range[r],
+							map_bench_blocks[b],
+							map_bench_find_p,
+							map_bench_put_p,
+							map_bench_seeds[s]);
+					gbt.run_test();
+				}
+			}
+		}
+	}
+
+#endif
+}
+} /* namespace pheet */
+#endif /* MAPBENCH_H_ */
@@ -0,0 +1,97 @@
+/*
+ * MapBenchTask.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef MAPBENCHTASK_H_
+#define MAPBENCHTASK_H_
+
+#include <atomic>
+#include <random>
+#include <vector>
+#include "../init.h"
+
+namespace pheet {
+
+/*
+ * Block b owns the keys i * num_blocks + b for i < range, so the expected result of every
+ * operation is known to the block, while the buckets are shared with the other blocks.
+ * Values are never 0, 0 marks a key that is not in the map.
+ */
+template <class Pheet, class Map>
+class MapBenchTask : public Pheet::Task {
+public:
+	typedef MapBenchTask<Pheet, Map> Self;
+
+	MapBenchTask(Map& map, std::atomic<size_t>& errors, std::atomic<size_t>& expected_size, size_t range, size_t block, size_t blocks, size_t num_blocks, double find_p, double put_p, unsigned int seed)
+	:map(map), errors(errors), expected_size(expected_size), range(range), block(block), blocks(blocks), num_blocks(num_blocks), find_p(find_p), put_p(put_p), seed(seed) {}
+	~MapBenchTask() {
+
+	}
+
+	virtual void operator()() {
+		while(blocks > 1) {
+			size_t half = blocks >> 1;
+			Pheet::template
+				spawn<Self>(map, errors, expected_size, range, block + half, blocks - half, num_blocks, find_p, put_p, seed);
+			blocks = half;
+		}
+
+		std::mt19937 rng(seed + block);
+		std::uniform_int_distribution<size_t> rnd(0, range - 1);
+		std::uniform_real_distribution<double> dis(0, 1);
+
+		std::vector<size_t> model(range, 0);
+		size_t size = 0;
+		size_t err = 0;
+		for(size_t i = 0; i <= 16384; ++i) {
+			size_t item = rnd(rng);
+			size_t key = item * num_blocks + block;
+			double op = dis(rng);
+			size_t value = 0;
+			if(op < find_p) {
+				bool found = map.find(key, value);
+				if(found != (model[item] != 0) || (found && value != model[item])) {
+					++err;
+				}
+			}
+			else if(op < find_p + put_p) {
+				if(model[item] == 0) {
+					++size;
+				}
+				model[item] = i + 1;
+				map.put(key, i + 1);
+			}
+			else {
+				bool found = map.retrieve(key, value);
+				if(found != (model[item] != 0) || (found && value != model[item])) {
+					++err;
+				}
+				if(model[item] != 0) {
+					--size;
+				}
+				model[item] = 0;
+			}
+		}
+		errors.fetch_add(err, std::memory_order_relaxed);
+		expected_size.fetch_add(size, std::memory_order_relaxed);
+	}
+
+private:
+	Map& map;
+	std::atomic<size_t>& errors;
+	std::atomic<size_t>& expected_size;
+	size_t range;
+	size_t block;
+	size_t blocks;
+	size_t num_blocks;
+	double find_p;
+	double put_p;
+	unsigned int seed;
+};
+
+} /* namespace pheet */
+#endif /* MAPBENCHTASK_H_ */
@@ -0,0 +1,79 @@
+/*
+ * MapTest.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef MAPTEST_H_
+#define MAPTEST_H_
+
+#include "MapBenchTask.h"
+#include "../Test.h"
+
+#include <atomic>
+
+namespace pheet {
+
+/*
+ * All blocks work on the same map, which starts out small and has to grow while
+ * the blocks are running. Each block checks the results of its operations against
+ * a sequential model of its own keys, and the final size of the map against the
+ * models of all blocks.
+ */
+template <class Pheet, template <class, typename, typename> class MapT>
+class MapTest : Test {
+public:
+	typedef MapT<Pheet, size_t, size_t> Map;
+
+	MapTest(procs_t cpus, size_t range, size_t blocks, double find_p, double put_p, unsigned int seed)
+	:cpus(cpus), range(range), blocks(blocks), find_p(find_p), put_p(put_p), seed(seed) {}
+	~MapTest() {}
+
+	void run_test();
+
+private:
+	procs_t cpus;
+	size_t range;
+	size_t blocks;
+	double find_p;
+	double put_p;
+	unsigned int seed;
+};
+
+template <class Pheet, template <class, typename, typename> class MapT>
+void MapTest<Pheet, MapT>::run_test() {
+
+	typename Pheet::Environment::PerformanceCounters pc;
+
+	std::atomic<size_t> errors(0);
+	std::atomic<size_t> expected_size(0);
+	size_t final_size;
+	Time start, end;
+	{typename Pheet::Environment env(cpus, pc);
+		Map m;
+		check_time(start);
+
+		Pheet::template
+			finish<MapBenchTask<Pheet, Map> >(m, errors, expected_size, range, 0, blocks, blocks, find_p, put_p, seed);
+		check_time(end);
+		final_size = m.size();
+	}
+
+	bool correct = errors.load() == 0 && final_size == expected_size.load();
+	double seconds = calculate_seconds(start, end);
+	std::cout << "test\tmap\tscheduler\trange\tblocks\tfind_p\tput_p\tseed\tcpus\ttotal_time\tsize\tcorrect\t";
+	Pheet::Environment::PerformanceCounters::print_headers();
+	std::cout << std::endl;
+	std::cout << "map_bench\t";
+	Map::print_name();
+	std::cout << "\t";
+	Pheet::Environment::print_name();
+	std::cout << "\t" << range << "\t" << blocks << "\t" << find_p << "\t" << put_p << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << final_size << "\t" << correct << "\t";
+	pc.print_values();
+	std::cout << std::endl;
+}
+
+} /* namespace pheet */
+#endif /* MAPTEST_H_ */
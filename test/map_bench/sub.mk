@@ -0,0 +1,3 @@
+
+TEST_OBJS += lib/map_bench/MapBench.o
+TEST_OBJS_MIC += lib_mic/map_bench/MapBench.o
\ No newline at end of file
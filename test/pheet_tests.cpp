@@ -21,7 +21,12 @@
 #include "prefix_sum/PrefixSumTests.h"
 #include "sssp/SsspTests.h"
 #include "set_bench/SetBench.h"
+#include "map_bench/MapBench.h"
+#include "pipeline/PipelineTests.h"
+#include "algorithms/AlgorithmsTests.h"
 #include "count_bench/CountBench.h"
+#include "stealing_deque_bench/StealingDequeBench.h"
+#include "place_storage_bench/PlaceStorageBench.h"
 #include <map>
 #include <string>
 
@@ -86,8 +91,23 @@ int main(int argc, char* argv[]) {
 	SetBench sb;
 	sb.run_test();
 
+	MapBench mb;
+	mb.run_test();
+
+	PipelineTests plt;
+	plt.run_test();
+
+	AlgorithmsTests at;
+	at.run_test();
+
 	CountBench cb;
 	cb.run_test();
 
+	StealingDequeBench sdb;
+	sdb.run_test();
+
+	PlaceStorageBench psb;
+	psb.run_test();
+
 	return 0;
 }
@@ -0,0 +1,88 @@
+/*
+ * PipelineTest.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PIPELINETEST_H_
+#define PIPELINETEST_H_
+
+#include <iostream>
+#include <pheet/pheet.h>
+#include <pheet/ds/PipelineBuffer/Ordered/OrderedPipelineBuffer.h>
+#include "../Test.h"
+
+#include "PipelineTestStages.h"
+
+namespace pheet {
+
+/*
+ * Source -> parallel stage -> serial in-order stage and serial out-of-order stage.
+ * Checks that the in-order stage sees all elements in order of their ids and the
+ * out-of-order stage sees every element exactly once, and that no serial stage is
+ * ever executed concurrently.
+ */
+template <class Pheet, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+class PipelineTest : Test {
+public:
+	typedef OrderedPipelineBufferImpl<Pheet, PipelineOrderedStage, size_t, PipelineStageMode::serial_in_order, Granularity, Capacity, WindowCapacity> OrderedBuffer;
+	typedef OrderedPipelineBufferImpl<Pheet, PipelineUnorderedStage, size_t, PipelineStageMode::serial_out_of_order, Granularity, Capacity, WindowCapacity> UnorderedBuffer;
+	typedef PipelineWorkStage<Pheet, OrderedBuffer, UnorderedBuffer> WorkStage;
+	typedef OrderedPipelineBufferImpl<Pheet, WorkStage, size_t, PipelineStageMode::parallel, Granularity, Capacity, WindowCapacity> WorkBuffer;
+
+	PipelineTest(procs_t cpus, size_t n, unsigned int seed)
+	:cpus(cpus), n(n), seed(seed) {}
+	~PipelineTest() {}
+
+	void run_test();
+
+private:
+	procs_t cpus;
+	size_t n;
+	unsigned int seed;
+};
+
+template <class Pheet, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void PipelineTest<Pheet, Granularity, Capacity, WindowCapacity>::run_test() {
+	typename Pheet::Environment::PerformanceCounters pc;
+
+	PipelineOrderedStage ordered_stage(seed);
+	PipelineUnorderedStage unordered_stage(n, seed);
+
+	Time start, end;
+	{typename Pheet::Environment env(cpus, pc);
+		OrderedBuffer ordered(ordered_stage);
+		UnorderedBuffer unordered(unordered_stage);
+		WorkStage work_stage(ordered, unordered);
+		WorkBuffer work(work_stage);
+		check_time(start);
+
+		Pheet::finish([&]() {
+			work.close(n);
+			ordered.close(n);
+			unordered.close(n);
+			Pheet::template
+				call<PipelineSourceTask<Pheet, WorkBuffer> >(work, 0, n, seed);
+		});
+		check_time(end);
+	}
+
+	bool correct = ordered_stage.errors.load() == 0 && ordered_stage.next == n
+			&& unordered_stage.errors.load() == 0 && unordered_stage.count == n;
+	double seconds = calculate_seconds(start, end);
+	std::cout << "test\tbuffer\tscheduler\tn\tseed\tcpus\ttotal_time\tcorrect\t";
+	Pheet::Environment::PerformanceCounters::print_headers();
+	std::cout << std::endl;
+	std::cout << "pipeline\t";
+	OrderedBuffer::print_name();
+	std::cout << "\t";
+	Pheet::Environment::print_name();
+	std::cout << "\t" << n << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << correct << "\t";
+	pc.print_values();
+	std::cout << std::endl;
+}
+
+} /* namespace pheet */
+#endif /* PIPELINETEST_H_ */
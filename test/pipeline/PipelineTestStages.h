@@ -0,0 +1,127 @@
+/*
+ * PipelineTestStages.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PIPELINETESTSTAGES_H_
+#define PIPELINETESTSTAGES_H_
+
+#include <atomic>
+#include <vector>
+#include "../init.h"
+
+namespace pheet {
+
+inline size_t pipeline_test_value(size_t id, unsigned int seed) {
+	return (id ^ seed) * 3 + 1;
+}
+
+/*
+ * Puts the ids [begin, end) into the buffer. Ranges are split and spawned, so elements
+ * are put out of order and from several places
+ */
+template <class Pheet, class Buffer>
+class PipelineSourceTask : public Pheet::Task {
+public:
+	typedef PipelineSourceTask<Pheet, Buffer> Self;
+
+	PipelineSourceTask(Buffer& buffer, size_t begin, size_t end, unsigned int seed)
+	:buffer(buffer), begin(begin), end(end), seed(seed) {}
+	~PipelineSourceTask() {}
+
+	virtual void operator()() {
+		while(end - begin > 256) {
+			size_t middle = begin + ((end - begin) >> 1);
+			Pheet::template
+				spawn<Self>(buffer, middle, end, seed);
+			end = middle;
+		}
+		for(size_t i = begin; i < end; ++i) {
+			buffer.put(i, i ^ seed);
+		}
+	}
+
+private:
+	Buffer& buffer;
+	size_t begin;
+	size_t end;
+	unsigned int seed;
+};
+
+/*
+ * Parallel stage with uneven work per element, so blocks complete out of order
+ */
+template <class Pheet, class OrderedBuffer, class UnorderedBuffer>
+class PipelineWorkStage {
+public:
+	PipelineWorkStage(OrderedBuffer& ordered, UnorderedBuffer& unordered)
+	:ordered(ordered), unordered(unordered) {}
+
+	void operator()(size_t id, size_t value) {
+		size_t work = ((id * 7919) % 61 == 0)?20000:100;
+		volatile size_t x = 0;
+		for(size_t i = 0; i < work; ++i) {
+			x = x + i;
+		}
+		ordered.put(id, value * 3 + 1);
+		unordered.put(id, value * 3 + 1);
+	}
+
+private:
+	OrderedBuffer& ordered;
+	UnorderedBuffer& unordered;
+};
+
+/*
+ * Serial in-order stage. Expects consecutive ids starting at 0
+ */
+class PipelineOrderedStage {
+public:
+	PipelineOrderedStage(unsigned int seed)
+	:seed(seed), next(0), active(0), errors(0) {}
+
+	void operator()(size_t id, size_t value) {
+		if(active.fetch_add(1, std::memory_order_relaxed) != 0 || id != next || value != pipeline_test_value(id, seed)) {
+			errors.fetch_add(1, std::memory_order_relaxed);
+		}
+		++next;
+		active.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	unsigned int seed;
+	size_t next;
+	std::atomic<int> active;
+	std::atomic<size_t> errors;
+};
+
+/*
+ * Serial out-of-order stage. Expects every id exactly once
+ */
+class PipelineUnorderedStage {
+public:
+	PipelineUnorderedStage(size_t n, unsigned int seed)
+	:seed(seed), seen(n, false), count(0), active(0), errors(0) {}
+
+	void operator()(size_t id, size_t value) {
+		if(active.fetch_add(1, std::memory_order_relaxed) != 0 || id >= seen.size() || seen[id] || value != pipeline_test_value(id, seed)) {
+			errors.fetch_add(1, std::memory_order_relaxed);
+		}
+		else {
+			seen[id] = true;
+		}
+		++count;
+		active.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	unsigned int seed;
+	std::vector<bool> seen;
+	size_t count;
+	std::atomic<int> active;
+	std::atomic<size_t> errors;
+};
+
+} /* namespace pheet */
+#endif /* PIPELINETESTSTAGES_H_ */
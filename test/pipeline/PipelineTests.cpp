@@ -0,0 +1,32 @@
+/*
+ * PipelineTests.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#include "PipelineTests.h"
+
+namespace pheet {
+
+PipelineTests::PipelineTests() {
+
+}
+
+PipelineTests::~PipelineTests() {
+
+}
+
+void PipelineTests::run_test() {
+#ifdef PIPELINE_TEST
+	std::cout << "----" << std::endl;
+
+	// Default buffer configuration
+	this->run_pipeline<	Pheet, 64, 16, 256>();
+	// Small blocks and a small window, so producers have to wait for stalled blocks
+	this->run_pipeline<	Pheet, 4, 2, 4>();
+#endif
+}
+
+} /* namespace pheet */
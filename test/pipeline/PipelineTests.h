@@ -0,0 +1,62 @@
+/*
+ * PipelineTests.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PIPELINETESTS_H_
+#define PIPELINETESTS_H_
+
+#include "../init.h"
+#include "../Test.h"
+#ifdef PIPELINE_TEST
+#include "PipelineTest.h"
+#endif
+
+namespace pheet {
+
+class PipelineTests : Test {
+public:
+	PipelineTests();
+	virtual ~PipelineTests();
+
+	void run_test();
+
+private:
+	template<class Pheet, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+	void run_pipeline();
+};
+
+template <class Pheet, size_t Granularity, size_t Capacity, size_t WindowCapacity>
+void PipelineTests::run_pipeline() {
+#ifdef PIPELINE_TEST
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	for(size_t n = 0; n < sizeof(pipeline_test_n)/sizeof(pipeline_test_n[0]); n++) {
+		bool max_processed = false;
+		procs_t cpus;
+		for(size_t c = 0; c < sizeof(pipeline_test_cpus)/sizeof(pipeline_test_cpus[0]); c++) {
+			cpus = pipeline_test_cpus[c];
+			if(cpus >= max_cpus) {
+				if(!max_processed) {
+					cpus = max_cpus;
+					max_processed = true;
+				}
+				else {
+					continue;
+				}
+			}
+			for(size_t s = 0; s < sizeof(pipeline_test_seeds)/sizeof(pipeline_test_seeds[0]); s++) {
+				PipelineTest<Pheet, Granularity, Capacity, WindowCapacity> pt(cpus, pipeline_test_n[n], pipeline_test_seeds[s]);
+				pt.run_test();
+			}
+		}
+	}
+#endif
+}
+
+} /* namespace pheet */
+#endif /* PIPELINETESTS_H_ */
@@ -0,0 +1,3 @@
+
+TEST_OBJS += lib/pipeline/PipelineTests.o
+TEST_OBJS_MIC += lib_mic/pipeline/PipelineTests.o
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*
+ * PlaceStorageBench.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+
+#include "../init.h"
+
+#include "PlaceStorageBench.h"
+#ifdef PLACE_STORAGE_BENCH
+#include <pheet/sched/Basic/BasicScheduler.h>
+#include <pheet/sched/Strategy2/StrategyScheduler2.h>
+#endif
+
+namespace pheet {
+
+PlaceStorageBench::PlaceStorageBench() {
+
+}
+
+PlaceStorageBench::~PlaceStorageBench() {
+
+}
+
+
+void PlaceStorageBench::run_test() {
+#ifdef PLACE_STORAGE_BENCH
+	std::cout << "----" << std::endl;
+
+	this->run_bench<	Pheet::WithScheduler<StrategyScheduler2>,
+						PlaceStorageBenchSlots>();
+	this->run_bench<	Pheet::WithScheduler<StrategyScheduler2>,
+						PlaceStorageBenchTypeIndexMap>();
+	this->run_bench<	Pheet::WithScheduler<BasicScheduler>,
+						PlaceStorageBenchSlots>();
+	this->run_bench<	Pheet::WithScheduler<BasicScheduler>,
+						PlaceStorageBenchTypeIndexMap>();
+#endif
+}
+
+} /* namespace pheet */
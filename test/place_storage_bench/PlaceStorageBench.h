@@ -0,0 +1,69 @@
+/*
+ * PlaceStorageBench.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PLACESTORAGEBENCH_H_
+#define PLACESTORAGEBENCH_H_
+
+#include "../init.h"
+#include "../Test.h"
+#ifdef PLACE_STORAGE_BENCH
+#include "PlaceStorageTest.h"
+#endif
+
+namespace pheet {
+
+/*
+ * Compares the cost of accessing place-local objects through the slots of
+ * PlaceLocalStorage and through a type_index hash map.
+ */
+class PlaceStorageBench : Test {
+public:
+	PlaceStorageBench();
+	~PlaceStorageBench();
+
+	void run_test();
+
+private:
+	template<class Pheet, template <class> class Access>
+	void run_bench();
+};
+
+
+template <class Pheet, template <class> class Access>
+void PlaceStorageBench::run_bench() {
+#ifdef PLACE_STORAGE_BENCH
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	for(size_t a = 0; a < sizeof(place_storage_bench_accesses)/sizeof(place_storage_bench_accesses[0]); a++) {
+		for(size_t n = 0; n < sizeof(place_storage_bench_blocks)/sizeof(place_storage_bench_blocks[0]); n++) {
+			bool max_processed = false;
+			procs_t cpus;
+			for(size_t c = 0; c < sizeof(place_storage_bench_cpus)/sizeof(place_storage_bench_cpus[0]); c++) {
+				cpus = place_storage_bench_cpus[c];
+				if(cpus >= max_cpus) {
+					if(!max_processed) {
+						cpus = max_cpus;
+						max_processed = true;
+					}
+					else {
+						continue;
+					}
+				}
+				PlaceStorageTest<Pheet, Access> pst(cpus,
+						place_storage_bench_blocks[n],
+						place_storage_bench_accesses[a]);
+				pst.run_test();
+			}
+		}
+	}
+
+#endif
+}
+} /* namespace pheet */
+#endif /* PLACESTORAGEBENCH_H_ */
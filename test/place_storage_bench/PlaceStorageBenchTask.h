@@ -0,0 +1,140 @@
+/*
+ * PlaceStorageBenchTask.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PLACESTORAGEBENCHTASK_H_
+#define PLACESTORAGEBENCHTASK_H_
+
+#include "../init.h"
+
+#include <iostream>
+#include <typeindex>
+#include <unordered_map>
+
+namespace pheet {
+
+template <size_t I>
+struct PlaceStorageBenchItem {
+	PlaceStorageBenchItem()
+	: value(0) {}
+
+	size_t value;
+};
+
+/*
+ * Access through the place-local storage of the scheduler (Pheet::place_singleton)
+ */
+template <class Pheet>
+struct PlaceStorageBenchSlots {
+	template <class T>
+	static T& get() {
+		return Pheet::template place_singleton<T>();
+	}
+
+	static void print_name() {
+		std::cout << "PlaceLocalStorage";
+	}
+};
+
+class PlaceStorageBenchMapItemBase {
+public:
+	virtual ~PlaceStorageBenchMapItemBase() {}
+};
+
+template <class T>
+class PlaceStorageBenchMapItem : public PlaceStorageBenchMapItemBase {
+public:
+	virtual ~PlaceStorageBenchMapItem() {}
+
+	T content;
+};
+
+/*
+ * Per place map from type to object, as used by PlaceBase before place-local storage
+ */
+class PlaceStorageBenchMap {
+public:
+	~PlaceStorageBenchMap() {
+		for(auto i = items.begin(); i != items.end(); ++i) {
+			delete i->second;
+		}
+	}
+
+	template <class T>
+	T& get() {
+		PlaceStorageBenchMapItemBase*& s = items[std::type_index(typeid(T))];
+		if(s == nullptr) {
+			s = new PlaceStorageBenchMapItem<T>();
+		}
+		return static_cast<PlaceStorageBenchMapItem<T>*>(s)->content;
+	}
+
+private:
+	std::unordered_map<std::type_index, PlaceStorageBenchMapItemBase*> items;
+};
+
+/*
+ * Includes one place-local storage access to find the map of the place, so the difference
+ * to PlaceStorageBenchSlots is the cost of the map lookup
+ */
+template <class Pheet>
+struct PlaceStorageBenchTypeIndexMap {
+	template <class T>
+	static T& get() {
+		return Pheet::template place_singleton<PlaceStorageBenchMap>().template get<T>();
+	}
+
+	static void print_name() {
+		std::cout << "TypeIndexMap";
+	}
+};
+
+/*
+ * Recursively splits the range of blocks. Each leaf accesses 8 different place-local
+ * objects in turn.
+ */
+template <class Pheet, template <class> class Access>
+class PlaceStorageBenchTask : public Pheet::Task {
+public:
+	typedef PlaceStorageBenchTask<Pheet, Access> Self;
+
+	PlaceStorageBenchTask(size_t* results, size_t blocks, size_t accesses)
+	:results(results), blocks(blocks), accesses(accesses) {}
+	~PlaceStorageBenchTask() {
+
+	}
+
+	virtual void operator()() {
+		while(blocks > 1) {
+			size_t half = blocks >> 1;
+			Pheet::template
+				spawn<Self>(results + half, blocks - half, accesses);
+			blocks = half;
+		}
+
+		size_t sum = 0;
+		for(size_t i = 0; i < accesses; i += 8) {
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<0> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<1> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<2> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<3> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<4> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<5> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<6> >().value;
+			sum += ++Access<Pheet>::template get<PlaceStorageBenchItem<7> >().value;
+		}
+		*results = sum;
+	}
+
+private:
+	size_t* results;
+	size_t blocks;
+	size_t accesses;
+};
+
+} /* namespace pheet */
+#endif /* PLACESTORAGEBENCHTASK_H_ */
@@ -0,0 +1,63 @@
+/*
+ * PlaceStorageTest.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PLACESTORAGETEST_H_
+#define PLACESTORAGETEST_H_
+
+#include "PlaceStorageBenchTask.h"
+#include "../Test.h"
+
+#include <vector>
+
+namespace pheet {
+
+template <class Pheet, template <class> class Access>
+class PlaceStorageTest : Test {
+public:
+	PlaceStorageTest(procs_t cpus, size_t blocks, size_t accesses)
+	:cpus(cpus), blocks(blocks), accesses(accesses) {}
+	~PlaceStorageTest() {}
+
+	void run_test();
+
+private:
+	procs_t cpus;
+	size_t blocks;
+	size_t accesses;
+};
+
+template <class Pheet, template <class> class Access>
+void PlaceStorageTest<Pheet, Access>::run_test() {
+	typename Pheet::Environment::PerformanceCounters pc;
+	std::vector<size_t> results(blocks, 0);
+
+	Time start, end;
+	{typename Pheet::Environment env(cpus, pc);
+		check_time(start);
+
+		Pheet::template
+			finish<PlaceStorageBenchTask<Pheet, Access> >(results.data(), blocks, accesses);
+		check_time(end);
+	}
+
+	double seconds = calculate_seconds(start, end);
+	size_t total = blocks * ((accesses + 7) & ~static_cast<size_t>(7));
+	std::cout << "test\taccess\tscheduler\tblocks\taccesses\tcpus\ttotal_time\tcpu_ns_per_access\t";
+	Pheet::Environment::PerformanceCounters::print_headers();
+	std::cout << std::endl;
+	std::cout << "place_storage_bench\t";
+	Access<Pheet>::print_name();
+	std::cout << "\t";
+	Pheet::Environment::print_name();
+	std::cout << "\t" << blocks << "\t" << accesses << "\t" << cpus << "\t" << seconds << "\t" << ((seconds * 1000000000.0 * cpus) / total) << "\t";
+	pc.print_values();
+	std::cout << std::endl;
+}
+
+} /* namespace pheet */
+#endif /* PLACESTORAGETEST_H_ */
@@ -0,0 +1,3 @@
+
+TEST_OBJS += lib/place_storage_bench/PlaceStorageBench.o
+TEST_OBJS_MIC += lib_mic/place_storage_bench/PlaceStorageBench.o
\ No newline at end of file
@@ -0,0 +1,159 @@
+/*
+ * PrefixSumKernelTest.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PREFIXSUMKERNELTEST_H_
+#define PREFIXSUMKERNELTEST_H_
+
+#include <pheet/pheet.h>
+#include "../Test.h"
+#include "RecursiveParallelVectorized/PrefixSumKernels.h"
+#include "ReduceThenScan/ReduceThenScanPrefixSum.h"
+
+#include <stdint.h>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Compares the prefix sum kernels of each instruction set and each supported type with a
+ * plain sequential loop, for all lengths up to a few vector widths (so every possible
+ * remainder is covered) and some larger ones. In addition, ReduceThenScanPrefixSum is run
+ * with a small block size for each type, so the last block is partial.
+ *
+ * Values are small integers, so float and double sums are exact despite the different
+ * order of additions.
+ */
+template <class Pheet>
+class PrefixSumKernelTest : Test {
+public:
+	PrefixSumKernelTest(procs_t cpus, unsigned int seed)
+	:cpus(cpus), seed(seed) {}
+	~PrefixSumKernelTest() {}
+
+	void run_test();
+
+private:
+	template <typename T>
+	void run_type(char const* type_name);
+
+	template <typename T, PrefixSumIsa Isa>
+	void run_isa(char const* type_name);
+
+	template <typename T>
+	void generate_data(std::vector<T>& data, size_t length);
+
+	procs_t cpus;
+	unsigned int seed;
+
+	static size_t const max_remainder_length = 80;
+	static size_t const long_lengths[];
+};
+
+template <class Pheet>
+size_t const PrefixSumKernelTest<Pheet>::long_lengths[] = {1000, 1021, 4096, 4099};
+
+template <class Pheet>
+void PrefixSumKernelTest<Pheet>::run_test() {
+	run_type<uint32_t>("uint32_t");
+	run_type<uint64_t>("uint64_t");
+	run_type<int>("int");
+	run_type<float>("float");
+	run_type<double>("double");
+}
+
+template <class Pheet>
+template <typename T>
+void PrefixSumKernelTest<Pheet>::run_type(char const* type_name) {
+	run_isa<T, PrefixSumIsa::scalar>(type_name);
+	run_isa<T, PrefixSumIsa::sse2>(type_name);
+	run_isa<T, PrefixSumIsa::avx2>(type_name);
+	run_isa<T, PrefixSumIsa::avx512>(type_name);
+}
+
+template <class Pheet>
+template <typename T, PrefixSumIsa Isa>
+void PrefixSumKernelTest<Pheet>::run_isa(char const* type_name) {
+	typedef PrefixSumKernels<T> Kernels;
+
+	std::vector<size_t> lengths;
+	for(size_t l = 0; l <= max_remainder_length; ++l) {
+		lengths.push_back(l);
+	}
+	lengths.insert(lengths.end(), long_lengths, long_lengths + sizeof(long_lengths)/sizeof(long_lengths[0]));
+
+	bool correct = true;
+	T const carry = static_cast<T>(5);
+	for(size_t length : lengths) {
+		std::vector<T> data;
+		generate_data(data, length);
+
+		std::vector<T> expected(data);
+		T acc = carry;
+		for(size_t i = 0; i < length; ++i) {
+			acc += expected[i];
+			expected[i] = acc;
+		}
+
+		// reduce
+		T sum = T();
+		for(size_t i = 0; i < length; ++i) {
+			sum += data[i];
+		}
+		correct &= Kernels::reduce(data.data(), length, Isa) == sum;
+
+		// scan
+		std::vector<T> d(data);
+		correct &= Kernels::scan(d.data(), length, carry, Isa) == acc;
+		correct &= d == expected;
+
+		// add
+		d = data;
+		Kernels::add(d.data(), length, carry, Isa);
+		for(size_t i = 0; i < length; ++i) {
+			correct &= d[i] == static_cast<T>(data[i] + carry);
+		}
+	}
+
+	// Through a real caller, with partial last blocks
+	for(size_t length : long_lengths) {
+		std::vector<T> data;
+		generate_data(data, length);
+
+		std::vector<T> expected(data);
+		for(size_t i = 1; i < length; ++i) {
+			expected[i] += expected[i - 1];
+		}
+
+		{typename Pheet::Environment env(cpus);
+			Pheet::template
+				finish<ReduceThenScanPrefixSumImpl<Pheet, T, 64, Isa> >(data.data(), length);
+		}
+		correct &= data == expected;
+	}
+
+	std::cout << "test\ttype\tisa\tscheduler\tseed\tcpus\tcorrect" << std::endl;
+	std::cout << "prefix_sum_kernels\t" << type_name << "\t" << prefix_sum_isa_name(prefix_sum_isa(Isa)) << "\t";
+	Pheet::Environment::print_name();
+	std::cout << "\t" << seed << "\t" << cpus << "\t" << correct << std::endl;
+}
+
+template <class Pheet>
+template <typename T>
+void PrefixSumKernelTest<Pheet>::generate_data(std::vector<T>& data, size_t length) {
+	std::mt19937 rng(seed + length);
+	std::uniform_int_distribution<int> dist(0, 15);
+	data.resize(length);
+	for(size_t i = 0; i < length; ++i) {
+		data[i] = static_cast<T>(dist(rng));
+	}
+}
+
+} /* namespace pheet */
+#endif /* PREFIXSUMKERNELTEST_H_ */
@@ -88,13 +88,15 @@ void PrefixSumTest<Pheet, Algorithm>::run_test() {
 		correctness &= is_correct(data[i].ptr());
 	}
 	double seconds = calculate_seconds(start, end);
-	std::cout << "test\talgorithm\tscheduler\tnum_problems\ttype\tsize\tseed\tcpus\ttotal_time\tcorrect\t";
+	// Throughput based on the size of the input, independent of how often an algorithm reads it
+	double gb_per_s = (num_problems * size * sizeof(unsigned int)) / seconds / 1000000000.0;
+	std::cout << "test\talgorithm\tscheduler\tnum_problems\ttype\tsize\tseed\tcpus\ttotal_time\tgb_per_s\tcorrect\t";
 	Pheet::Environment::PerformanceCounters::print_headers();
 	Algorithm<Pheet>::PerformanceCounters::print_headers();
 	std::cout << std::endl;
 	std::cout << "prefix_sum\t" << Algorithm<Pheet>::name << "\t";
 	Pheet::Environment::print_name();
-	std::cout << "\t" << num_problems << "\t" << types[type] << "\t" << size << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << correctness << "\t";
+	std::cout << "\t" << num_problems << "\t" << types[type] << "\t" << size << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << gb_per_s << "\t" << correctness << "\t";
 	pc.print_values();
 	apc.print_values();
 	std::cout << std::endl;
@@ -14,6 +14,7 @@
 #include "RecursiveParallel/RecursiveParallelPrefixSum.h"
 #include "RecursiveParallel2/RecursiveParallelPrefixSum2.h"
 #include "RecursiveParallelVectorized/RecursiveParallelVectorizedPrefixSum.h"
+#include "ReduceThenScan/ReduceThenScanPrefixSum.h"
 #include "SmartRecursiveParallel2/SmartRecursiveParallelPrefixSum2.h"
 #include "StrategyRecursiveParallel/StrategyRecursiveParallelPrefixSum.h"
 #include "StrategyRecursiveParallel2/StrategyRecursiveParallelPrefixSum2.h"
@@ -112,12 +113,24 @@ void PrefixSumTests::run_test() {
 
 //	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>::WithMachineModel<HWLocSMTMachineModel>,
 //						RecursiveParallelPrefixSum>();
-/*
+
 	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>,
 						RecursiveParallelVectorizedPrefixSum>();
-	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>::WithMachineModel<HWLocSMTMachineModel>,
+/*	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>::WithMachineModel<HWLocSMTMachineModel>,
 						RecursiveParallelVectorizedPrefixSum>();*/
 
+	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>,
+						ReduceThenScanPrefixSum>();
+	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>,
+						ReduceThenScanPrefixSumScalar>();
+	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>,
+						ReduceThenScanPrefixSumSSE2>();
+	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>,
+						ReduceThenScanPrefixSumAVX2>();
+	this->run_prefix_sum<	Pheet::WithScheduler<BasicScheduler>,
+						ReduceThenScanPrefixSumAVX512>();
+	this->run_prefix_sum_kernels<	Pheet::WithScheduler<BasicScheduler> >();
+
 	this->run_prefix_sum<	Pheet::WithScheduler<SynchroneousScheduler>,
 						RecursiveParallelPrefixSum2>();
 	this->run_prefix_sum<	Pheet::WithScheduler<SynchroneousScheduler>,
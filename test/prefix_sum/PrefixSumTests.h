@@ -13,6 +13,7 @@
 #include "../Test.h"
 #ifdef PREFIX_SUM_TEST
 #include "PrefixSumTest.h"
+#include "PrefixSumKernelTest.h"
 #endif
 
 namespace pheet {
@@ -27,6 +28,9 @@ public:
 private:
 	template<class Pheet, template <class P> class Algorithm>
 	void run_prefix_sum();
+
+	template<class Pheet>
+	void run_prefix_sum_kernels();
 };
 
 template <class Pheet, template <class P> class Algorithm>
@@ -69,5 +73,32 @@ void PrefixSumTests::run_prefix_sum() {
 #endif
 }
 
+template <class Pheet>
+void PrefixSumTests::run_prefix_sum_kernels() {
+#ifdef PREFIX_SUM_TEST
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	bool max_processed = false;
+	procs_t cpus;
+	for(size_t c = 0; c < sizeof(prefix_sum_test_cpus)/sizeof(prefix_sum_test_cpus[0]); c++) {
+		cpus = prefix_sum_test_cpus[c];
+		if(cpus >= max_cpus) {
+			if(!max_processed) {
+				cpus = max_cpus;
+				max_processed = true;
+			}
+			else {
+				continue;
+			}
+		}
+		for(size_t s = 0; s < sizeof(prefix_sum_test_seeds)/sizeof(prefix_sum_test_seeds[0]); s++) {
+			PrefixSumKernelTest<Pheet> kt(cpus, prefix_sum_test_seeds[s]);
+			kt.run_test();
+		}
+	}
+#endif
+}
+
 } /* namespace pheet */
 #endif /* PREFIXSUMTESTS_H_ */
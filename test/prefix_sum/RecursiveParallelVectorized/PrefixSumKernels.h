@@ -0,0 +1,524 @@
+/*
+ * PrefixSumKernels.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef PREFIXSUMKERNELS_H_
+#define PREFIXSUMKERNELS_H_
+
+#include <pheet/environment.h>
+
+#include <stdint.h>
+#include <type_traits>
+
+#ifdef ENV_X86
+#include <immintrin.h>
+#endif
+
+namespace pheet {
+
+/*
+ * Sequential prefix sum kernels for contiguous data (inclusive scan, adding an offset,
+ * reduction), with one implementation per instruction set. The instruction set is selected
+ * at runtime (cpuid, through __builtin_cpu_supports), so the kernels do not depend on the
+ * flags the tests are compiled with. Each vector implementation is compiled for its own
+ * target using function attributes.
+ *
+ * Kernels work on 32 and 64 bit integers (signed integers are scanned as unsigned, which
+ * gives the same bits) and on floats and doubles. Floating point results may differ from a
+ * sequential scan in the last bits, as the vector kernels add in a different order.
+ */
+enum class PrefixSumIsa {
+	automatic,
+	scalar,
+	sse2,
+	avx2,
+	avx512
+};
+
+inline char const* prefix_sum_isa_name(PrefixSumIsa isa) {
+	switch(isa) {
+	case PrefixSumIsa::automatic:
+		return "automatic";
+	case PrefixSumIsa::scalar:
+		return "scalar";
+	case PrefixSumIsa::sse2:
+		return "sse2";
+	case PrefixSumIsa::avx2:
+		return "avx2";
+	case PrefixSumIsa::avx512:
+		return "avx512";
+	}
+	return "unknown";
+}
+
+inline PrefixSumIsa prefix_sum_detect_isa() {
+#ifdef ENV_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f")) {
+		return PrefixSumIsa::avx512;
+	}
+	if(__builtin_cpu_supports("avx2")) {
+		return PrefixSumIsa::avx2;
+	}
+	if(__builtin_cpu_supports("sse2")) {
+		return PrefixSumIsa::sse2;
+	}
+#endif
+	return PrefixSumIsa::scalar;
+}
+
+/*
+ * Returns the requested instruction set, or the best available one if the requested one
+ * is not supported (or automatic)
+ */
+inline PrefixSumIsa prefix_sum_isa(PrefixSumIsa requested) {
+	static PrefixSumIsa const best = prefix_sum_detect_isa();
+	if(requested == PrefixSumIsa::automatic || requested > best) {
+		return best;
+	}
+	return requested;
+}
+
+template <typename T, bool integral = std::is_integral<T>::value>
+struct PrefixSumKernelType {
+	static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "Unsupported type for prefix sum kernels");
+	typedef T type;
+};
+
+template <typename T>
+struct PrefixSumKernelType<T, true> {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 32 and 64 bit integers are supported");
+	typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type type;
+};
+
+template <typename T>
+struct ScalarPrefixSumKernels {
+	static T scan(T* data, size_t length, T carry) {
+		T acc = carry;
+		for(size_t i = 0; i < length; ++i) {
+			acc += data[i];
+			data[i] = acc;
+		}
+		return acc;
+	}
+
+	static void add(T* data, size_t length, T value) {
+		for(size_t i = 0; i < length; ++i) {
+			data[i] += value;
+		}
+	}
+
+	static T reduce(T const* data, size_t length) {
+		T acc = T();
+		for(size_t i = 0; i < length; ++i) {
+			acc += data[i];
+		}
+		return acc;
+	}
+};
+
+#ifdef ENV_X86
+
+/*
+ * Per type vector operations. scan computes the inclusive prefix sum inside a vector
+ * (log2(width) shift and add steps), last broadcasts the highest element.
+ */
+template <typename T>
+struct Sse2PrefixSumOps;
+
+template <>
+struct Sse2PrefixSumOps<uint32_t> {
+	typedef __m128i V;
+	static size_t const width = 4;
+	__attribute__((target("sse2"))) static V load(uint32_t const* p) { return _mm_loadu_si128((__m128i const*)p); }
+	__attribute__((target("sse2"))) static void store(uint32_t* p, V v) { _mm_storeu_si128((__m128i*)p, v); }
+	__attribute__((target("sse2"))) static V set1(uint32_t x) { return _mm_set1_epi32((int)x); }
+	__attribute__((target("sse2"))) static V add(V a, V b) { return _mm_add_epi32(a, b); }
+	__attribute__((target("sse2"))) static V scan(V v) {
+		v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+		return _mm_add_epi32(v, _mm_slli_si128(v, 8));
+	}
+	__attribute__((target("sse2"))) static V last(V v) { return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3)); }
+};
+
+template <>
+struct Sse2PrefixSumOps<uint64_t> {
+	typedef __m128i V;
+	static size_t const width = 2;
+	__attribute__((target("sse2"))) static V load(uint64_t const* p) { return _mm_loadu_si128((__m128i const*)p); }
+	__attribute__((target("sse2"))) static void store(uint64_t* p, V v) { _mm_storeu_si128((__m128i*)p, v); }
+	__attribute__((target("sse2"))) static V set1(uint64_t x) { return _mm_set1_epi64x((long long)x); }
+	__attribute__((target("sse2"))) static V add(V a, V b) { return _mm_add_epi64(a, b); }
+	__attribute__((target("sse2"))) static V scan(V v) { return _mm_add_epi64(v, _mm_slli_si128(v, 8)); }
+	__attribute__((target("sse2"))) static V last(V v) { return _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 2, 3, 2)); }
+};
+
+template <>
+struct Sse2PrefixSumOps<float> {
+	typedef __m128 V;
+	static size_t const width = 4;
+	__attribute__((target("sse2"))) static V load(float const* p) { return _mm_loadu_ps(p); }
+	__attribute__((target("sse2"))) static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+	__attribute__((target("sse2"))) static V set1(float x) { return _mm_set1_ps(x); }
+	__attribute__((target("sse2"))) static V add(V a, V b) { return _mm_add_ps(a, b); }
+	__attribute__((target("sse2"))) static V scan(V v) {
+		v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+		return _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+	}
+	__attribute__((target("sse2"))) static V last(V v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+};
+
+template <>
+struct Sse2PrefixSumOps<double> {
+	typedef __m128d V;
+	static size_t const width = 2;
+	__attribute__((target("sse2"))) static V load(double const* p) { return _mm_loadu_pd(p); }
+	__attribute__((target("sse2"))) static void store(double* p, V v) { _mm_storeu_pd(p, v); }
+	__attribute__((target("sse2"))) static V set1(double x) { return _mm_set1_pd(x); }
+	__attribute__((target("sse2"))) static V add(V a, V b) { return _mm_add_pd(a, b); }
+	__attribute__((target("sse2"))) static V scan(V v) { return _mm_add_pd(v, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(v), 8))); }
+	__attribute__((target("sse2"))) static V last(V v) { return _mm_unpackhi_pd(v, v); }
+};
+
+/*
+ * AVX2 shifts only work within 128 bit lanes, so the lane-local scan is followed by adding
+ * the last element of the lower lane to the upper lane.
+ */
+template <typename T>
+struct Avx2PrefixSumOps;
+
+template <>
+struct Avx2PrefixSumOps<uint32_t> {
+	typedef __m256i V;
+	static size_t const width = 8;
+	__attribute__((target("avx2"))) static V load(uint32_t const* p) { return _mm256_loadu_si256((__m256i const*)p); }
+	__attribute__((target("avx2"))) static void store(uint32_t* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+	__attribute__((target("avx2"))) static V set1(uint32_t x) { return _mm256_set1_epi32((int)x); }
+	__attribute__((target("avx2"))) static V add(V a, V b) { return _mm256_add_epi32(a, b); }
+	__attribute__((target("avx2"))) static V scan(V v) {
+		v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+		v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+		V low = _mm256_permute2x128_si256(v, v, 0x08);
+		return _mm256_add_epi32(v, _mm256_shuffle_epi32(low, _MM_SHUFFLE(3, 3, 3, 3)));
+	}
+	__attribute__((target("avx2"))) static V last(V v) { return _mm256_permutevar8x32_epi32(v, _mm256_set1_epi32(7)); }
+};
+
+template <>
+struct Avx2PrefixSumOps<uint64_t> {
+	typedef __m256i V;
+	static size_t const width = 4;
+	__attribute__((target("avx2"))) static V load(uint64_t const* p) { return _mm256_loadu_si256((__m256i const*)p); }
+	__attribute__((target("avx2"))) static void store(uint64_t* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+	__attribute__((target("avx2"))) static V set1(uint64_t x) { return _mm256_set1_epi64x((long long)x); }
+	__attribute__((target("avx2"))) static V add(V a, V b) { return _mm256_add_epi64(a, b); }
+	__attribute__((target("avx2"))) static V scan(V v) {
+		v = _mm256_add_epi64(v, _mm256_slli_si256(v, 8));
+		V low = _mm256_permute2x128_si256(v, v, 0x08);
+		return _mm256_add_epi64(v, _mm256_shuffle_epi32(low, _MM_SHUFFLE(3, 2, 3, 2)));
+	}
+	__attribute__((target("avx2"))) static V last(V v) { return _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 3, 3, 3)); }
+};
+
+template <>
+struct Avx2PrefixSumOps<float> {
+	typedef __m256 V;
+	static size_t const width = 8;
+	__attribute__((target("avx2"))) static V load(float const* p) { return _mm256_loadu_ps(p); }
+	__attribute__((target("avx2"))) static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+	__attribute__((target("avx2"))) static V set1(float x) { return _mm256_set1_ps(x); }
+	__attribute__((target("avx2"))) static V add(V a, V b) { return _mm256_add_ps(a, b); }
+	__attribute__((target("avx2"))) static V scan(V v) {
+		__m256i i = _mm256_castps_si256(v);
+		v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(i, 4)));
+		i = _mm256_castps_si256(v);
+		v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(i, 8)));
+		i = _mm256_permute2x128_si256(_mm256_castps_si256(v), _mm256_castps_si256(v), 0x08);
+		return _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_shuffle_epi32(i, _MM_SHUFFLE(3, 3, 3, 3))));
+	}
+	__attribute__((target("avx2"))) static V last(V v) { return _mm256_permutevar8x32_ps(v, _mm256_set1_epi32(7)); }
+};
+
+template <>
+struct Avx2PrefixSumOps<double> {
+	typedef __m256d V;
+	static size_t const width = 4;
+	__attribute__((target("avx2"))) static V load(double const* p) { return _mm256_loadu_pd(p); }
+	__attribute__((target("avx2"))) static void store(double* p, V v) { _mm256_storeu_pd(p, v); }
+	__attribute__((target("avx2"))) static V set1(double x) { return _mm256_set1_pd(x); }
+	__attribute__((target("avx2"))) static V add(V a, V b) { return _mm256_add_pd(a, b); }
+	__attribute__((target("avx2"))) static V scan(V v) {
+		__m256i i = _mm256_castpd_si256(v);
+		v = _mm256_add_pd(v, _mm256_castsi256_pd(_mm256_slli_si256(i, 8)));
+		i = _mm256_permute2x128_si256(_mm256_castpd_si256(v), _mm256_castpd_si256(v), 0x08);
+		return _mm256_add_pd(v, _mm256_castsi256_pd(_mm256_shuffle_epi32(i, _MM_SHUFFLE(3, 2, 3, 2))));
+	}
+	__attribute__((target("avx2"))) static V last(V v) { return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 3, 3, 3)); }
+};
+
+/*
+ * AVX-512 shifts whole vectors by elements with valignd/valignq against a zero vector.
+ * The zero-masking variants of valign and vpermd/vpermq with a full mask are used, as the
+ * plain ones pass an undefined vector through, which GCC reports as maybe uninitialized
+ */
+template <typename T>
+struct Avx512PrefixSumOps;
+
+template <>
+struct Avx512PrefixSumOps<uint32_t> {
+	typedef __m512i V;
+	static size_t const width = 16;
+	__attribute__((target("avx512f"))) static V load(uint32_t const* p) { return _mm512_loadu_si512(p); }
+	__attribute__((target("avx512f"))) static void store(uint32_t* p, V v) { _mm512_storeu_si512(p, v); }
+	__attribute__((target("avx512f"))) static V set1(uint32_t x) { return _mm512_set1_epi32((int)x); }
+	__attribute__((target("avx512f"))) static V add(V a, V b) { return _mm512_add_epi32(a, b); }
+	__attribute__((target("avx512f"))) static V scan(V v) {
+		V zero = _mm512_setzero_si512();
+		v = _mm512_add_epi32(v, _mm512_maskz_alignr_epi32(0xFFFF, v, zero, 15));
+		v = _mm512_add_epi32(v, _mm512_maskz_alignr_epi32(0xFFFF, v, zero, 14));
+		v = _mm512_add_epi32(v, _mm512_maskz_alignr_epi32(0xFFFF, v, zero, 12));
+		return _mm512_add_epi32(v, _mm512_maskz_alignr_epi32(0xFFFF, v, zero, 8));
+	}
+	__attribute__((target("avx512f"))) static V last(V v) { return _mm512_maskz_permutexvar_epi32(0xFFFF, _mm512_set1_epi32(15), v); }
+};
+
+template <>
+struct Avx512PrefixSumOps<uint64_t> {
+	typedef __m512i V;
+	static size_t const width = 8;
+	__attribute__((target("avx512f"))) static V load(uint64_t const* p) { return _mm512_loadu_si512(p); }
+	__attribute__((target("avx512f"))) static void store(uint64_t* p, V v) { _mm512_storeu_si512(p, v); }
+	__attribute__((target("avx512f"))) static V set1(uint64_t x) { return _mm512_set1_epi64((long long)x); }
+	__attribute__((target("avx512f"))) static V add(V a, V b) { return _mm512_add_epi64(a, b); }
+	__attribute__((target("avx512f"))) static V scan(V v) {
+		V zero = _mm512_setzero_si512();
+		v = _mm512_add_epi64(v, _mm512_maskz_alignr_epi64(0xFF, v, zero, 7));
+		v = _mm512_add_epi64(v, _mm512_maskz_alignr_epi64(0xFF, v, zero, 6));
+		return _mm512_add_epi64(v, _mm512_maskz_alignr_epi64(0xFF, v, zero, 4));
+	}
+	__attribute__((target("avx512f"))) static V last(V v) { return _mm512_maskz_permutexvar_epi64(0xFF, _mm512_set1_epi64(7), v); }
+};
+
+template <>
+struct Avx512PrefixSumOps<float> {
+	typedef __m512 V;
+	static size_t const width = 16;
+	__attribute__((target("avx512f"))) static V load(float const* p) { return _mm512_loadu_ps(p); }
+	__attribute__((target("avx512f"))) static void store(float* p, V v) { _mm512_storeu_ps(p, v); }
+	__attribute__((target("avx512f"))) static V set1(float x) { return _mm512_set1_ps(x); }
+	__attribute__((target("avx512f"))) static V add(V a, V b) { return _mm512_add_ps(a, b); }
+	__attribute__((target("avx512f"))) static V scan(V v) {
+		__m512i zero = _mm512_setzero_si512();
+		v = _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_maskz_alignr_epi32(0xFFFF, _mm512_castps_si512(v), zero, 15)));
+		v = _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_maskz_alignr_epi32(0xFFFF, _mm512_castps_si512(v), zero, 14)));
+		v = _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_maskz_alignr_epi32(0xFFFF, _mm512_castps_si512(v), zero, 12)));
+		return _mm512_add_ps(v, _mm512_castsi512_ps(_mm512_maskz_alignr_epi32(0xFFFF, _mm512_castps_si512(v), zero, 8)));
+	}
+	__attribute__((target("avx512f"))) static V last(V v) { return _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_set1_epi32(15), v); }
+};
+
+template <>
+struct Avx512PrefixSumOps<double> {
+	typedef __m512d V;
+	static size_t const width = 8;
+	__attribute__((target("avx512f"))) static V load(double const* p) { return _mm512_loadu_pd(p); }
+	__attribute__((target("avx512f"))) static void store(double* p, V v) { _mm512_storeu_pd(p, v); }
+	__attribute__((target("avx512f"))) static V set1(double x) { return _mm512_set1_pd(x); }
+	__attribute__((target("avx512f"))) static V add(V a, V b) { return _mm512_add_pd(a, b); }
+	__attribute__((target("avx512f"))) static V scan(V v) {
+		__m512i zero = _mm512_setzero_si512();
+		v = _mm512_add_pd(v, _mm512_castsi512_pd(_mm512_maskz_alignr_epi64(0xFF, _mm512_castpd_si512(v), zero, 7)));
+		v = _mm512_add_pd(v, _mm512_castsi512_pd(_mm512_maskz_alignr_epi64(0xFF, _mm512_castpd_si512(v), zero, 6)));
+		return _mm512_add_pd(v, _mm512_castsi512_pd(_mm512_maskz_alignr_epi64(0xFF, _mm512_castpd_si512(v), zero, 4)));
+	}
+	__attribute__((target("avx512f"))) static V last(V v) { return _mm512_maskz_permutexvar_pd(0xFF, _mm512_set1_epi64(7), v); }
+};
+
+/*
+ * The loops are the same for all instruction sets, but each copy needs its own target
+ * attribute, otherwise the operations could not be inlined.
+ */
+template <typename T>
+struct Sse2PrefixSumKernels {
+	typedef Sse2PrefixSumOps<T> Ops;
+	typedef typename Ops::V V;
+
+	__attribute__((target("sse2"))) static T scan(T* data, size_t length, T carry) {
+		size_t i = 0;
+		V prev = Ops::set1(carry);
+		for(; i + Ops::width <= length; i += Ops::width) {
+			V v = Ops::add(Ops::scan(Ops::load(data + i)), prev);
+			Ops::store(data + i, v);
+			prev = Ops::last(v);
+		}
+		return ScalarPrefixSumKernels<T>::scan(data + i, length - i, (i == 0)?carry:data[i - 1]);
+	}
+
+	__attribute__((target("sse2"))) static void add(T* data, size_t length, T value) {
+		size_t i = 0;
+		V v = Ops::set1(value);
+		for(; i + Ops::width <= length; i += Ops::width) {
+			Ops::store(data + i, Ops::add(Ops::load(data + i), v));
+		}
+		ScalarPrefixSumKernels<T>::add(data + i, length - i, value);
+	}
+
+	__attribute__((target("sse2"))) static T reduce(T const* data, size_t length) {
+		size_t i = 0;
+		V acc = Ops::set1(T());
+		for(; i + Ops::width <= length; i += Ops::width) {
+			acc = Ops::add(acc, Ops::load(data + i));
+		}
+		T tmp[Ops::width];
+		Ops::store(tmp, acc);
+		return ScalarPrefixSumKernels<T>::reduce(tmp, Ops::width) + ScalarPrefixSumKernels<T>::reduce(data + i, length - i);
+	}
+};
+
+template <typename T>
+struct Avx2PrefixSumKernels {
+	typedef Avx2PrefixSumOps<T> Ops;
+	typedef typename Ops::V V;
+
+	__attribute__((target("avx2"))) static T scan(T* data, size_t length, T carry) {
+		size_t i = 0;
+		V prev = Ops::set1(carry);
+		for(; i + Ops::width <= length; i += Ops::width) {
+			V v = Ops::add(Ops::scan(Ops::load(data + i)), prev);
+			Ops::store(data + i, v);
+			prev = Ops::last(v);
+		}
+		return ScalarPrefixSumKernels<T>::scan(data + i, length - i, (i == 0)?carry:data[i - 1]);
+	}
+
+	__attribute__((target("avx2"))) static void add(T* data, size_t length, T value) {
+		size_t i = 0;
+		V v = Ops::set1(value);
+		for(; i + Ops::width <= length; i += Ops::width) {
+			Ops::store(data + i, Ops::add(Ops::load(data + i), v));
+		}
+		ScalarPrefixSumKernels<T>::add(data + i, length - i, value);
+	}
+
+	__attribute__((target("avx2"))) static T reduce(T const* data, size_t length) {
+		size_t i = 0;
+		V acc = Ops::set1(T());
+		for(; i + Ops::width <= length; i += Ops::width) {
+			acc = Ops::add(acc, Ops::load(data + i));
+		}
+		T tmp[Ops::width];
+		Ops::store(tmp, acc);
+		return ScalarPrefixSumKernels<T>::reduce(tmp, Ops::width) + ScalarPrefixSumKernels<T>::reduce(data + i, length - i);
+	}
+};
+
+template <typename T>
+struct Avx512PrefixSumKernels {
+	typedef Avx512PrefixSumOps<T> Ops;
+	typedef typename Ops::V V;
+
+	__attribute__((target("avx512f"))) static T scan(T* data, size_t length, T carry) {
+		size_t i = 0;
+		V prev = Ops::set1(carry);
+		for(; i + Ops::width <= length; i += Ops::width) {
+			V v = Ops::add(Ops::scan(Ops::load(data + i)), prev);
+			Ops::store(data + i, v);
+			prev = Ops::last(v);
+		}
+		return ScalarPrefixSumKernels<T>::scan(data + i, length - i, (i == 0)?carry:data[i - 1]);
+	}
+
+	__attribute__((target("avx512f"))) static void add(T* data, size_t length, T value) {
+		size_t i = 0;
+		V v = Ops::set1(value);
+		for(; i + Ops::width <= length; i += Ops::width) {
+			Ops::store(data + i, Ops::add(Ops::load(data + i), v));
+		}
+		ScalarPrefixSumKernels<T>::add(data + i, length - i, value);
+	}
+
+	__attribute__((target("avx512f"))) static T reduce(T const* data, size_t length) {
+		size_t i = 0;
+		V acc = Ops::set1(T());
+		for(; i + Ops::width <= length; i += Ops::width) {
+			acc = Ops::add(acc, Ops::load(data + i));
+		}
+		T tmp[Ops::width];
+		Ops::store(tmp, acc);
+		return ScalarPrefixSumKernels<T>::reduce(tmp, Ops::width) + ScalarPrefixSumKernels<T>::reduce(data + i, length - i);
+	}
+};
+
+#endif
+
+/*
+ * Dispatches to the kernels of the given instruction set (see prefix_sum_isa)
+ */
+template <typename T>
+struct PrefixSumKernels {
+	typedef typename PrefixSumKernelType<T>::type K;
+
+	/*
+	 * Inclusive scan of data, starting with carry. Returns the last value
+	 */
+	static T scan(T* data, size_t length, T carry, PrefixSumIsa isa = PrefixSumIsa::automatic) {
+		K* d = reinterpret_cast<K*>(data);
+		K c = static_cast<K>(carry);
+		switch(prefix_sum_isa(isa)) {
+#ifdef ENV_X86
+		case PrefixSumIsa::avx512:
+			return static_cast<T>(Avx512PrefixSumKernels<K>::scan(d, length, c));
+		case PrefixSumIsa::avx2:
+			return static_cast<T>(Avx2PrefixSumKernels<K>::scan(d, length, c));
+		case PrefixSumIsa::sse2:
+			return static_cast<T>(Sse2PrefixSumKernels<K>::scan(d, length, c));
+#endif
+		default:
+			return static_cast<T>(ScalarPrefixSumKernels<K>::scan(d, length, c));
+		}
+	}
+
+	static void add(T* data, size_t length, T value, PrefixSumIsa isa = PrefixSumIsa::automatic) {
+		K* d = reinterpret_cast<K*>(data);
+		K v = static_cast<K>(value);
+		switch(prefix_sum_isa(isa)) {
+#ifdef ENV_X86
+		case PrefixSumIsa::avx512:
+			Avx512PrefixSumKernels<K>::add(d, length, v);
+			break;
+		case PrefixSumIsa::avx2:
+			Avx2PrefixSumKernels<K>::add(d, length, v);
+			break;
+		case PrefixSumIsa::sse2:
+			Sse2PrefixSumKernels<K>::add(d, length, v);
+			break;
+#endif
+		default:
+			ScalarPrefixSumKernels<K>::add(d, length, v);
+		}
+	}
+
+	static T reduce(T const* data, size_t length, PrefixSumIsa isa = PrefixSumIsa::automatic) {
+		K const* d = reinterpret_cast<K const*>(data);
+		switch(prefix_sum_isa(isa)) {
+#ifdef ENV_X86
+		case PrefixSumIsa::avx512:
+			return static_cast<T>(Avx512PrefixSumKernels<K>::reduce(d, length));
+		case PrefixSumIsa::avx2:
+			return static_cast<T>(Avx2PrefixSumKernels<K>::reduce(d, length));
+		case PrefixSumIsa::sse2:
+			return static_cast<T>(Sse2PrefixSumKernels<K>::reduce(d, length));
+#endif
+		default:
+			return static_cast<T>(ScalarPrefixSumKernels<K>::reduce(d, length));
+		}
+	}
+};
+
+}
+
+#endif /* PREFIXSUMKERNELS_H_ */
@@ -13,6 +13,7 @@
 #include <pheet/pheet.h>
 #include "RecursiveParallelVectorizedPrefixSumOffsetTask.h"
 #include "RecursiveParallelVectorizedPrefixSumPerformanceCounters.h"
+#include "PrefixSumKernels.h"
 
 #include <immintrin.h>
 
@@ -22,11 +23,11 @@
 
 namespace pheet {
 
-template <class Pheet, size_t BlockSize>
+template <class Pheet, size_t BlockSize, PrefixSumIsa Isa>
 class RecursiveParallelVectorizedPrefixSumImpl : public Pheet::Task {
 public:
-	typedef RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize> Self;
-	typedef RecursiveParallelVectorizedPrefixSumOffsetTask<Pheet, BlockSize> OffsetTask;
+	typedef RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize, Isa> Self;
+	typedef RecursiveParallelVectorizedPrefixSumOffsetTask<Pheet, BlockSize, Isa> OffsetTask;
 	typedef RecursiveParallelVectorizedPrefixSumPerformanceCounters<Pheet> PerformanceCounters;
 
 	RecursiveParallelVectorizedPrefixSumImpl(unsigned int* data, size_t length)
@@ -66,9 +67,12 @@ public:
 					Pheet::template spawn<Self>(data + half*step, length - half, step, false, pc);
 				}
 //std::cout << data[1024] << std::endl;
-				if(num_blocks > 2)
+				// The offset task skips the last element of full blocks, so these need to be
+				// included in the prefix sum over the block sums (including the last block if it is full)
+				size_t num_sums = (length % BlockSize == 0)?num_blocks:(num_blocks - 1);
+				if(num_sums > 1)
 				{
-					Pheet::template finish<Self>(data + (BlockSize - 1)*step, num_blocks - 1, BlockSize * step, true, pc); 
+					Pheet::template finish<Self>(data + (BlockSize - 1)*step, num_sums, BlockSize * step, true, pc);
 				}
 //				std::cout << data[1024] << std::endl;
 
@@ -86,7 +90,7 @@ public:
 #ifdef __MIC__
 		calcLocalPrefixSumMIC();
 #else
-		calcLocalPrefixSumSSE();
+		calcLocalPrefixSumKernels();
 #endif
 	}
 	
@@ -94,8 +98,7 @@ public:
 	__m512i calcVectorPrefixSum(__m512i  v);
 	void calcLocalPrefixSumMIC();
 #else
-	__m128i calcVectorPrefixSumSSE(__m128i  v);
-	void calcLocalPrefixSumSSE();
+	void calcLocalPrefixSumKernels();
 #endif
 
 	static char const name[];
@@ -109,8 +112,8 @@ private:
 };
 
 #ifdef __MIC__
-template <class Pheet, size_t BlockSize>
-__m512i RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::calcVectorPrefixSum(__m512i  v)
+template <class Pheet, size_t BlockSize, PrefixSumIsa Isa>
+__m512i RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize, Isa>::calcVectorPrefixSum(__m512i  v)
 {
 	const size_t elemsPerVector = sizeof(__m512i) / sizeof(data[0]);
 	__m512i zero = _mm512_setzero_epi32();
@@ -127,8 +130,8 @@ __m512i RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::calcVectorPr
 	return _mm512_add_epi32(v, t);
 }
 
-template <class Pheet, size_t BlockSize>
-void RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::calcLocalPrefixSumMIC()
+template <class Pheet, size_t BlockSize, PrefixSumIsa Isa>
+void RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize, Isa>::calcLocalPrefixSumMIC()
 {
 	const size_t elemsPerVector = sizeof(__m512i) / sizeof(data[0]);
 	if (length < elemsPerVector)
@@ -198,68 +201,25 @@ void RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::calcLocalPrefix
 		p[i] += p[i - 1];
 }
 #else
-template <class Pheet, size_t BlockSize>
-__m128i RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::calcVectorPrefixSumSSE(__m128i  v)
+template <class Pheet, size_t BlockSize, PrefixSumIsa Isa>
+void RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize, Isa>::calcLocalPrefixSumKernels()
 {
-//	const size_t elemsPerVector = sizeof(__m128i) / sizeof(data[0]);
-	static_assert(/* elemsPerVector */ sizeof(__m128i) / sizeof(data[0]) == 4, "Only 32 bit integers are supported");
-
-	// Need temporary or won't compile under GCC 4.8
-	size_t const tmp = sizeof(data[0]);
-	__m128i t = _mm_slli_si128(v, tmp);
-	v = _mm_add_epi32(v, t);
-
-	// Need temporary or won't compile under GCC 4.8
-	size_t const tmp2 = sizeof(data[0])*2;
-	t = _mm_slli_si128(v, tmp2);
-	return _mm_add_epi32(v, t);
-}
-
-template <class Pheet, size_t BlockSize>
-void RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::calcLocalPrefixSumSSE()
-{
-	const size_t elemsPerVector = sizeof(__m128i) / sizeof(data[0]);
-	if (length < elemsPerVector || step != 1)
+	if (step != 1)
 	{
 		for(size_t i = 1; i < length; ++i)
 			data[i*step] += data[(i - 1)*step];
 		return;
 	}
 
-	const size_t remainingLength = length % elemsPerVector;
-	length -= remainingLength; // make length a multiple of elemsPerVector
-//	const size_t iterations = length / elemsPerVector;
-
-	pheet_assert(step == 1);
-	pheet_assert(elemsPerVector == 4); // this implementation supports only 4 32-bit integer elements
-	pheet_assert(length % elemsPerVector == 0);
-	pheet_assert((size_t)data % sizeof(__m128i) == 0); // pointer must be aligned to vector size
-
-//	__m128i zero = _mm_setzero_si128();
-	__m128i prev = _mm_setzero_si128();
-	auto p = data;
-	for (auto end = p + length; p != end; p += elemsPerVector)
-	{
-		__m128i v1 = _mm_load_si128((__m128i*)p);
-
-		v1 = calcVectorPrefixSumSSE(v1);
-		v1 = _mm_add_epi32(v1, prev);
-
-		_mm_store_si128((__m128i*)p, v1);
-		prev = _mm_shuffle_epi32(v1, _MM_SHUFFLE(3, 3, 3, 3)); // broadcast the highest element to the full vector
-	}
-
-	// post alignment loop
-	for (size_t i = 0; i < remainingLength; ++i)
-		p[i] += p[i - 1];
+	PrefixSumKernels<unsigned int>::scan(data, length, 0, Isa);
 }
 #endif
 
-template <class Pheet, size_t BlockSize>
-char const RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize>::name[] = "RecursiveParallelVectorizedPrefixSum";
+template <class Pheet, size_t BlockSize, PrefixSumIsa Isa>
+char const RecursiveParallelVectorizedPrefixSumImpl<Pheet, BlockSize, Isa>::name[] = "RecursiveParallelVectorizedPrefixSum";
 
 template <class Pheet>
-using RecursiveParallelVectorizedPrefixSum = RecursiveParallelVectorizedPrefixSumImpl<Pheet, 4096>;
+using RecursiveParallelVectorizedPrefixSum = RecursiveParallelVectorizedPrefixSumImpl<Pheet, 4096, PrefixSumIsa::automatic>;
 
 } /* namespace pheet */
 #endif /* RECURSIVEPARALLELVECTORIZEDPREFIXSUM_H_ */
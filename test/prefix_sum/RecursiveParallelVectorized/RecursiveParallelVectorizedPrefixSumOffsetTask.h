@@ -11,14 +11,15 @@
 
 #include <pheet/pheet.h>
 #include <immintrin.h>
+#include "PrefixSumKernels.h"
 
 //#define COMPILER_VECTORIZED
 namespace pheet {
 
-template <class Pheet, size_t BlockSize>
+template <class Pheet, size_t BlockSize, PrefixSumIsa Isa>
 class RecursiveParallelVectorizedPrefixSumOffsetTask : public Pheet::Task {
 public:
-	typedef RecursiveParallelVectorizedPrefixSumOffsetTask<Pheet, BlockSize> Self;
+	typedef RecursiveParallelVectorizedPrefixSumOffsetTask<Pheet, BlockSize, Isa> Self;
 
 	RecursiveParallelVectorizedPrefixSumOffsetTask(unsigned int* data, size_t length, size_t step)
 	:data(data), length(length), step(step) {}
@@ -32,7 +33,7 @@ public:
 #ifdef __MIC__
 		offsetMIC();
 #else
-		offsetSSE();
+		offsetKernels();
 #endif
 #endif
 	}
@@ -138,7 +139,7 @@ public:
 	}
 #else
 
-	void offsetSSE()
+	void offsetKernels()
 	{
 		if(length <= BlockSize)
 		{
@@ -154,24 +155,7 @@ public:
 			}
 			else
 			{
-				const size_t elemsPerVector = sizeof(__m128i) / sizeof(data[0]);
-				const size_t remainingLength = length % elemsPerVector;
-				unsigned int v1 = *(data - step);
-				__m128i v = _mm_set1_epi32((int)v1);
-				
-				length -= remainingLength;
-				pheet_assert((size_t)data % sizeof(__m128i) == 0); // pointer must be aligned to vector size
-
-				auto p = data;
-				for(auto end = p + length; p != end; p += elemsPerVector)
-				{
-					__m128i t = _mm_load_si128((__m128i*)p);
-					t = _mm_add_epi32(v, t);
-					_mm_store_si128((__m128i*)p, t);
-				}
-
-				for(size_t i = 0; i < remainingLength; ++i)
-					p[i] += v1;
+				PrefixSumKernels<unsigned int>::add(data, length, *(data - step), Isa);
 			}
 		}
 		else
@@ -0,0 +1,111 @@
+/*
+ * ReduceThenScanPrefixSum.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef REDUCETHENSCANPREFIXSUM_H_
+#define REDUCETHENSCANPREFIXSUM_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_for.h>
+#include <pheet/primitives/PerformanceCounter/DummyPerformanceCounters.h>
+#include "../RecursiveParallelVectorized/PrefixSumKernels.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace pheet {
+
+inline char const* reduce_then_scan_prefix_sum_name(PrefixSumIsa isa) {
+	switch(isa) {
+	case PrefixSumIsa::scalar:
+		return "ReduceThenScanPrefixSum<scalar>";
+	case PrefixSumIsa::sse2:
+		return "ReduceThenScanPrefixSum<sse2>";
+	case PrefixSumIsa::avx2:
+		return "ReduceThenScanPrefixSum<avx2>";
+	case PrefixSumIsa::avx512:
+		return "ReduceThenScanPrefixSum<avx512>";
+	default:
+		return "ReduceThenScanPrefixSum";
+	}
+}
+
+/*
+ * Two pass prefix sum: the first pass only reduces each block, the block sums are scanned
+ * sequentially, and the second pass scans each block starting with the sum of all blocks
+ * before it. In contrast to the recursive variants, which scan each block, scan the block
+ * sums and then add the offsets, memory is only read twice and written once.
+ * The local work is done by the kernels of the given instruction set (see PrefixSumKernels).
+ */
+template <class Pheet, typename T, size_t BlockSize, PrefixSumIsa Isa>
+class ReduceThenScanPrefixSumImpl : public Pheet::Task {
+public:
+	typedef ReduceThenScanPrefixSumImpl<Pheet, T, BlockSize, Isa> Self;
+	typedef PrefixSumKernels<T> Kernels;
+	typedef DummyPerformanceCounters<Pheet> PerformanceCounters;
+
+	ReduceThenScanPrefixSumImpl(T* data, size_t length)
+	:data(data), length(length) {}
+	ReduceThenScanPrefixSumImpl(T* data, size_t length, PerformanceCounters&)
+	:data(data), length(length) {}
+	virtual ~ReduceThenScanPrefixSumImpl() {}
+
+	virtual void operator()() {
+		size_t num_blocks = (length + BlockSize - 1) / BlockSize;
+		if(num_blocks <= 1) {
+			Kernels::scan(data, length, T(), Isa);
+			return;
+		}
+
+		// The sum of the last block is not needed
+		std::vector<T> offsets(num_blocks);
+		parallel_for<Pheet>(static_cast<size_t>(0), num_blocks - 1,
+			[&](size_t b) {
+				offsets[b] = Kernels::reduce(data + b * BlockSize, BlockSize, Isa);
+			}, 1);
+
+		T sum = T();
+		for(size_t b = 0; b < num_blocks; ++b) {
+			T s = offsets[b];
+			offsets[b] = sum;
+			sum += s;
+		}
+
+		parallel_for<Pheet>(static_cast<size_t>(0), num_blocks,
+			[&](size_t b) {
+				size_t begin = b * BlockSize;
+				Kernels::scan(data + begin, std::min(BlockSize, length - begin), offsets[b], Isa);
+			}, 1);
+	}
+
+	static char const* const name;
+
+private:
+	T* data;
+	size_t length;
+};
+
+template <class Pheet, typename T, size_t BlockSize, PrefixSumIsa Isa>
+char const* const ReduceThenScanPrefixSumImpl<Pheet, T, BlockSize, Isa>::name = reduce_then_scan_prefix_sum_name(prefix_sum_isa(Isa));
+
+template <class Pheet>
+using ReduceThenScanPrefixSum = ReduceThenScanPrefixSumImpl<Pheet, unsigned int, 16384, PrefixSumIsa::automatic>;
+
+template <class Pheet>
+using ReduceThenScanPrefixSumScalar = ReduceThenScanPrefixSumImpl<Pheet, unsigned int, 16384, PrefixSumIsa::scalar>;
+
+template <class Pheet>
+using ReduceThenScanPrefixSumSSE2 = ReduceThenScanPrefixSumImpl<Pheet, unsigned int, 16384, PrefixSumIsa::sse2>;
+
+template <class Pheet>
+using ReduceThenScanPrefixSumAVX2 = ReduceThenScanPrefixSumImpl<Pheet, unsigned int, 16384, PrefixSumIsa::avx2>;
+
+template <class Pheet>
+using ReduceThenScanPrefixSumAVX512 = ReduceThenScanPrefixSumImpl<Pheet, unsigned int, 16384, PrefixSumIsa::avx512>;
+
+} /* namespace pheet */
+#endif /* REDUCETHENSCANPREFIXSUM_H_ */
@@ -12,6 +12,7 @@
 #include "SetBench.h"
 #ifdef SET_BENCH
 #include <pheet/ds/Set/GlobalLock/GlobalLockSet.h>
+#include <pheet/ds/Set/SplitOrdered/SplitOrderedHashSet.h>
 #endif
 
 namespace pheet {
@@ -33,6 +34,8 @@ void SetBench::run_test() {
 	// default tests
 	this->run_bench<	Pheet,
 						GlobalLockSet>();
+	this->run_bench<	Pheet,
+						SplitOrderedHashSet>();
 
 #endif
 }
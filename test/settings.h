@@ -42,5 +42,7 @@ bool const sssp_count_actual_tasks = false;
 bool const sssp_measure_last_non_dead_time = false;
 bool const sssp_measure_last_task_time = false;
 bool const sssp_measure_last_update_time = false;
+bool const sssp_count_buckets = false;
+bool const sssp_count_phases = false;
 
 #endif /* PHEET_TEST_SETTINGS_H_ */
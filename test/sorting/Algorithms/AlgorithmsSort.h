@@ -0,0 +1,43 @@
+/*
+ * AlgorithmsSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef ALGORITHMSSORT_H_
+#define ALGORITHMSSORT_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_sort.h>
+
+namespace pheet {
+
+/*
+ * Sorts using the generic parallel_sort from pheet/algorithms
+ */
+template <class Pheet>
+class AlgorithmsSort : public Pheet::Task {
+public:
+	AlgorithmsSort(unsigned int* data, size_t length)
+	: data(data), length(length) {}
+	virtual ~AlgorithmsSort() {}
+
+	virtual void operator()() {
+		parallel_sort<Pheet>(data, data + length);
+	}
+
+	static char const name[];
+
+private:
+	unsigned int* data;
+	size_t length;
+};
+
+template <class Pheet>
+char const AlgorithmsSort<Pheet>::name[] = "Algorithms parallel_sort";
+
+}
+
+#endif /* ALGORITHMSSORT_H_ */
@@ -0,0 +1,189 @@
+/*
+ * MultiwayMergesort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef MULTIWAYMERGESORT_H_
+#define MULTIWAYMERGESORT_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_for.h>
+#include "../sorting_helpers.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Parallel multiway mergesort (like the MCSTL/libstdc++ parallel mode sort). The input is
+ * split into RunsPerPlace runs per place, which are sorted sequentially in parallel.
+ * The output is then split into as many parts, and for each part the matching range of
+ * every run is found by multisequence selection (a binary search over the key range, as
+ * keys are unsigned ints). Each part is merged independently with a binary heap over the
+ * runs, so the merge is fully parallel as well.
+ */
+template <class Pheet, size_t RunsPerPlace>
+class MultiwayMergesortImpl : public Pheet::Task {
+public:
+	typedef MultiwayMergesortImpl<Pheet, RunsPerPlace> Self;
+
+	MultiwayMergesortImpl(unsigned int* data, size_t length)
+	: data(data), length(length) {}
+	virtual ~MultiwayMergesortImpl() {}
+
+	virtual void operator()() {
+		unsigned int* tmp = new unsigned int[length];
+		size_t num_runs = std::min(length / sorting_base_case_length, Pheet::get_num_places() * RunsPerPlace);
+		if(num_runs <= 1) {
+			sorting_base_case(data, length, tmp);
+			delete[] tmp;
+			return;
+		}
+
+		std::vector<size_t> run_begin(num_runs + 1);
+		for(size_t i = 0; i <= num_runs; ++i) {
+			run_begin[i] = (length / num_runs) * i + std::min(i, length % num_runs);
+		}
+
+		parallel_for<Pheet>(static_cast<size_t>(0), num_runs,
+			[&](size_t r) {
+				sorting_base_case(data + run_begin[r], run_begin[r + 1] - run_begin[r], tmp + run_begin[r]);
+			}, 1);
+
+		// split[p * num_runs + r]: position in run r where output part p starts
+		size_t num_parts = num_runs;
+		std::vector<size_t> split((num_parts + 1) * num_runs);
+		for(size_t r = 0; r < num_runs; ++r) {
+			split[r] = run_begin[r];
+			split[num_parts * num_runs + r] = run_begin[r + 1];
+		}
+		parallel_for<Pheet>(static_cast<size_t>(1), num_parts,
+			[&](size_t p) {
+				select(run_begin, run_begin[p], &split[p * num_runs]);
+			}, 1);
+
+		parallel_for<Pheet>(static_cast<size_t>(0), num_parts,
+			[&](size_t p) {
+				merge(&split[p * num_runs], &split[(p + 1) * num_runs], num_runs, tmp + run_begin[p]);
+			}, 1);
+
+		parallel_for<Pheet>(static_cast<size_t>(0), num_parts,
+			[&](size_t p) {
+				memcpy(data + run_begin[p], tmp + run_begin[p], (run_begin[p + 1] - run_begin[p]) * sizeof(unsigned int));
+			}, 1);
+
+		delete[] tmp;
+	}
+
+	static char const name[];
+
+private:
+	/*
+	 * Multisequence selection: finds positions in all runs, so that there are rank keys
+	 * before them in total, and none of these keys is larger than any key after them.
+	 */
+	void select(std::vector<size_t> const& run_begin, size_t rank, size_t* pos) {
+		size_t num_runs = run_begin.size() - 1;
+
+		// Smallest key v with at least rank keys <= v
+		unsigned int lo = 0;
+		unsigned int hi = std::numeric_limits<unsigned int>::max();
+		while(lo < hi) {
+			unsigned int mid = lo + (hi - lo) / 2;
+			size_t c = 0;
+			for(size_t r = 0; r < num_runs; ++r) {
+				c += std::upper_bound(data + run_begin[r], data + run_begin[r + 1], mid) - (data + run_begin[r]);
+			}
+			if(c >= rank) {
+				hi = mid;
+			}
+			else {
+				lo = mid + 1;
+			}
+		}
+
+		// Take all keys < v, then keys == v from the runs in order until rank is reached
+		size_t remaining = rank;
+		for(size_t r = 0; r < num_runs; ++r) {
+			pos[r] = std::lower_bound(data + run_begin[r], data + run_begin[r + 1], lo) - data;
+			remaining -= pos[r] - run_begin[r];
+		}
+		for(size_t r = 0; r < num_runs && remaining > 0; ++r) {
+			size_t equal = std::upper_bound(data + pos[r], data + run_begin[r + 1], lo) - (data + pos[r]);
+			size_t take = std::min(equal, remaining);
+			pos[r] += take;
+			remaining -= take;
+		}
+	}
+
+	void merge(size_t const* begin, size_t const* end, size_t num_runs, unsigned int* out) {
+		// Min-heap of runs, ordered by their current key
+		std::vector<size_t> pos(begin, begin + num_runs);
+		std::vector<size_t> heap;
+		heap.reserve(num_runs);
+		for(size_t r = 0; r < num_runs; ++r) {
+			if(pos[r] != end[r]) {
+				heap.push_back(r);
+			}
+		}
+		auto greater = [&](size_t a, size_t b) {
+			return data[pos[a]] > data[pos[b]];
+		};
+		std::make_heap(heap.begin(), heap.end(), greater);
+
+		while(heap.size() > 1) {
+			size_t r = heap.front();
+			*(out++) = data[pos[r]++];
+			if(pos[r] == end[r]) {
+				std::pop_heap(heap.begin(), heap.end(), greater);
+				heap.pop_back();
+			}
+			else {
+				sift_down(heap, greater);
+			}
+		}
+		if(!heap.empty()) {
+			size_t r = heap.front();
+			memcpy(out, data + pos[r], (end[r] - pos[r]) * sizeof(unsigned int));
+		}
+	}
+
+	template <class Greater>
+	static void sift_down(std::vector<size_t>& heap, Greater& greater) {
+		size_t i = 0;
+		size_t n = heap.size();
+		while(true) {
+			size_t c = 2 * i + 1;
+			if(c >= n) {
+				break;
+			}
+			if(c + 1 < n && greater(heap[c], heap[c + 1])) {
+				++c;
+			}
+			if(!greater(heap[i], heap[c])) {
+				break;
+			}
+			std::swap(heap[i], heap[c]);
+			i = c;
+		}
+	}
+
+	unsigned int* data;
+	size_t length;
+};
+
+template <class Pheet, size_t RunsPerPlace>
+char const MultiwayMergesortImpl<Pheet, RunsPerPlace>::name[] = "MultiwayMergesort";
+
+template <class Pheet>
+using MultiwayMergesort = MultiwayMergesortImpl<Pheet, 2>;
+
+}
+
+#endif /* MULTIWAYMERGESORT_H_ */
@@ -0,0 +1,177 @@
+/*
+ * SampleSort.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SAMPLESORT_H_
+#define SAMPLESORT_H_
+
+#include <pheet/pheet.h>
+#include <pheet/algorithms/parallel_for.h>
+#include "../sorting_helpers.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Parallel sample sort (in the style of super scalar sample sort, Sanders, Winkel 2004).
+ * A sample of the keys is sorted to pick NumBuckets - 1 splitters, which are stored as an
+ * implicit binary search tree, so classifying a key takes log2(NumBuckets) branch-free steps.
+ * Blocks of the input are classified in parallel, and after a prefix sum over the bucket
+ * sizes of all blocks, each block scatters its keys into a scratch array. Each bucket is
+ * then sorted by its own task, recursively, until buckets fit the sequential base case.
+ * In contrast to the quicksorts, no step is sequential over the whole input.
+ */
+template <class Pheet, size_t NumBuckets, size_t Oversampling>
+class SampleSortImpl : public Pheet::Task {
+public:
+	typedef SampleSortImpl<Pheet, NumBuckets, Oversampling> Self;
+
+	static_assert((NumBuckets & (NumBuckets - 1)) == 0 && NumBuckets >= 2, "NumBuckets needs to be a power of two");
+
+	SampleSortImpl(unsigned int* data, size_t length)
+	: data(data), length(length), tmp(nullptr), in_tmp(false) {}
+	SampleSortImpl(unsigned int* data, size_t length, unsigned int* tmp, bool in_tmp)
+	: data(data), length(length), tmp(tmp), in_tmp(in_tmp) {}
+	virtual ~SampleSortImpl() {}
+
+	virtual void operator()() {
+		if(tmp == nullptr) {
+			// Root task: all tasks share one scratch array, so wait for them before freeing it
+			tmp = new unsigned int[length];
+			Pheet::template
+				finish<Self>(data, length, tmp, false);
+			delete[] tmp;
+			return;
+		}
+		if(in_tmp) {
+			memcpy(data, tmp, length * sizeof(unsigned int));
+		}
+		if(length <= sorting_base_case_length) {
+			sorting_base_case(data, length, tmp);
+			return;
+		}
+		sort();
+	}
+
+	static char const name[];
+
+private:
+	void sort() {
+		unsigned int tree[NumBuckets];
+		build_tree(tree);
+
+		size_t block_size = algorithm_grain_size<Pheet>(length, 0, sorting_base_case_length / 4);
+		size_t num_blocks = (length + block_size - 1) / block_size;
+		std::vector<size_t> offsets(num_blocks * NumBuckets, 0);
+
+		// Classify: count the keys of each block per bucket
+		parallel_for<Pheet>(static_cast<size_t>(0), num_blocks,
+			[&](size_t b) {
+				size_t* count = &offsets[b * NumBuckets];
+				unsigned int* end = data + std::min(length, (b + 1) * block_size);
+				for(unsigned int* i = data + b * block_size; i != end; ++i) {
+					++count[classify(tree, *i)];
+				}
+			}, 1);
+
+		// Each block gets its own range inside each bucket
+		size_t bucket_begin[NumBuckets + 1];
+		size_t offset = 0;
+		for(size_t j = 0; j < NumBuckets; ++j) {
+			bucket_begin[j] = offset;
+			for(size_t b = 0; b < num_blocks; ++b) {
+				size_t c = offsets[b * NumBuckets + j];
+				offsets[b * NumBuckets + j] = offset;
+				offset += c;
+			}
+		}
+		bucket_begin[NumBuckets] = length;
+
+		// Scatter into the scratch array
+		parallel_for<Pheet>(static_cast<size_t>(0), num_blocks,
+			[&](size_t b) {
+				size_t* pos = &offsets[b * NumBuckets];
+				unsigned int* end = data + std::min(length, (b + 1) * block_size);
+				for(unsigned int* i = data + b * block_size; i != end; ++i) {
+					tmp[pos[classify(tree, *i)]++] = *i;
+				}
+			}, 1);
+
+		for(size_t j = 0; j < NumBuckets; ++j) {
+			size_t b = bucket_begin[j];
+			size_t l = bucket_begin[j + 1] - b;
+			if(l == length) {
+				// All keys went to this bucket (e.g. all samples were equal), so recursing on it
+				// would not make progress. Sort it with the base case instead
+				memcpy(data, tmp, length * sizeof(unsigned int));
+				sorting_base_case(data, length, tmp);
+			}
+			else if(l > 0) {
+				Pheet::template
+					spawn<Self>(data + b, l, tmp + b, true);
+			}
+		}
+	}
+
+	/*
+	 * Splitters in breadth first order, tree[1] being the root
+	 */
+	void build_tree(unsigned int* tree) {
+		size_t num_samples = NumBuckets * Oversampling;
+		std::vector<unsigned int> samples(num_samples);
+		std::mt19937 rng(length);
+		std::uniform_int_distribution<size_t> dist(0, length - 1);
+		for(size_t i = 0; i < num_samples; ++i) {
+			samples[i] = data[dist(rng)];
+		}
+		std::sort(samples.begin(), samples.end());
+
+		unsigned int splitters[NumBuckets];
+		for(size_t i = 1; i < NumBuckets; ++i) {
+			splitters[i] = samples[i * Oversampling - 1];
+		}
+		size_t next = 1;
+		fill_tree(tree, splitters, 1, next);
+	}
+
+	void fill_tree(unsigned int* tree, unsigned int* splitters, size_t node, size_t& next) {
+		// In-order traversal assigns the sorted splitters
+		if(node >= NumBuckets) {
+			return;
+		}
+		fill_tree(tree, splitters, 2 * node, next);
+		tree[node] = splitters[next++];
+		fill_tree(tree, splitters, 2 * node + 1, next);
+	}
+
+	static size_t classify(unsigned int const* tree, unsigned int x) {
+		size_t i = 1;
+		while(i < NumBuckets) {
+			i = 2 * i + (x > tree[i]);
+		}
+		return i - NumBuckets;
+	}
+
+	unsigned int* data;
+	size_t length;
+	unsigned int* tmp;
+	bool in_tmp;
+};
+
+template <class Pheet, size_t NumBuckets, size_t Oversampling>
+char const SampleSortImpl<Pheet, NumBuckets, Oversampling>::name[] = "SampleSort";
+
+template <class Pheet>
+using SampleSort = SampleSortImpl<Pheet, 256, 16>;
+
+}
+
+#endif /* SAMPLESORT_H_ */
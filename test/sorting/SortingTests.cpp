@@ -15,6 +15,9 @@
 #include "Strategy/StrategyQuicksort.h"
 #include "Strategy2/Strategy2Quicksort.h"
 #include "Dag/DagQuicksort.h"
+#include "Algorithms/AlgorithmsSort.h"
+#include "SampleSort/SampleSort.h"
+#include "MultiwayMergesort/MultiwayMergesort.h"
 #include "MixedMode/MixedModeQuicksort.h"
 #include "Reference/ReferenceHeapSort.h"
 
@@ -124,6 +127,22 @@ void SortingTests::run_test() {
 						DagQuicksort>();
 	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>,
 						DagQuicksort>();
+	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>,
+						SampleSort>();
+	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>,
+						MultiwayMergesort>();
+	this->run_sorter<	Pheet::WithScheduler<StrategyScheduler>,
+						SampleSort>();
+	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>,
+						AlgorithmsSort>();
+	this->run_sorter<	Pheet::WithScheduler<StrategyScheduler>,
+						AlgorithmsSort>();
+	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>::WithVictimSelector<LastVictimSelector>,
+						DagQuicksort>();
+	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>::WithVictimSelector<NumaWeightedVictimSelector>,
+						DagQuicksort>();
+	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>::WithVictimSelector<RoundRobinVictimSelector>,
+						DagQuicksort>();
 //	this->run_sorter<	Pheet::WithScheduler<BasicScheduler>::WithStealingDeque<CircularArrayStealingDeque11>,
 //						DagQuicksort>();
 	this->run_sorter<	Pheet::WithScheduler<SynchroneousScheduler>,
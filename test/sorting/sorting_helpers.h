@@ -0,0 +1,91 @@
+/*
+ * sorting_helpers.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SORTING_HELPERS_H_
+#define SORTING_HELPERS_H_
+
+#include <pheet/misc/types.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace pheet {
+
+/*
+ * Pieces of up to this many keys are sorted sequentially. 2^16 keys (256KB) plus the same
+ * amount of scratch space fit into the L2 cache of most recent processors.
+ */
+size_t const sorting_base_case_length = 65536;
+
+/*
+ * Pieces shorter than this are sorted by insertion sort
+ */
+size_t const sorting_insertion_sort_length = 64;
+
+inline void sorting_insertion_sort(unsigned int* data, size_t length) {
+	for(size_t i = 1; i < length; ++i) {
+		unsigned int x = data[i];
+		size_t j = i;
+		for(; j > 0 && data[j - 1] > x; --j) {
+			data[j] = data[j - 1];
+		}
+		data[j] = x;
+	}
+}
+
+/*
+ * Sequential base case for the parallel sorters: LSD radix sort with 8 bit digits, using tmp
+ * (at least length keys) as scratch space. All four histograms are built in a single pass,
+ * and digits in which all keys agree are skipped, so presorted or equal keys are cheap.
+ * Each pass is a streaming read plus 256 streaming writes, with a 1KB histogram that stays
+ * in L1, which keeps this well ahead of comparison sorts for pieces that fit in cache.
+ */
+inline void sorting_base_case(unsigned int* data, size_t length, unsigned int* tmp) {
+	if(length < sorting_insertion_sort_length) {
+		sorting_insertion_sort(data, length);
+		return;
+	}
+
+	size_t count[4][256];
+	memset(count, 0, sizeof(count));
+	for(size_t i = 0; i < length; ++i) {
+		unsigned int x = data[i];
+		++count[0][x & 0xFF];
+		++count[1][(x >> 8) & 0xFF];
+		++count[2][(x >> 16) & 0xFF];
+		++count[3][x >> 24];
+	}
+
+	unsigned int* src = data;
+	unsigned int* dst = tmp;
+	for(int d = 0; d < 4; ++d) {
+		unsigned int shift = d * 8;
+		if(count[d][(src[0] >> shift) & 0xFF] == length) {
+			// All keys have the same digit
+			continue;
+		}
+		size_t offset = 0;
+		for(size_t b = 0; b < 256; ++b) {
+			size_t c = count[d][b];
+			count[d][b] = offset;
+			offset += c;
+		}
+		for(size_t i = 0; i < length; ++i) {
+			unsigned int x = src[i];
+			dst[count[d][(x >> shift) & 0xFF]++] = x;
+		}
+		std::swap(src, dst);
+	}
+	if(src != data) {
+		memcpy(data, src, length * sizeof(unsigned int));
+	}
+}
+
+}
+
+#endif /* SORTING_HELPERS_H_ */
@@ -41,7 +41,7 @@ class SsspAnalysis : public Pheet::Task {
 public:
 	typedef SsspAnalysisPerformanceCounters<Pheet> PerformanceCounters;
 
-	SsspAnalysis(SsspGraphVertex* graph, size_t size, PerformanceCounters& pc)
+	SsspAnalysis(SsspGraph* graph, size_t size, PerformanceCounters& pc)
 	:graph(graph), size(size), pc(pc) {}
 	virtual ~SsspAnalysis() {}
 
@@ -104,7 +104,7 @@ public:
 		}
 #endif
 
-		graph[0].distance = 0;
+		graph->distance(0) = 0;
 
 		std::vector<SsspAnalysisNode> v;
 		v.push_back(n);
@@ -119,7 +119,7 @@ public:
 			}
 			size_t node = n.node_id;
 
-			size_t d = graph[node].distance;
+			size_t d = graph->distance(node);
 			if(d != n.distance) {
 				++offset;
 				pc.num_dead_tasks.incr();
@@ -140,7 +140,7 @@ public:
 			size_t processed_samples = 0;
 			// Print list of nodes
 			for(size_t i = offset; i < v.size(); ++i) {
-				if(graph[v[i].node_id].distance == v[i].distance) {
+				if(graph->distance(v[i].node_id) == v[i].distance) {
 					if(!v[i].processed) {
 						++samples;
 						sum += v[i].distance - base;
@@ -181,7 +181,7 @@ public:
 				for(size_t i = offset; i < v.size(); ++i) {
 					n = v[i];
 					size_t node = n.node_id;
-					size_t d = graph[node].distance;
+					size_t d = graph->distance(node);
 					if(d == n.distance && !n.processed) {
 						active_nodes.push_back(n.node_id);
 					}
@@ -192,21 +192,21 @@ public:
 				for(size_t i = 0; i < active_nodes.size() - 1; ++i) {
 					for(size_t j = i + 1; j < active_nodes.size(); ++j) {
 						++tested;
-						auto first = graph[active_nodes[i]].edges;
-						auto last = graph[active_nodes[i]].edges + graph[active_nodes[i]].num_edges - 1;
+						size_t first = graph->edges_begin(active_nodes[i]);
+						size_t last = graph->edges_end(active_nodes[i]) - 1;
 						while(first != last) {
-							auto middle = first + ((last - first) >> 1);
-							if(middle->target == active_nodes[j]) {
+							size_t middle = first + ((last - first) >> 1);
+							if(graph->target(middle) == active_nodes[j]) {
 								first = last = middle;
 							}
-							else if(middle->target < active_nodes[j]) {
+							else if(graph->target(middle) < active_nodes[j]) {
 								first = middle + 1;
 							}
 							else {
 								last = middle;
 							}
 						}
-						if(first->target == active_nodes[j]) {
+						if(graph->target(first) == active_nodes[j]) {
 							++found;
 						}
 					}
@@ -228,7 +228,7 @@ public:
 			// Mark nodes that can be processed in this phase as active (distance values
 			// might change during update, so we can't rely on them)
 			for(size_t i = offset; i < v.size(); ++i) {
-				if(graph[v[i].node_id].distance == v[i].distance &&
+				if(graph->distance(v[i].node_id) == v[i].distance &&
 						!v[i].processed) {
 					v[i].active = true;
 				}
@@ -270,10 +270,10 @@ public:
 						}
 
 						// relax node
-						for(size_t i = 0; i < graph[node].num_edges; ++i) {
-							size_t new_d = d + graph[node].edges[i].weight;
-							size_t target = graph[node].edges[i].target;
-							size_t old_d = graph[target].distance;
+						for(size_t e = graph->edges_begin(node); e != graph->edges_end(node); ++e) {
+							size_t new_d = d + graph->weight(e);
+							size_t target = graph->target(e);
+							size_t old_d = graph->distance(target);
 							if(old_d > new_d) {
 								if(old_d == std::numeric_limits<size_t>::max()) {
 									++sum_new;
@@ -281,7 +281,7 @@ public:
 								else {
 									++sum_upd;
 								}
-								graph[target].distance = new_d;
+								graph->distance(target) = new_d;
 								n.distance = new_d;
 								n.node_id = target;
 								n.processed = false;
@@ -306,7 +306,7 @@ public:
 				for(j2 = 1;j < block_size && offset + j2 < orig_size; ++j2) {
 					n = v[offset + j2];
 					size_t node = n.node_id;
-					size_t d = graph[node].distance;
+					size_t d = graph->distance(node);
 					size_t a = n.added;
 
 					// Node not visible to all threads
@@ -331,10 +331,10 @@ public:
 							}
 
 							// relax node
-							for(size_t i = 0; i < graph[node].num_edges; ++i) {
-								size_t new_d = d + graph[node].edges[i].weight;
-								size_t target = graph[node].edges[i].target;
-								size_t old_d = graph[target].distance;
+							for(size_t e = graph->edges_begin(node); e != graph->edges_end(node); ++e) {
+								size_t new_d = d + graph->weight(e);
+								size_t target = graph->target(e);
+								size_t old_d = graph->distance(target);
 								if(old_d > new_d) {
 									if(old_d == std::numeric_limits<size_t>::max()) {
 										++sum_new;
@@ -342,7 +342,7 @@ public:
 									else {
 										++sum_upd;
 									}
-									graph[target].distance = new_d;
+									graph->distance(target) = new_d;
 									n.distance = new_d;
 									n.node_id = target;
 									n.processed = false;
@@ -536,7 +536,7 @@ public:
 
 	static char const name[];
 private:
-	SsspGraphVertex* graph;
+	SsspGraph* graph;
 	size_t size;
 	PerformanceCounters pc;
 };
@@ -0,0 +1,237 @@
+/*
+ * DeltaSteppingSssp.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef DELTASTEPPINGSSSP_H_
+#define DELTASTEPPINGSSSP_H_
+
+#include "../sssp_graph_helpers.h"
+#include "DeltaSteppingSsspPerformanceCounters.h"
+
+#include <pheet/algorithms/parallel_for.h>
+#include <pheet/algorithms/parallel_reduce.h>
+#include <pheet/algorithms/parallel_scan.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace pheet {
+
+struct DeltaSteppingSsspEntry {
+	uint32_t node;
+	size_t distance;
+};
+
+/*
+ * Delta-stepping (Meyer and Sanders). Vertices are kept in buckets of width delta. The light
+ * edges (weight <= delta) of the vertices in the current bucket are relaxed in bulk until the
+ * bucket stays empty, then the heavy edges of all vertices removed from the bucket are
+ * relaxed once.
+ *
+ * Each phase relaxes the entries of the current bucket in parallel, in blocks of BlockSize
+ * entries. Improved distances are collected per block and put into the buckets afterwards.
+ * Buckets are stored in a cyclic array, as all tentative distances stay within max_w of the
+ * current bucket.
+ *
+ * Delta = 0 selects delta = max_w / average degree.
+ */
+template <class Pheet, size_t Delta, size_t BlockSize>
+class DeltaSteppingSsspImpl : public Pheet::Task {
+public:
+	typedef DeltaSteppingSsspImpl<Pheet, Delta, BlockSize> Self;
+	typedef DeltaSteppingSsspPerformanceCounters<Pheet> PerformanceCounters;
+	typedef DeltaSteppingSsspEntry Entry;
+
+	DeltaSteppingSsspImpl(SsspGraph* graph, size_t size, PerformanceCounters& pc)
+	:graph(graph), size(size), delta(Delta), pc(pc) {}
+	virtual ~DeltaSteppingSsspImpl() {}
+
+	virtual void operator()() {
+		if(size == 0) {
+			return;
+		}
+		split_edges();
+
+		size_t num_buckets = max_w / delta + 2;
+		std::vector<std::vector<Entry> > buckets(num_buckets);
+		Entry source;
+		source.node = 0;
+		source.distance = graph->distance(0).load(std::memory_order_relaxed);
+		buckets[(source.distance / delta) % num_buckets].push_back(source);
+		size_t pending = 1;
+
+		std::vector<Entry> frontier;
+		std::vector<Entry> removed;
+		size_t current = source.distance / delta;
+		while(pending != 0) {
+			while(buckets[current % num_buckets].empty()) {
+				++current;
+			}
+			pc.num_buckets.incr();
+
+			while(!buckets[current % num_buckets].empty()) {
+				frontier.clear();
+				std::swap(frontier, buckets[current % num_buckets]);
+				pending -= frontier.size();
+				pc.num_phases.incr();
+				relax(frontier, light_offsets, light_edges, true, removed, buckets, pending);
+			}
+
+			relax(removed, heavy_offsets, heavy_edges, false, removed, buckets, pending);
+			removed.clear();
+		}
+	}
+
+	static void set_k(size_t) {}
+
+	static void print_name() {
+		std::cout << name << "<";
+		if(Delta == 0) {
+			std::cout << "auto";
+		}
+		else {
+			std::cout << Delta;
+		}
+		std::cout << ">";
+	}
+
+	static char const name[];
+private:
+	/*
+	 * Copies the light and heavy edges of each vertex into separate arrays, so each
+	 * relaxation only iterates over the edges it needs
+	 */
+	void split_edges() {
+		size_t m = graph->get_num_edges();
+		max_w = parallel_reduce<Pheet>(static_cast<size_t>(0), m, static_cast<size_t>(1),
+			[&](size_t first, size_t last) {
+				size_t ret = 1;
+				for(size_t e = first; e != last; ++e) {
+					ret = std::max(ret, static_cast<size_t>(graph->weight(e)));
+				}
+				return ret;
+			},
+			[](size_t a, size_t b) {
+				return std::max(a, b);
+			});
+		if(delta == 0) {
+			delta = std::max(static_cast<size_t>(1), (max_w * size) / std::max(m, static_cast<size_t>(1)));
+		}
+
+		std::vector<size_t> light_count(size + 1, 0);
+		std::vector<size_t> heavy_count(size + 1, 0);
+		parallel_for<Pheet>(static_cast<size_t>(0), size,
+			[&](size_t v) {
+				size_t light = 0;
+				for(size_t e = graph->edges_begin(v); e != graph->edges_end(v); ++e) {
+					if(graph->weight(e) <= delta) {
+						++light;
+					}
+				}
+				light_count[v] = light;
+				heavy_count[v] = graph->degree(v) - light;
+			});
+		light_offsets.resize(size + 1);
+		heavy_offsets.resize(size + 1);
+		parallel_exclusive_scan<Pheet>(light_count.begin(), light_count.end(), light_offsets.begin(), static_cast<size_t>(0), std::plus<size_t>());
+		parallel_exclusive_scan<Pheet>(heavy_count.begin(), heavy_count.end(), heavy_offsets.begin(), static_cast<size_t>(0), std::plus<size_t>());
+
+		light_edges.resize(light_offsets[size]);
+		heavy_edges.resize(heavy_offsets[size]);
+		parallel_for<Pheet>(static_cast<size_t>(0), size,
+			[&](size_t v) {
+				size_t light = light_offsets[v];
+				size_t heavy = heavy_offsets[v];
+				for(size_t e = graph->edges_begin(v); e != graph->edges_end(v); ++e) {
+					SsspGraphEdge edge;
+					edge.target = graph->target(e);
+					edge.weight = graph->weight(e);
+					if(edge.weight <= delta) {
+						light_edges[light++] = edge;
+					}
+					else {
+						heavy_edges[heavy++] = edge;
+					}
+				}
+			});
+	}
+
+	/*
+	 * Relaxes the given edges of all entries that are still up to date. Improved vertices
+	 * are put into the buckets. If light is set, the relaxed entries are appended to removed.
+	 */
+	void relax(std::vector<Entry> const& entries, std::vector<size_t> const& offsets, std::vector<SsspGraphEdge> const& edges,
+			bool light, std::vector<Entry>& removed, std::vector<std::vector<Entry> >& buckets, size_t& pending) {
+		size_t num_blocks = (entries.size() + BlockSize - 1) / BlockSize;
+		std::vector<std::vector<Entry> > improved(num_blocks);
+		std::vector<std::vector<Entry> > relaxed(light?num_blocks:0);
+		parallel_for<Pheet>(static_cast<size_t>(0), num_blocks,
+			[&](size_t b) {
+				size_t end = std::min(entries.size(), (b + 1) * BlockSize);
+				for(size_t i = b * BlockSize; i < end; ++i) {
+					Entry const& entry = entries[i];
+					if(graph->distance(entry.node).load(std::memory_order_relaxed) != entry.distance) {
+						// Distance has been improved in the meantime, there is a newer entry
+						if(light) {
+							pc.num_dead_tasks.incr();
+						}
+						continue;
+					}
+					if(light) {
+						pc.num_actual_tasks.incr();
+						relaxed[b].push_back(entry);
+					}
+					for(size_t e = offsets[entry.node]; e != offsets[entry.node + 1]; ++e) {
+						Entry n;
+						n.node = edges[e].target;
+						n.distance = entry.distance + edges[e].weight;
+						size_t old_d = graph->distance(n.node).load(std::memory_order_relaxed);
+						while(old_d > n.distance) {
+							if(graph->distance(n.node).compare_exchange_weak(old_d, n.distance, std::memory_order_relaxed)) {
+								improved[b].push_back(n);
+								break;
+							}
+						}
+					}
+				}
+			}, 1);
+
+		for(size_t b = 0; b < num_blocks; ++b) {
+			for(Entry const& n : improved[b]) {
+				// Skip entries that were already improved again in this phase
+				if(graph->distance(n.node).load(std::memory_order_relaxed) == n.distance) {
+					buckets[(n.distance / delta) % buckets.size()].push_back(n);
+					++pending;
+				}
+			}
+			if(light) {
+				removed.insert(removed.end(), relaxed[b].begin(), relaxed[b].end());
+			}
+		}
+	}
+
+	SsspGraph* graph;
+	size_t size;
+	size_t delta;
+	size_t max_w;
+	std::vector<size_t> light_offsets;
+	std::vector<SsspGraphEdge> light_edges;
+	std::vector<size_t> heavy_offsets;
+	std::vector<SsspGraphEdge> heavy_edges;
+	PerformanceCounters pc;
+};
+
+template <class Pheet, size_t Delta, size_t BlockSize>
+char const DeltaSteppingSsspImpl<Pheet, Delta, BlockSize>::name[] = "DeltaStepping Sssp";
+
+template <class Pheet>
+using DeltaSteppingSssp = DeltaSteppingSsspImpl<Pheet, 0, 256>;
+
+} /* namespace pheet */
+#endif /* DELTASTEPPINGSSSP_H_ */
@@ -0,0 +1,58 @@
+/*
+ * DeltaSteppingSsspPerformanceCounters.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef DELTASTEPPINGSSSPPERFORMANCECOUNTERS_H_
+#define DELTASTEPPINGSSSPPERFORMANCECOUNTERS_H_
+
+#include <pheet/primitives/PerformanceCounter/Basic/BasicPerformanceCounter.h>
+
+namespace pheet {
+
+template <class Pheet>
+class DeltaSteppingSsspPerformanceCounters {
+public:
+	typedef DeltaSteppingSsspPerformanceCounters<Pheet> Self;
+
+	DeltaSteppingSsspPerformanceCounters() {}
+	DeltaSteppingSsspPerformanceCounters(Self& other)
+	:num_dead_tasks(other.num_dead_tasks),
+	 num_actual_tasks(other.num_actual_tasks),
+	 num_buckets(other.num_buckets),
+	 num_phases(other.num_phases) {}
+	DeltaSteppingSsspPerformanceCounters(Self&& other)
+	:num_dead_tasks(other.num_dead_tasks),
+	 num_actual_tasks(other.num_actual_tasks),
+	 num_buckets(other.num_buckets),
+	 num_phases(other.num_phases) {}
+	~DeltaSteppingSsspPerformanceCounters() {}
+
+	static void print_headers() {
+		BasicPerformanceCounter<Pheet, sssp_count_dead_tasks>::print_header("num_dead_tasks\t");
+		BasicPerformanceCounter<Pheet, sssp_count_actual_tasks>::print_header("num_actual_tasks\t");
+		BasicPerformanceCounter<Pheet, sssp_count_buckets>::print_header("num_buckets\t");
+		BasicPerformanceCounter<Pheet, sssp_count_phases>::print_header("num_phases\t");
+	}
+	void print_values() {
+		num_dead_tasks.print("%d\t");
+		num_actual_tasks.print("%d\t");
+		num_buckets.print("%d\t");
+		num_phases.print("%d\t");
+	}
+
+	// Outdated bucket entries
+	BasicPerformanceCounter<Pheet, sssp_count_dead_tasks> num_dead_tasks;
+	// Bucket entries whose light edges were relaxed
+	BasicPerformanceCounter<Pheet, sssp_count_actual_tasks> num_actual_tasks;
+	// Non-empty buckets
+	BasicPerformanceCounter<Pheet, sssp_count_buckets> num_buckets;
+	// Bulk relaxations of light edges
+	BasicPerformanceCounter<Pheet, sssp_count_phases> num_phases;
+};
+
+} /* namespace pheet */
+#endif /* DELTASTEPPINGSSSPPERFORMANCECOUNTERS_H_ */
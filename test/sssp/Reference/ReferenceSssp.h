@@ -31,7 +31,7 @@ class ReferenceSssp : public Pheet::Task {
 public:
 	typedef ReferenceSsspPerformanceCounters<Pheet> PerformanceCounters;
 
-	ReferenceSssp(SsspGraphVertex* graph, size_t, PerformanceCounters& pc)
+	ReferenceSssp(SsspGraph* graph, size_t, PerformanceCounters& pc)
 	:graph(graph), pc(pc) {}
 	virtual ~ReferenceSssp() {}
 
@@ -48,7 +48,7 @@ public:
 			n = heap.pop();
 			size_t node = n.node_id;
 
-			size_t d = graph[node].distance.load(std::memory_order_relaxed);
+			size_t d = graph->distance(node).load(std::memory_order_relaxed);
 			if(d != n.distance) {
 				pc.num_dead_tasks.incr();
 				// Distance has already been improved in the meantime
@@ -56,12 +56,12 @@ public:
 				continue;
 			}
 			pc.num_actual_tasks.incr();
-			for(size_t i = 0; i < graph[node].num_edges; ++i) {
-				size_t new_d = d + graph[node].edges[i].weight;
-				size_t target = graph[node].edges[i].target;
-				size_t old_d = graph[target].distance;
+			for(size_t e = graph->edges_begin(node); e != graph->edges_end(node); ++e) {
+				size_t new_d = d + graph->weight(e);
+				size_t target = graph->target(e);
+				size_t old_d = graph->distance(target);
 				if(old_d > new_d) {
-					graph[target].distance.store(new_d, std::memory_order_relaxed);
+					graph->distance(target).store(new_d, std::memory_order_relaxed);
 					n.distance = new_d;
 					n.node_id = target;
 					heap.push(n);
@@ -78,7 +78,7 @@ public:
 
 	static char const name[];
 private:
-	SsspGraphVertex* graph;
+	SsspGraph* graph;
 	PerformanceCounters pc;
 };
 
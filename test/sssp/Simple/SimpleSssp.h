@@ -20,14 +20,14 @@ public:
 	typedef SimpleSssp<Pheet> Self;
 	typedef SimpleSsspPerformanceCounters<Pheet> PerformanceCounters;
 
-	SimpleSssp(SsspGraphVertex* graph, size_t size, PerformanceCounters& pc)
+	SimpleSssp(SsspGraph* graph, size_t size, PerformanceCounters& pc)
 	:graph(graph), node(0), distance(0), pc(pc) {}
-	SimpleSssp(SsspGraphVertex* graph, size_t node, size_t distance, PerformanceCounters& pc)
+	SimpleSssp(SsspGraph* graph, size_t node, size_t distance, PerformanceCounters& pc)
 	:graph(graph), node(node), distance(distance), pc(pc) {}
 	virtual ~SimpleSssp() {}
 
 	virtual void operator()() {
-		size_t d = graph[node].distance.load(std::memory_order_relaxed);
+		size_t d = graph->distance(node).load(std::memory_order_relaxed);
 		if(d != distance) {
 			pc.num_dead_tasks.incr();
 			// Distance has already been improved in the meantime
@@ -35,12 +35,12 @@ public:
 			return;
 		}
 		pc.num_actual_tasks.incr();
-		for(size_t i = 0; i < graph[node].num_edges; ++i) {
-			size_t new_d = d + graph[node].edges[i].weight;
-			size_t target = graph[node].edges[i].target;
-			size_t old_d = graph[target].distance.load(std::memory_order_relaxed);
+		for(size_t e = graph->edges_begin(node); e != graph->edges_end(node); ++e) {
+			size_t new_d = d + graph->weight(e);
+			size_t target = graph->target(e);
+			size_t old_d = graph->distance(target).load(std::memory_order_relaxed);
 			while(old_d > new_d) {
-				if(graph[target].distance.compare_exchange_strong(old_d, new_d, std::memory_order_relaxed)) {
+				if(graph->distance(target).compare_exchange_strong(old_d, new_d, std::memory_order_relaxed)) {
 					Pheet::template
 						spawn<Self>(graph, target, new_d, pc);
 					break;
@@ -57,7 +57,7 @@ public:
 
 	static char const name[];
 private:
-	SsspGraphVertex* graph;
+	SsspGraph* graph;
 	size_t node;
 	size_t distance;
 	PerformanceCounters pc;
@@ -10,6 +10,8 @@
 #define SSSPTEST_H_
 
 #include "sssp_graph_helpers.h"
+#include "sssp_graph_loader.h"
+#include "../graph_generators/graph_generators.h"
 
 #include <pheet/pheet.h>
 #include "../Test.h"
@@ -20,9 +22,7 @@
 #include <random>
 #include <limits>
 
-#include "SsspInitTask.h"
-
-#include <pheet/sched/Synchroneous/SynchroneousScheduler.h>
+#include <pheet/algorithms/parallel_for.h>
 
 namespace pheet {
 
@@ -30,15 +30,14 @@ template <class Pheet, template <class P> class Algorithm>
 class SsspTest : Test {
 public:
 	SsspTest(procs_t cpus, int type, size_t k, size_t size, float p, size_t max_w, unsigned int seed);
+	SsspTest(procs_t cpus, size_t k, char const* file);
 	~SsspTest();
 
 	void run_test();
 
 private:
-	SsspGraphVertex* generate_data();
-	void delete_data(SsspGraphVertex* data);
-	bool check_solution(SsspGraphVertex* data);
-	static void check_vertex(SsspGraphVertex* data, size_t i, bool& correct);
+	SsspGraph* generate_data();
+	bool check_solution(SsspGraph* graph);
 
 	procs_t cpus;
 	int type;
@@ -47,16 +46,23 @@ private:
 	float p;
 	size_t max_w;
 	unsigned int seed;
+	char const* file;
 
 	static char const* const types[];
 };
 
 template <class Pheet, template <class P> class Algorithm>
-char const* const SsspTest<Pheet, Algorithm>::types[] = {"random"};
+char const* const SsspTest<Pheet, Algorithm>::types[] = {"random", "gnp", "rmat", "grid", "geometric"};
 
 template <class Pheet, template <class P> class Algorithm>
 SsspTest<Pheet, Algorithm>::SsspTest(procs_t cpus, int type, size_t k, size_t size, float p, size_t max_w, unsigned int seed)
-: cpus(cpus), type(type), k(k), size(size), p(p), max_w(max_w), seed(seed) {
+: cpus(cpus), type(type), k(k), size(size), p(p), max_w(max_w), seed(seed), file(nullptr) {
+
+}
+
+template <class Pheet, template <class P> class Algorithm>
+SsspTest<Pheet, Algorithm>::SsspTest(procs_t cpus, size_t k, char const* file)
+: cpus(cpus), type(0), k(k), size(0), p(0), max_w(0), seed(0), file(file) {
 
 }
 
@@ -67,7 +73,8 @@ SsspTest<Pheet, Algorithm>::~SsspTest() {
 
 template <class Pheet, template <class P> class Algorithm>
 void SsspTest<Pheet, Algorithm>::run_test() {
-	SsspGraphVertex* data = generate_data();
+	SsspGraph* graph = generate_data();
+	graph->reset_distances(0);
 
 	typename Pheet::Environment::PerformanceCounters pc;
 	typename Algorithm<Pheet>::PerformanceCounters ppc;
@@ -77,13 +84,13 @@ void SsspTest<Pheet, Algorithm>::run_test() {
 		Algorithm<Pheet>::set_k(k);
 		check_time(start);
 		Pheet::template
-			finish<Algorithm<Pheet> >(data, size, ppc);
+			finish<Algorithm<Pheet> >(graph, graph->size(), ppc);
 		check_time(end);
 	}
 
-	bool correct = check_solution(data);
+	bool correct = check_solution(graph);
 	double seconds = calculate_seconds(start, end);
-	std::cout << "test\talgorithm\tscheduler\ttype\tsize\tp\tmax_w\tk\tseed\tcpus\ttotal_time\tcorrect\t";
+	std::cout << "test\talgorithm\tscheduler\ttype\tsize\tedges\tp\tmax_w\tk\tseed\tcpus\ttotal_time\tcorrect\t";
 //	Algorithm<Pheet>::print_headers();
 	Algorithm<Pheet>::PerformanceCounters::print_headers();
 	Pheet::Environment::PerformanceCounters::print_headers();
@@ -92,81 +99,78 @@ void SsspTest<Pheet, Algorithm>::run_test() {
 	Algorithm<Pheet>::print_name();
 	std::cout << "\t";
 	Pheet::Environment::print_name();
-	std::cout << "\t" << types[type] << "\t" << size << "\t" << p << "\t" << max_w << "\t" << k << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << correct << "\t";
+	std::cout << "\t" << ((file != nullptr)?file:types[type]) << "\t" << graph->size() << "\t" << graph->get_num_edges() << "\t" << p << "\t" << max_w << "\t" << k << "\t" << seed << "\t" << cpus << "\t" << seconds << "\t" << correct << "\t";
 //	Algorithm<Pheet>::print_configuration();
 	ppc.print_values();
 	pc.print_values();
 	std::cout << std::endl;
 
-	delete_data(data);
+	delete graph;
 }
 
 template <class Pheet, template <class P> class Algorithm>
-SsspGraphVertex* SsspTest<Pheet, Algorithm>::generate_data() {
-	SsspGraphVertex* data = new SsspGraphVertex[size];
+SsspGraph* SsspTest<Pheet, Algorithm>::generate_data() {
+	if(file != nullptr) {
+		return sssp_load_graph<SsspGraph>(file);
+	}
+	if(type != 0) {
+		GeneratedGraph g;
+		{pheet::Pheet::Environment env;
+			generate_graph<pheet::Pheet>(type, size, p, max_w, seed, g);
+		}
+		// Generated edges are undirected
+		size_t m = g.num_edges();
+		g.sources.resize(2 * m);
+		g.targets.resize(2 * m);
+		g.weights.resize(2 * m);
+		std::copy(g.targets.begin(), g.targets.begin() + m, g.sources.begin() + m);
+		std::copy(g.sources.begin(), g.sources.begin() + m, g.targets.begin() + m);
+		std::copy(g.weights.begin(), g.weights.begin() + m, g.weights.begin() + m);
+		return sssp_build_graph<SsspGraph>(size, g.sources, g.targets, g.weights);
+	}
 
 	std::mt19937 rng;
 	rng.seed(seed);
     std::uniform_real_distribution<float> rnd_f(0.0, 1.0);
     std::uniform_int_distribution<size_t> rnd_st(1, max_w);
 
-	std::vector<SsspGraphEdge>* edges = new std::vector<SsspGraphEdge>[size];
+	std::vector<uint32_t> sources, targets, weights;
 	for(size_t i = 0; i < size; ++i) {
 		for(size_t j = i + 1; j < size; ++j) {
 			if(rnd_f(rng) < p) {
-				SsspGraphEdge e;
-				e.target = j;
-				e.weight = rnd_st(rng);
-				edges[i].push_back(e);
-				e.target = i;
-				edges[j].push_back(e);
+				uint32_t w = rnd_st(rng);
+				sources.push_back(i);
+				targets.push_back(j);
+				weights.push_back(w);
+				sources.push_back(j);
+				targets.push_back(i);
+				weights.push_back(w);
 			}
 		}
 	}
-	{typedef typename Pheet::template WithScheduler<SynchroneousScheduler> SPheet;
-		typedef typename SPheet::Environment SEnv;
-		// For some reason the default constructor is not called with GCC, that's why we specify the number of CPUs
-		SEnv env(1);
-
-		SPheet::template
-			finish<SsspInitTask<SPheet> >(data, edges, 0, size - 1);
-	}
-	data[0].distance = 0;
-	delete[] edges;
-
-	return data;
+	return sssp_build_graph<SsspGraph>(size, sources, targets, weights);
 }
 
 template <class Pheet, template <class P> class Algorithm>
-void SsspTest<Pheet, Algorithm>::delete_data(SsspGraphVertex* data) {
-	for(size_t i = 0; i < size; ++i) {
-		if(data[i].edges != NULL) {
-			delete[] data[i].edges;
-		}
-	}
-	delete[] data;
-}
-
-template <class Pheet, template <class P> class Algorithm>
-bool SsspTest<Pheet, Algorithm>::check_solution(SsspGraphVertex* data) {
-	bool correct = true;
-	{pheet::Pheet::Environment p;
-		for(size_t i = 0; i < size; ++i) {
-			pheet::Pheet::spawn(SsspTest<Pheet, Algorithm>::check_vertex, data, i, correct);
-		}
+bool SsspTest<Pheet, Algorithm>::check_solution(SsspGraph* graph) {
+	std::atomic<bool> correct(true);
+	{pheet::Pheet::Environment env;
+		parallel_for<pheet::Pheet>(static_cast<size_t>(0), graph->size(),
+			[&](size_t v) {
+				size_t d = graph->distance(v).load(std::memory_order_relaxed);
+				if(d == std::numeric_limits<size_t>::max()) {
+					return;
+				}
+				for(size_t e = graph->edges_begin(v); e != graph->edges_end(v); ++e) {
+					if(graph->distance(graph->target(e)).load(std::memory_order_relaxed) > d + graph->weight(e)) {
+						correct.store(false, std::memory_order_relaxed);
+						return;
+					}
+				}
+			});
 	}
 
-	return correct;
-}
-
-template <class Pheet, template <class P> class Algorithm>
-void SsspTest<Pheet, Algorithm>::check_vertex(SsspGraphVertex* data, size_t i, bool& correct) {
-	for(size_t j = 0; j < data[i].num_edges; ++j) {
-		if(data[data[i].edges[j].target].distance > data[i].distance + data[i].edges[j].weight) {
-			correct = false;
-			return;
-		}
-	}
+	return correct.load();
 }
 
 } /* namespace pheet */
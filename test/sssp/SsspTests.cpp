@@ -15,12 +15,14 @@
 #include "Adaptive/AdaptiveSssp.h"
 #include "Reference/ReferenceSssp.h"
 #include "Analysis/SsspAnalysis.h"
+#include "DeltaStepping/DeltaSteppingSssp.h"
 
 #include <pheet/sched/Basic/BasicScheduler.h>
 #include <pheet/sched/Strategy/StrategyScheduler.h>
 #include <pheet/sched/Strategy2/StrategyScheduler2.h>
 #include <pheet/sched/BStrategy/BStrategyScheduler.h>
 #include <pheet/sched/Synchroneous/SynchroneousScheduler.h>
+#include <pheet/memory/Arena/HugePageMemoryArena.h>
 #include <pheet/ds/StrategyTaskStorage/CentralK/CentralKStrategyTaskStorage.h>
 #include <pheet/ds/StrategyTaskStorage/CentralK11/CentralKStrategyTaskStorage.h>
 #include <pheet/ds/StrategyTaskStorage/DistK/DistKStrategyTaskStorage.h>
@@ -48,12 +50,22 @@ void SsspTests::run_test() {
 
 	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>,
 							Strategy2Sssp>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>::WithMemoryArena<HugePageMemoryArena>,
+							Strategy2Sssp>();
 //	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>,
 //							Strategy2SsspDelayedK>();
 	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>,
 							Strategy2SsspNoK>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>,
+							Strategy2SsspReprioritize>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>,
+							Strategy2SsspNoKReprioritize>();
 	this->run_algorithm<	Pheet::WithScheduler<SynchroneousScheduler>,
 							ReferenceSssp>();
+	this->run_algorithm<	Pheet::WithScheduler<StrategyScheduler2>,
+							DeltaSteppingSssp>();
+	this->run_algorithm<	Pheet::WithScheduler<BasicScheduler>,
+							DeltaSteppingSssp>();
 //	this->run_algorithm<	Pheet::WithScheduler<BStrategyScheduler>::WithTaskStorage<DistKStrategyTaskStorage>,
 //							AdaptiveSssp>();
 	this->run_algorithm<	Pheet::WithScheduler<BStrategyScheduler>::WithTaskStorage<DistKStrategyTaskStorage>,
@@ -67,6 +67,28 @@ void SsspTests::run_algorithm() {
 			}
 		}
 	}
+#ifdef SSSP_TEST_FILES
+	for(size_t f = 0; f < sizeof(sssp_test_files)/sizeof(sssp_test_files[0]); f++) {
+		for(size_t k = 0; k < sizeof(sssp_test_k)/sizeof(sssp_test_k[0]); k++) {
+			bool max_processed = false;
+			procs_t cpus;
+			for(size_t c = 0; c < sizeof(sssp_test_cpus)/sizeof(sssp_test_cpus[0]); c++) {
+				cpus = sssp_test_cpus[c];
+				if(cpus >= max_cpus) {
+					if(!max_processed) {
+						cpus = max_cpus;
+						max_processed = true;
+					}
+					else {
+						continue;
+					}
+				}
+				SsspTest<Pheet, Partitioner> gbt(cpus, sssp_test_k[k], sssp_test_files[f]);
+				gbt.run_test();
+			}
+		}
+	}
+#endif
 #endif
 }
 
@@ -15,29 +15,84 @@
 #include <pheet/ds/StrategyTaskStorage/KLSMLocality/KLSMLocalityTaskStorage.h>
 #include <pheet/ds/StrategyTaskStorage/LSMLocality/LSMLocalityTaskStorage.h>
 
+#include <atomic>
+#include <vector>
+
 namespace pheet {
 
-template <class Pheet, template <class, class> class TaskStorageT>
+/*
+ * Handle of the last task spawned for a vertex. Written by whichever place improved the
+ * distance last, so the two parts may not match. This is detected by reprioritize, which
+ * only replaces tasks for the same vertex that are still queued at the calling place.
+ */
+template <class Item>
+struct Strategy2SsspTaskSlot {
+	Strategy2SsspTaskSlot()
+	: item(nullptr), version(0) {}
+
+	std::atomic<Item*> item;
+	std::atomic<size_t> version;
+};
+
+/*
+ * With Reprioritize set, improving the distance of a vertex replaces its queued task (if
+ * the task is still queued locally), instead of spawning a new task and leaving the old one
+ * to be filtered out as a dead task.
+ */
+template <class Pheet, template <class, class> class TaskStorageT, bool Reprioritize>
 class Strategy2SsspImpl : public Pheet::Task {
 public:
-	typedef Strategy2SsspImpl<Pheet, TaskStorageT> Self;
+	typedef Strategy2SsspImpl<Pheet, TaskStorageT, Reprioritize> Self;
 	typedef Strategy2SsspStrategy<Pheet, TaskStorageT> Strategy;
 	typedef typename Strategy::TaskStorage TaskStorage;
+	typedef typename Strategy::TaskHandle TaskHandle;
+	typedef Strategy2SsspTaskSlot<typename TaskHandle::Item> TaskSlot;
 	typedef Strategy2SsspPerformanceCounters<Pheet> PerformanceCounters;
 
-	Strategy2SsspImpl(SsspGraphVertex* graph, size_t size, PerformanceCounters& pc)
-	:graph(graph), node(0), distance(0), pc(pc) {
+	Strategy2SsspImpl(SsspGraph* graph, size_t size, PerformanceCounters& pc)
+	:graph(graph), slots(nullptr), node(0), distance(0), pc(pc) {
 		pc.last_non_dead_time.start_timer();
 		pc.last_task_time.start_timer();
 		pc.last_update_time.start_timer();
 	}
-	Strategy2SsspImpl(SsspGraphVertex* graph, size_t node, size_t distance, PerformanceCounters& pc)
-	:graph(graph), node(node), distance(distance), pc(pc) {}
+	Strategy2SsspImpl(SsspGraph* graph, size_t node, size_t distance, PerformanceCounters& pc)
+	:graph(graph), slots(nullptr), node(node), distance(distance), pc(pc) {}
+	Strategy2SsspImpl(SsspGraph* graph, TaskSlot* slots, size_t node, size_t distance, PerformanceCounters& pc)
+	:graph(graph), slots(slots), node(node), distance(distance), pc(pc) {}
 	virtual ~Strategy2SsspImpl() {}
 
 	virtual void operator()() {
+		if(Reprioritize && slots == nullptr) {
+			// Root task. Slots need to stay alive until all tasks are finished
+			std::vector<TaskSlot> root_slots(graph->size());
+			slots = root_slots.data();
+			{typename Pheet::Finish f;
+				relax();
+			}
+			slots = nullptr;
+			return;
+		}
+		relax();
+	}
+
+	static void set_k(size_t k) {
+		Strategy::default_k = k;
+	}
+
+	static void print_name() {
+		std::cout << name << "<";
+		TaskStorage::print_name();
+		if(Reprioritize) {
+			std::cout << ", Reprioritize";
+		}
+		std::cout << ">";
+	}
+
+	static char const name[];
+private:
+	void relax() {
 		pc.last_task_time.take_time();
-		size_t d = graph[node].distance.load(std::memory_order_relaxed);
+		size_t d = graph->distance(node).load(std::memory_order_relaxed);
 		if(d != distance) {
 			pc.num_dead_tasks.incr();
 			// Distance has already been improved in the meantime
@@ -46,50 +101,57 @@ public:
 		}
 		pc.num_actual_tasks.incr();
 		pc.last_non_dead_time.take_time();
-		for(size_t i = 0; i < graph[node].num_edges; ++i) {
-			size_t new_d = d + graph[node].edges[i].weight;
-			size_t target = graph[node].edges[i].target;
-			size_t old_d = graph[target].distance.load(std::memory_order_relaxed);
+		for(size_t e = graph->edges_begin(node); e != graph->edges_end(node); ++e) {
+			size_t new_d = d + graph->weight(e);
+			size_t target = graph->target(e);
+			size_t old_d = graph->distance(target).load(std::memory_order_relaxed);
 			while(old_d > new_d) {
-				if(graph[target].distance.compare_exchange_strong(old_d, new_d, std::memory_order_relaxed)) {
+				if(graph->distance(target).compare_exchange_strong(old_d, new_d, std::memory_order_relaxed)) {
 					pc.last_update_time.take_time();
 
-					Pheet::template
-						spawn_s<Self>(
-								Strategy(new_d, graph[target].distance),
-								graph, target, new_d, pc);
+					if(Reprioritize) {
+						TaskSlot& slot = slots[target];
+						TaskHandle h(slot.item.load(std::memory_order_relaxed), slot.version.load(std::memory_order_relaxed));
+						Pheet::template
+							reprioritize<Self>(h,
+									Strategy(new_d, graph->distance(target)),
+									graph, slots, target, new_d, pc);
+						slot.item.store(h.item, std::memory_order_relaxed);
+						slot.version.store(h.version, std::memory_order_relaxed);
+					}
+					else {
+						Pheet::template
+							spawn_s<Self>(
+									Strategy(new_d, graph->distance(target)),
+									graph, target, new_d, pc);
+					}
 					break;
 				}
 			}
 		}
 	}
 
-	static void set_k(size_t k) {
-		Strategy::default_k = k;
-	}
-
-	static void print_name() {
-		std::cout << name << "<";
-		TaskStorage::print_name();
-		std::cout << ">";
-	}
-
-	static char const name[];
-private:
-	SsspGraphVertex* graph;
+	SsspGraph* graph;
+	TaskSlot* slots;
 	size_t node;
 	size_t distance;
 	PerformanceCounters pc;
 };
 
-template <class Pheet, template <class, class> class TaskStorageT>
-char const Strategy2SsspImpl<Pheet, TaskStorageT>::name[] = "Strategy2 Sssp";
+template <class Pheet, template <class, class> class TaskStorageT, bool Reprioritize>
+char const Strategy2SsspImpl<Pheet, TaskStorageT, Reprioritize>::name[] = "Strategy2 Sssp";
+
+template <class Pheet>
+using Strategy2Sssp = Strategy2SsspImpl<Pheet, KLSMLocalityTaskStorage, false>;
+
+template <class Pheet>
+using Strategy2SsspNoK = Strategy2SsspImpl<Pheet, LSMLocalityTaskStorage, false>;
 
 template <class Pheet>
-using Strategy2Sssp = Strategy2SsspImpl<Pheet, KLSMLocalityTaskStorage >;
+using Strategy2SsspReprioritize = Strategy2SsspImpl<Pheet, KLSMLocalityTaskStorage, true>;
 
 template <class Pheet>
-using Strategy2SsspNoK = Strategy2SsspImpl<Pheet, LSMLocalityTaskStorage >;
+using Strategy2SsspNoKReprioritize = Strategy2SsspImpl<Pheet, LSMLocalityTaskStorage, true>;
 
 
 } /* namespace pheet */
@@ -61,6 +61,13 @@ public:
 		return stored_distance->load(std::memory_order_relaxed) < distance;
 	}
 
+	/*
+	 * Only replace tasks for the same node
+	 */
+	bool can_reprioritize(Self& queued) {
+		return stored_distance == queued.stored_distance;
+	}
+
 	/*
 	 * Checks whether spawn can be converted to a function call
 	 */
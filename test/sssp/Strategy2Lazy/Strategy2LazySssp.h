@@ -22,21 +22,21 @@ public:
 	typedef Strategy2LazySsspStrategy<Pheet> Strategy;
 	typedef Strategy2LazySsspPerformanceCounters<Pheet> PerformanceCounters;
 
-	Strategy2LazySssp(SsspGraphVertex* graph, size_t size, PerformanceCounters& pc)
+	Strategy2LazySssp(SsspGraph* graph, size_t size, PerformanceCounters& pc)
 	:graph(graph), node(0), distance(0), pc(pc) {
 		pc.last_non_dead_time.start_timer();
 		pc.last_task_time.start_timer();
 		pc.last_update_time.start_timer();
 	}
-	Strategy2LazySssp(SsspGraphVertex* graph, size_t node, size_t distance, PerformanceCounters& pc)
+	Strategy2LazySssp(SsspGraph* graph, size_t node, size_t distance, PerformanceCounters& pc)
 	:graph(graph), node(node), distance(distance), pc(pc) {}
 	virtual ~Strategy2LazySssp() {}
 
 	virtual void operator()() {
 		pc.last_task_time.take_time();
 		auto& dist = Pheet::template place_singleton<Strategy2LazySsspLocalDistances<Pheet>>();
-		size_t d = graph[node].distance.load(std::memory_order_relaxed);
-		if(node != 0 && (d <= distance || !graph[node].distance.compare_exchange_strong(d, distance, std::memory_order_relaxed))) {
+		size_t d = graph->distance(node).load(std::memory_order_relaxed);
+		if(node != 0 && (d <= distance || !graph->distance(node).compare_exchange_strong(d, distance, std::memory_order_relaxed))) {
 			dist[node] = d;
 			pc.num_dead_tasks.incr();
 			// Distance has already been improved in the meantime
@@ -49,19 +49,19 @@ public:
 		pc.num_actual_tasks.incr();
 		pc.last_non_dead_time.take_time();
 
-		for(size_t i = 0; i < graph[node].num_edges; ++i) {
-			size_t new_d = d + graph[node].edges[i].weight;
-			size_t target = graph[node].edges[i].target;
+		for(size_t e = graph->edges_begin(node); e != graph->edges_end(node); ++e) {
+			size_t new_d = d + graph->weight(e);
+			size_t target = graph->target(e);
 
 			size_t& local_d = dist[target];
 			if(local_d > new_d) {
 				local_d = new_d;
 
-				size_t old_d = graph[target].distance.load(std::memory_order_relaxed);
+				size_t old_d = graph->distance(target).load(std::memory_order_relaxed);
 				if(old_d > new_d) {
 					Pheet::template
 						spawn_s<Self>(
-							Strategy(new_d, graph[target].distance),
+							Strategy(new_d, graph->distance(target)),
 							graph, target, new_d, pc);
 				}
 				else {
@@ -83,7 +83,7 @@ public:
 
 	static char const name[];
 private:
-	SsspGraphVertex* graph;
+	SsspGraph* graph;
 	size_t node;
 	size_t distance;
 	PerformanceCounters pc;
@@ -9,20 +9,245 @@
 #ifndef SSSP_GRAPH_HELPERS_H_
 #define SSSP_GRAPH_HELPERS_H_
 
+#include <pheet/settings.h>
+
+#include <sys/mman.h>
+
+#include <algorithm>
 #include <atomic>
+#include <limits>
+#include <stdint.h>
+#include <vector>
 
 namespace pheet {
+
 struct SsspGraphEdge {
-	size_t target;
-	size_t weight;
+	uint32_t target;
+	uint32_t weight;
 };
 
-struct SsspGraphVertex {
+/*
+ * Edges stored as an array of (target, weight) pairs. Both are needed for each relaxation,
+ * so this needs a single cache line per 8 edges.
+ */
+struct SsspGraphAoSEdges {
 	SsspGraphEdge* edges;
+
+	SsspGraphAoSEdges()
+	: edges(nullptr) {}
+
+	void allocate(size_t num_edges) {
+		edges = new SsspGraphEdge[num_edges];
+	}
+
+	void free() {
+		delete[] edges;
+	}
+
+	uint32_t target(size_t e) const {
+		return edges[e].target;
+	}
+
+	uint32_t weight(size_t e) const {
+		return edges[e].weight;
+	}
+
+	void set(size_t e, uint32_t target, uint32_t weight) {
+		edges[e].target = target;
+		edges[e].weight = weight;
+	}
+};
+
+/*
+ * Edges stored as separate target and weight arrays. This is the layout of binary graph
+ * files, so graphs in this layout can be used directly from a file mapping.
+ */
+struct SsspGraphSoAEdges {
+	uint32_t* targets;
+	uint32_t* weights;
+
+	SsspGraphSoAEdges()
+	: targets(nullptr), weights(nullptr) {}
+
+	void allocate(size_t num_edges) {
+		targets = new uint32_t[num_edges];
+		weights = new uint32_t[num_edges];
+	}
+
+	void free() {
+		delete[] targets;
+		delete[] weights;
+	}
+
+	uint32_t target(size_t e) const {
+		return targets[e];
+	}
+
+	uint32_t weight(size_t e) const {
+		return weights[e];
+	}
+
+	void set(size_t e, uint32_t target, uint32_t weight) {
+		targets[e] = target;
+		weights[e] = weight;
+	}
+};
+
+/*
+ * Directed graph in compressed sparse row format. The edges of vertex v are the edges in
+ * [edges_begin(v), edges_end(v)). Tentative distances are kept in a separate array, so
+ * the graph itself stays read-only during the search.
+ *
+ * Either owns its arrays, or uses the arrays inside a file mapping (see sssp_graph_loader.h),
+ * which is unmapped on destruction.
+ */
+template <class Edges>
+class SsspGraphImpl {
+public:
+	typedef SsspGraphImpl<Edges> Self;
+	typedef Edges EdgeStorage;
+
+	SsspGraphImpl(size_t num_vertices, size_t num_edges)
+	: num_vertices(num_vertices), num_edges(num_edges),
+	  offsets(new uint64_t[num_vertices + 1]),
+	  distances(new std::atomic<size_t>[num_vertices]),
+	  mapping(nullptr), mapping_length(0) {
+		edges.allocate(num_edges);
+		offsets[0] = 0;
+	}
+
+	/*
+	 * Takes ownership of a file mapping containing the offsets and edges
+	 */
+	SsspGraphImpl(size_t num_vertices, size_t num_edges, uint64_t* offsets, Edges const& edges, void* mapping, size_t mapping_length)
+	: num_vertices(num_vertices), num_edges(num_edges),
+	  offsets(offsets), edges(edges),
+	  distances(new std::atomic<size_t>[num_vertices]),
+	  mapping(mapping), mapping_length(mapping_length) {}
+
+	SsspGraphImpl(Self const&) = delete;
+	Self& operator=(Self const&) = delete;
+
+	~SsspGraphImpl() {
+		if(mapping != nullptr) {
+			munmap(mapping, mapping_length);
+		}
+		else {
+			delete[] offsets;
+			edges.free();
+		}
+		delete[] distances;
+	}
+
+	size_t size() const {
+		return num_vertices;
+	}
+
+	size_t get_num_edges() const {
+		return num_edges;
+	}
+
+	size_t edges_begin(size_t v) const {
+		return offsets[v];
+	}
+
+	size_t edges_end(size_t v) const {
+		return offsets[v + 1];
+	}
+
+	size_t degree(size_t v) const {
+		return offsets[v + 1] - offsets[v];
+	}
+
+	uint32_t target(size_t e) const {
+		return edges.target(e);
+	}
+
+	uint32_t weight(size_t e) const {
+		return edges.weight(e);
+	}
+
+	std::atomic<size_t>& distance(size_t v) {
+		return distances[v];
+	}
+
+	/*
+	 * Only for graphs owning their arrays. offsets[v + 1] needs to be set to the end of the
+	 * edges of vertex v.
+	 */
+	uint64_t* get_offsets() {
+		pheet_assert(mapping == nullptr);
+		return offsets;
+	}
+
+	void set_edge(size_t e, uint32_t target, uint32_t weight) {
+		pheet_assert(mapping == nullptr);
+		edges.set(e, target, weight);
+	}
+
+	/*
+	 * Sets all distances to infinity, except for the source
+	 */
+	void reset_distances(size_t source) {
+		for(size_t i = 0; i < num_vertices; ++i) {
+			distances[i].store(std::numeric_limits<size_t>::max(), std::memory_order_relaxed);
+		}
+		distances[source].store(0, std::memory_order_relaxed);
+	}
+
+private:
+	size_t num_vertices;
 	size_t num_edges;
-	std::atomic<size_t> distance;
+	uint64_t* offsets;
+	Edges edges;
+	std::atomic<size_t>* distances;
+
+	void* mapping;
+	size_t mapping_length;
 };
 
+/*
+ * Builds a graph from an edge list. Edges are sorted by target with a counting sort first,
+ * so the stable counting sort by source leaves the edges of each vertex sorted by target
+ * (SsspAnalysis relies on this for binary search).
+ */
+template <class Graph>
+Graph* sssp_build_graph(size_t num_vertices, std::vector<uint32_t> const& sources, std::vector<uint32_t> const& targets, std::vector<uint32_t> const& weights) {
+	size_t num_edges = sources.size();
+	std::vector<uint64_t> by_target(num_vertices + 1, 0);
+	for(size_t e = 0; e < num_edges; ++e) {
+		++by_target[targets[e] + 1];
+	}
+	for(size_t i = 0; i < num_vertices; ++i) {
+		by_target[i + 1] += by_target[i];
+	}
+	std::vector<size_t> order(num_edges);
+	for(size_t e = 0; e < num_edges; ++e) {
+		order[by_target[targets[e]]++] = e;
+	}
+
+	Graph* graph = new Graph(num_vertices, num_edges);
+	uint64_t* offsets = graph->get_offsets();
+	std::fill(offsets, offsets + num_vertices + 1, 0);
+	for(size_t e = 0; e < num_edges; ++e) {
+		++offsets[sources[e] + 1];
+	}
+	for(size_t i = 0; i < num_vertices; ++i) {
+		offsets[i + 1] += offsets[i];
+	}
+	std::vector<uint64_t> pos(offsets, offsets + num_vertices);
+	for(size_t e : order) {
+		graph->set_edge(pos[sources[e]]++, targets[e], weights[e]);
+	}
+	return graph;
+}
+
+#ifdef SSSP_GRAPH_SOA
+typedef SsspGraphImpl<SsspGraphSoAEdges> SsspGraph;
+#else
+typedef SsspGraphImpl<SsspGraphAoSEdges> SsspGraph;
+#endif
+
 }
 
 
@@ -0,0 +1,289 @@
+/*
+ * sssp_graph_loader.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef SSSP_GRAPH_LOADER_H_
+#define SSSP_GRAPH_LOADER_H_
+
+#include "sssp_graph_helpers.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace pheet {
+
+/*
+ * Binary CSR graph file: header, followed by uint64_t offsets[num_vertices + 1],
+ * uint32_t targets[num_edges] and uint32_t weights[num_edges] (native byte order).
+ */
+struct SsspBinaryGraphHeader {
+	char magic[8];
+	uint64_t num_vertices;
+	uint64_t num_edges;
+	uint64_t reserved;
+};
+
+char const sssp_binary_graph_magic[8] = {'P', 'H', 'E', 'E', 'T', 'C', 'S', 'R'};
+
+/*
+ * Read-only mapping of a whole file. Pages are populated when the file is mapped, so page
+ * faults are not part of the measured time.
+ */
+class SsspGraphFile {
+public:
+	SsspGraphFile(char const* path)
+	: data(nullptr), length(0) {
+		int fd = open(path, O_RDONLY);
+		if(fd < 0) {
+			std::cerr << "Cannot open graph file " << path << std::endl;
+			throw std::runtime_error("cannot open graph file");
+		}
+		struct stat st;
+		if(fstat(fd, &st) != 0 || st.st_size == 0) {
+			close(fd);
+			std::cerr << "Cannot read graph file " << path << std::endl;
+			throw std::runtime_error("cannot read graph file");
+		}
+		length = st.st_size;
+		int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+		flags |= MAP_POPULATE;
+#endif
+		void* m = mmap(nullptr, length, PROT_READ, flags, fd, 0);
+		close(fd);
+		if(m == MAP_FAILED) {
+			std::cerr << "Cannot map graph file " << path << std::endl;
+			throw std::runtime_error("cannot map graph file");
+		}
+		data = static_cast<char*>(m);
+		madvise(data, length, MADV_SEQUENTIAL);
+	}
+
+	~SsspGraphFile() {
+		if(data != nullptr) {
+			munmap(data, length);
+		}
+	}
+
+	char const* get_data() const {
+		return data;
+	}
+
+	size_t get_length() const {
+		return length;
+	}
+
+	/*
+	 * The caller becomes responsible for unmapping
+	 */
+	void* release() {
+		void* ret = data;
+		data = nullptr;
+		return ret;
+	}
+
+private:
+	char* data;
+	size_t length;
+};
+
+/*
+ * Generic case: copies the edges into the layout of the graph
+ */
+template <class Edges>
+SsspGraphImpl<Edges>* sssp_graph_from_binary(SsspGraphFile&, size_t n, size_t m, uint64_t const* offsets, uint32_t const* targets, uint32_t const* weights, Edges*) {
+	SsspGraphImpl<Edges>* graph = new SsspGraphImpl<Edges>(n, m);
+	memcpy(graph->get_offsets(), offsets, (n + 1) * sizeof(uint64_t));
+	for(size_t e = 0; e < m; ++e) {
+		graph->set_edge(e, targets[e], weights[e]);
+	}
+	return graph;
+}
+
+/*
+ * Same layout as the file, so the graph is used directly from the mapping
+ */
+inline SsspGraphImpl<SsspGraphSoAEdges>* sssp_graph_from_binary(SsspGraphFile& file, size_t n, size_t m, uint64_t const* offsets, uint32_t const* targets, uint32_t const* weights, SsspGraphSoAEdges*) {
+	SsspGraphSoAEdges edges;
+	edges.targets = const_cast<uint32_t*>(targets);
+	edges.weights = const_cast<uint32_t*>(weights);
+	size_t length = file.get_length();
+	return new SsspGraphImpl<SsspGraphSoAEdges>(n, m, const_cast<uint64_t*>(offsets), edges, file.release(), length);
+}
+
+template <class Graph>
+Graph* sssp_load_binary_graph(SsspGraphFile& file) {
+	char const* data = file.get_data();
+	SsspBinaryGraphHeader header;
+	if(file.get_length() < sizeof(header)) {
+		throw std::runtime_error("graph file too short");
+	}
+	memcpy(&header, data, sizeof(header));
+	if(memcmp(header.magic, sssp_binary_graph_magic, sizeof(header.magic)) != 0) {
+		throw std::runtime_error("not a binary graph file");
+	}
+	size_t n = header.num_vertices;
+	size_t m = header.num_edges;
+	// Bounds the counts, so the size computation below cannot overflow
+	if(n >= file.get_length() / sizeof(uint64_t) || m > file.get_length() / sizeof(uint32_t)) {
+		throw std::runtime_error("binary graph file has the wrong size");
+	}
+	if(file.get_length() != sizeof(header) + (n + 1) * sizeof(uint64_t) + 2 * m * sizeof(uint32_t)) {
+		throw std::runtime_error("binary graph file has the wrong size");
+	}
+	uint64_t const* offsets = reinterpret_cast<uint64_t const*>(data + sizeof(header));
+	uint32_t const* targets = reinterpret_cast<uint32_t const*>(offsets + n + 1);
+	uint32_t const* weights = targets + m;
+	// The searches index arrays with these without further checks
+	if(offsets[0] != 0 || offsets[n] != m) {
+		throw std::runtime_error("binary graph file has invalid edge offsets");
+	}
+	for(size_t v = 0; v < n; ++v) {
+		if(offsets[v] > offsets[v + 1]) {
+			throw std::runtime_error("binary graph file has decreasing edge offsets");
+		}
+	}
+	for(size_t e = 0; e < m; ++e) {
+		if(targets[e] >= n) {
+			throw std::runtime_error("binary graph file has an edge to a non-existing vertex");
+		}
+	}
+	return sssp_graph_from_binary(file, n, m, offsets, targets, weights, static_cast<typename Graph::EdgeStorage*>(nullptr));
+}
+
+/*
+ * Parses an unsigned decimal number, skipping leading blanks
+ */
+inline uint64_t sssp_parse_uint(char const*& p, char const* end) {
+	while(p != end && (*p == ' ' || *p == '\t')) {
+		++p;
+	}
+	uint64_t ret = 0;
+	while(p != end && *p >= '0' && *p <= '9') {
+		ret = ret * 10 + (*p - '0');
+		++p;
+	}
+	return ret;
+}
+
+/*
+ * DIMACS shortest path format (as used by the 9th DIMACS challenge road networks):
+ * "c" comment lines, one "p sp <n> <m>" line, and m "a <u> <v> <w>" lines with 1-based
+ * vertex ids. Arcs are directed, road networks contain both directions of each road.
+ */
+template <class Graph>
+Graph* sssp_load_dimacs_graph(SsspGraphFile& file) {
+	char const* p = file.get_data();
+	char const* end = p + file.get_length();
+
+	size_t n = 0;
+	size_t m = 0;
+	size_t read = 0;
+	std::vector<uint32_t> sources, targets, weights;
+	while(p != end) {
+		if(*p == 'p') {
+			p = static_cast<char const*>(memchr(p, ' ', end - p));
+			if(p == nullptr || end - p < 3 || strncmp(p, " sp", 3) != 0) {
+				throw std::runtime_error("unsupported DIMACS problem line");
+			}
+			p += 3;
+			n = sssp_parse_uint(p, end);
+			m = sssp_parse_uint(p, end);
+			if(n > std::numeric_limits<uint32_t>::max()) {
+				throw std::runtime_error("too many vertices for 32 bit vertex ids");
+			}
+			sources.resize(m);
+			targets.resize(m);
+			weights.resize(m);
+		}
+		else if(*p == 'a') {
+			++p;
+			if(read == m) {
+				throw std::runtime_error("more arcs than given in the DIMACS problem line");
+			}
+			uint64_t u = sssp_parse_uint(p, end);
+			uint64_t v = sssp_parse_uint(p, end);
+			uint64_t w = sssp_parse_uint(p, end);
+			if(u == 0 || u > n || v == 0 || v > n || w > std::numeric_limits<uint32_t>::max()) {
+				throw std::runtime_error("invalid DIMACS arc");
+			}
+			sources[read] = u - 1;
+			targets[read] = v - 1;
+			weights[read] = w;
+			++read;
+		}
+		p = static_cast<char const*>(memchr(p, '\n', end - p));
+		if(p == nullptr) {
+			break;
+		}
+		++p;
+	}
+	if(read != m) {
+		throw std::runtime_error("fewer arcs than given in the DIMACS problem line");
+	}
+
+	return sssp_build_graph<Graph>(n, sources, targets, weights);
+}
+
+/*
+ * Loads a binary CSR graph, or a DIMACS graph if the file does not start with the magic
+ * of binary graphs. Parsing large DIMACS files takes a while, so these should be converted
+ * to binary files with sssp_write_binary_graph.
+ */
+template <class Graph>
+Graph* sssp_load_graph(char const* path) {
+	SsspGraphFile file(path);
+	if(file.get_length() >= sizeof(sssp_binary_graph_magic) &&
+			memcmp(file.get_data(), sssp_binary_graph_magic, sizeof(sssp_binary_graph_magic)) == 0) {
+		return sssp_load_binary_graph<Graph>(file);
+	}
+	return sssp_load_dimacs_graph<Graph>(file);
+}
+
+template <class Graph>
+void sssp_write_binary_graph(Graph& graph, char const* path) {
+	FILE* f = fopen(path, "wb");
+	if(f == nullptr) {
+		std::cerr << "Cannot create graph file " << path << std::endl;
+		throw std::runtime_error("cannot create graph file");
+	}
+	SsspBinaryGraphHeader header;
+	memcpy(header.magic, sssp_binary_graph_magic, sizeof(header.magic));
+	header.num_vertices = graph.size();
+	header.num_edges = graph.get_num_edges();
+	header.reserved = 0;
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+	for(size_t v = 0; v <= graph.size() && ok; ++v) {
+		uint64_t o = (v == graph.size())?graph.get_num_edges():graph.edges_begin(v);
+		ok = fwrite(&o, sizeof(o), 1, f) == 1;
+	}
+	for(size_t e = 0; e < graph.get_num_edges() && ok; ++e) {
+		uint32_t t = graph.target(e);
+		ok = fwrite(&t, sizeof(t), 1, f) == 1;
+	}
+	for(size_t e = 0; e < graph.get_num_edges() && ok; ++e) {
+		uint32_t w = graph.weight(e);
+		ok = fwrite(&w, sizeof(w), 1, f) == 1;
+	}
+	if(fclose(f) != 0 || !ok) {
+		std::cerr << "Cannot write graph file " << path << std::endl;
+		throw std::runtime_error("cannot write graph file");
+	}
+}
+
+}
+
+#endif /* SSSP_GRAPH_LOADER_H_ */
@@ -0,0 +1,51 @@
+/*
+ * StealingDequeBench.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+
+#include "../init.h"
+
+#include "StealingDequeBench.h"
+#ifdef STEALING_DEQUE_BENCH
+#include <pheet/ds/StealingDeque/CircularArray/CircularArrayStealingDeque.h>
+#include <pheet/ds/StealingDeque/CircularArray11/CircularArrayStealingDeque11.h>
+#include <pheet/ds/StealingDeque/ChaseLev/ChaseLevStealingDeque.h>
+#include <pheet/sched/Basic/BasicScheduler.h>
+#include <pheet/sched/Finisher/FinisherScheduler.h>
+#endif
+
+namespace pheet {
+
+StealingDequeBench::StealingDequeBench() {
+
+}
+
+StealingDequeBench::~StealingDequeBench() {
+
+}
+
+
+void StealingDequeBench::run_test() {
+#ifdef STEALING_DEQUE_BENCH
+	std::cout << "----" << std::endl;
+
+	this->run_bench<	Pheet::WithScheduler<BasicScheduler>,
+						CircularArrayStealingDeque>();
+	this->run_bench<	Pheet::WithScheduler<BasicScheduler>,
+						CircularArrayStealingDeque11>();
+	this->run_bench<	Pheet::WithScheduler<BasicScheduler>,
+						ChaseLevStealingDeque>();
+	this->run_bench<	Pheet::WithScheduler<FinisherScheduler>,
+						CircularArrayStealingDeque>();
+	this->run_bench<	Pheet::WithScheduler<FinisherScheduler>,
+						CircularArrayStealingDeque11>();
+	this->run_bench<	Pheet::WithScheduler<FinisherScheduler>,
+						ChaseLevStealingDeque>();
+#endif
+}
+
+} /* namespace pheet */
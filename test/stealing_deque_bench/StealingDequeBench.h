@@ -0,0 +1,69 @@
+/*
+ * StealingDequeBench.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef STEALINGDEQUEBENCH_H_
+#define STEALINGDEQUEBENCH_H_
+
+#include "../init.h"
+#include "../Test.h"
+#ifdef STEALING_DEQUE_BENCH
+#include "StealingDequeTest.h"
+#endif
+
+namespace pheet {
+
+/*
+ * Compares the stealing deque implementations by running a spawn-heavy
+ * workload on a scheduler that is configured to use the given deque.
+ */
+class StealingDequeBench : Test {
+public:
+	StealingDequeBench();
+	~StealingDequeBench();
+
+	void run_test();
+
+private:
+	template<class Pheet, template <class, typename> class Deque>
+	void run_bench();
+};
+
+
+template <class Pheet, template <class, typename> class Deque>
+void StealingDequeBench::run_bench() {
+#ifdef STEALING_DEQUE_BENCH
+	typename Pheet::MachineModel mm;
+	procs_t max_cpus = std::min(mm.get_num_leaves(), Pheet::Environment::max_cpus);
+
+	for(size_t w = 0; w < sizeof(stealing_deque_bench_work)/sizeof(stealing_deque_bench_work[0]); w++) {
+		for(size_t n = 0; n < sizeof(stealing_deque_bench_n)/sizeof(stealing_deque_bench_n[0]); n++) {
+			bool max_processed = false;
+			procs_t cpus;
+			for(size_t c = 0; c < sizeof(stealing_deque_bench_cpus)/sizeof(stealing_deque_bench_cpus[0]); c++) {
+				cpus = stealing_deque_bench_cpus[c];
+				if(cpus >= max_cpus) {
+					if(!max_processed) {
+						cpus = max_cpus;
+						max_processed = true;
+					}
+					else {
+						continue;
+					}
+				}
+				StealingDequeTest<Pheet, Deque> sdt(cpus,
+						stealing_deque_bench_n[n],
+						stealing_deque_bench_work[w]);
+				sdt.run_test();
+			}
+		}
+	}
+
+#endif
+}
+} /* namespace pheet */
+#endif /* STEALINGDEQUEBENCH_H_ */
@@ -0,0 +1,53 @@
+/*
+ * StealingDequeBenchTask.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef STEALINGDEQUEBENCHTASK_H_
+#define STEALINGDEQUEBENCHTASK_H_
+
+#include "../init.h"
+
+namespace pheet {
+
+/*
+ * Recursively splits the range of blocks, so most of the time is spent in
+ * spawn, pop and steal. Each leaf only performs a tiny amount of work.
+ */
+template <class Pheet>
+class StealingDequeBenchTask : public Pheet::Task {
+public:
+	typedef StealingDequeBenchTask<Pheet> Self;
+
+	StealingDequeBenchTask(size_t* results, size_t blocks, size_t work)
+	:results(results), blocks(blocks), work(work) {}
+	~StealingDequeBenchTask() {
+
+	}
+
+	virtual void operator()() {
+		while(blocks > 1) {
+			size_t half = blocks >> 1;
+			Pheet::template
+				spawn<Self>(results + half, blocks - half, work);
+			blocks = half;
+		}
+
+		size_t v = reinterpret_cast<size_t>(results);
+		for(size_t i = 0; i < work; ++i) {
+			v = v * 6364136223846793005UL + 1442695040888963407UL;
+		}
+		*results = v;
+	}
+
+private:
+	size_t* results;
+	size_t blocks;
+	size_t work;
+};
+
+} /* namespace pheet */
+#endif /* STEALINGDEQUEBENCHTASK_H_ */
@@ -0,0 +1,65 @@
+/*
+ * StealingDequeTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Martin Wimmer
+ *	   License: Boost Software License 1.0 (BSL1.0)
+ */
+
+#ifndef STEALINGDEQUETEST_H_
+#define STEALINGDEQUETEST_H_
+
+#include "StealingDequeBenchTask.h"
+#include "../Test.h"
+
+#include <vector>
+
+namespace pheet {
+
+template <class Pheet, template <class, typename> class DequeT>
+class StealingDequeTest : Test {
+public:
+	typedef typename Pheet::template WithStealingDeque<DequeT> DequePheet;
+	typedef DequeT<DequePheet, typename DequePheet::Task*> Deque;
+
+	StealingDequeTest(procs_t cpus, size_t blocks, size_t work)
+	:cpus(cpus), blocks(blocks), work(work) {}
+	~StealingDequeTest() {}
+
+	void run_test();
+
+private:
+	procs_t cpus;
+	size_t blocks;
+	size_t work;
+};
+
+template <class Pheet, template <class, typename> class DequeT>
+void StealingDequeTest<Pheet, DequeT>::run_test() {
+	typename DequePheet::Environment::PerformanceCounters pc;
+	std::vector<size_t> results(blocks, 0);
+
+	Time start, end;
+	{typename DequePheet::Environment env(cpus, pc);
+		check_time(start);
+
+		DequePheet::template
+			finish<StealingDequeBenchTask<DequePheet> >(results.data(), blocks, work);
+		check_time(end);
+	}
+
+	double seconds = calculate_seconds(start, end);
+	std::cout << "test\tdeque\tscheduler\tblocks\twork\tcpus\ttotal_time\tspawns_per_sec\t";
+	DequePheet::Environment::PerformanceCounters::print_headers();
+	std::cout << std::endl;
+	std::cout << "stealing_deque_bench\t";
+	Deque::print_name();
+	std::cout << "\t";
+	DequePheet::Environment::print_name();
+	std::cout << "\t" << blocks << "\t" << work << "\t" << cpus << "\t" << seconds << "\t" << (blocks / seconds) << "\t";
+	pc.print_values();
+	std::cout << std::endl;
+}
+
+} /* namespace pheet */
+#endif /* STEALINGDEQUETEST_H_ */
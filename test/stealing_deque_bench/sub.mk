@@ -0,0 +1,3 @@
+
+TEST_OBJS += lib/stealing_deque_bench/StealingDequeBench.o
+TEST_OBJS_MIC += lib_mic/stealing_deque_bench/StealingDequeBench.o
\ No newline at end of file
@@ -11,6 +11,11 @@ include test/uts/sub.mk
 include test/sor/sub.mk
 include test/prefix_sum/sub.mk
 include test/set_bench/sub.mk
+include test/map_bench/sub.mk
+include test/pipeline/sub.mk
+include test/algorithms/sub.mk
 include test/count_bench/sub.mk
+include test/stealing_deque_bench/sub.mk
+include test/place_storage_bench/sub.mk
 include test/sssp/sub.mk
 include test/tristrip/sub.mk
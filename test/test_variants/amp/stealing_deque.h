@@ -13,6 +13,11 @@ namespace pheet {
 
 #define AMP_STEALING_DEQUE_TEST true
 
+#define STEALING_DEQUE_BENCH true
+const procs_t stealing_deque_bench_cpus[] = {1, 2, 6, 12, 48};
+const size_t stealing_deque_bench_n[] = {10000000};
+const size_t stealing_deque_bench_work[] = {0, 100};
+
 
 // Debug configuration
 #define SORTING_TEST true
@@ -26,7 +26,8 @@ const GraphBipartitioningProblem graph_bipartitioning_test_problems[] = {
 		// n, p, max_w
 		{35, 0.5, 1000}
 };
-const int graph_bipartitioning_test_types[] = {0};
+// 0 random, 1 gnp, 2 rmat, 3 grid, 4 geometric (see graph_generators.h)
+const int graph_bipartitioning_test_types[] = {0, 1, 2, 3, 4};
 
 //#define INAROW_TEST true
 const procs_t inarow_test_cpus[] = {1, 2, 4, 8};
@@ -56,8 +57,14 @@ const GraphBipartitioningProblem sssp_test_problems[] = {
 		// n, p, max_w
 		{3000, 0.5, 100000000},
 };
-const int sssp_test_types[] = {0};
+// 0 random, 1 gnp, 2 rmat, 3 grid, 4 geometric (see graph_generators.h)
+const int sssp_test_types[] = {0, 1, 2, 3, 4};
 const size_t sssp_test_k[] = {1024};// {1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384};
+// Graphs loaded from files, either DIMACS (.gr) or binary CSR (see sssp_graph_loader.h)
+//#define SSSP_TEST_FILES true
+//char const* const sssp_test_files[] = {"USA-road-d.USA.gr"};
+// Store edges as separate target and weight arrays (binary graph files are used without copying)
+//#define SSSP_GRAPH_SOA true
 
 //#define SSSP_SIM true
 //#define SSSP_SIM_STRUCTURED true
@@ -84,6 +91,42 @@ const size_t uts_test_repetitions = 1;
 // 8 # (T1XL) Geometric [fixed] ----- Tree size = 1635119272, tree depth = 15, num leaves = 1308100063 (80.00%)
 const unsigned int uts_test_standardworkloads[] = {0, 3};
 
+// parallel_for, parallel_reduce and parallel_scan against sequential results
+#define ALGORITHMS_TEST true
+const procs_t algorithms_test_cpus[] = {1, 2, 4, 8};
+const unsigned int algorithms_test_seeds[] = {0};
+// Empty, single element and non power of two ranges
+const size_t algorithms_test_n[] = {0, 1, 2, 1000, 100003};
+// 0 selects the grain size automatically
+const size_t algorithms_test_grain[] = {0, 1, 7, 4096};
+
+// Ordered pipeline buffers with out-of-order completion (checks order of the output)
+#define PIPELINE_TEST true
+const procs_t pipeline_test_cpus[] = {1, 2, 4, 8};
+const unsigned int pipeline_test_seeds[] = {0};
+const size_t pipeline_test_n[] = {100000};
+
+// Access cost of place-local objects (Pheet::place_singleton)
+//#define PLACE_STORAGE_BENCH true
+const procs_t place_storage_bench_cpus[] = {1, 2, 4, 8};
+const size_t place_storage_bench_blocks[] = {256};
+const size_t place_storage_bench_accesses[] = {100000};
+
+// Concurrent put/find/retrieve on a map that grows while in use (checks results)
+#define MAP_BENCH true
+const procs_t map_bench_cpus[] = {1, 2, 4, 8};
+const unsigned int map_bench_seeds[] = {0};
+const size_t map_bench_range[] = {4096};
+const size_t map_bench_blocks[] = {64};
+const double map_bench_find_p = 0.4;
+const double map_bench_put_p = 0.4;
+
+// Contention on shared counters (pheet/primitives/Counter)
+#define COUNT_BENCH true
+const procs_t count_bench_cpus[] = {1, 2, 4, 8};
+const unsigned int count_bench_seeds[] = {0};
+const size_t count_bench_n[] = {10000};
+const double count_bench_p[] = {0.7};
 
 //#define SORANDUTS
 